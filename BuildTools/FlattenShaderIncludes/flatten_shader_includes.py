@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+#
+# Resolves #include directives in a DiligentFX shader and writes the flattened source.
+#
+# Usage:
+#   flatten_shader_includes.py <input file> <output file> <shader directory>...
+#
+# Includes are resolved by file name only, the same way DiligentFXShaderSourceStreamFactory
+# resolves them at run time. Every include is replaced with the contents of the file, so include
+# guards and conditional blocks keep working exactly as before. Files that are not found in the
+# shader directories are left as #include directives and are resolved by the compiler.
+
+import os
+import re
+import sys
+
+INCLUDE_RE = re.compile(r'^\s*#\s*include\s*"([^"]+)"')
+
+
+def find_shader_files(shader_dirs):
+    files = {}
+    for shader_dir in shader_dirs:
+        for root, _, names in os.walk(shader_dir):
+            for name in names:
+                if name in files and files[name] != os.path.join(root, name):
+                    raise RuntimeError("Shader file name '{}' is not unique".format(name))
+                files[name] = os.path.join(root, name)
+    return files
+
+
+def flatten(path, files, include_stack, out_lines):
+    name = os.path.basename(path)
+    if name in include_stack:
+        raise RuntimeError("Recursive include of '{}': {}".format(name, " -> ".join(include_stack + [name])))
+    include_stack.append(name)
+
+    with open(path, 'r') as src:
+        for line in src.read().splitlines():
+            match = INCLUDE_RE.match(line)
+            if match is not None and os.path.basename(match.group(1)) in files:
+                flatten(files[os.path.basename(match.group(1))], files, include_stack, out_lines)
+            else:
+                out_lines.append(line)
+
+    include_stack.pop()
+
+
+def main():
+    if len(sys.argv) < 4:
+        print("Usage: flatten_shader_includes.py <input file> <output file> <shader directory>...")
+        return 1
+
+    input_file, output_file, shader_dirs = sys.argv[1], sys.argv[2], sys.argv[3:]
+
+    out_lines = []
+    flatten(input_file, find_shader_files(shader_dirs), [], out_lines)
+
+    output_dir = os.path.dirname(output_file)
+    if output_dir and not os.path.isdir(output_dir):
+        os.makedirs(output_dir)
+    with open(output_file, 'w') as dst:
+        dst.write('\n'.join(out_lines) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# Generates the BRDF look-up table that is embedded into the GLTF PBR renderer.
+#
+# Usage:
+#   generate_brdf_lut.py <output header> [<dimension>]
+#
+# The computation replicates IntegrateBRDF() from Shaders/GLTF_PBR/private/PrecomputeGLTF_BRDF.psh.
+# The table is stored as RG16_FLOAT texels. Columns correspond to NdotV and rows correspond to
+# the linear roughness, both sampled at texel centers.
+
+import math
+import struct
+import sys
+
+NUM_SAMPLES = 512
+
+
+def hammersley_2d(i, n):
+    bits = ((i << 16) | (i >> 16)) & 0xFFFFFFFF
+    bits = ((bits & 0x55555555) << 1) | ((bits & 0xAAAAAAAA) >> 1)
+    bits = ((bits & 0x33333333) << 2) | ((bits & 0xCCCCCCCC) >> 2)
+    bits = ((bits & 0x0F0F0F0F) << 4) | ((bits & 0xF0F0F0F0) >> 4)
+    bits = ((bits & 0x00FF00FF) << 8) | ((bits & 0xFF00FF00) >> 8)
+    return float(i) / float(n), float(bits & 0xFFFFFFFF) * 2.3283064365386963e-10
+
+
+def smith_ggx_visibility_correlated(n_dot_l, n_dot_v, alpha_roughness):
+    a2 = alpha_roughness * alpha_roughness
+    ggx_v = n_dot_l * math.sqrt(max(n_dot_v * n_dot_v * (1.0 - a2) + a2, 1e-7))
+    ggx_l = n_dot_v * math.sqrt(max(n_dot_l * n_dot_l * (1.0 - a2) + a2, 1e-7))
+    return 0.5 / (ggx_v + ggx_l)
+
+
+def saturate(x):
+    return min(max(x, 0.0), 1.0)
+
+
+def integrate_brdf(roughness, n_dot_v, xi):
+    v = (math.sqrt(1.0 - n_dot_v * n_dot_v), 0.0, n_dot_v)
+    a = roughness * roughness
+    sum_a = 0.0
+    sum_b = 0.0
+    for xi_x, xi_y in xi:
+        # ImportanceSampleGGX() with N = (0, 0, 1)
+        phi = 2.0 * math.pi * xi_x
+        cos_theta = math.sqrt((1.0 - xi_y) / (1.0 + (a * a - 1.0) * xi_y))
+        sin_theta = math.sqrt(1.0 - cos_theta * cos_theta)
+        h = (sin_theta * math.cos(phi), sin_theta * math.sin(phi), cos_theta)
+
+        v_dot_h_raw = v[0] * h[0] + v[1] * h[1] + v[2] * h[2]
+        l_z = 2.0 * v_dot_h_raw * h[2] - v[2]
+        n_dot_l = saturate(l_z)
+        n_dot_h = saturate(h[2])
+        v_dot_h = saturate(v_dot_h_raw)
+        if n_dot_l > 0.0:
+            g_vis = 4.0 * smith_ggx_visibility_correlated(n_dot_l, n_dot_v, roughness) * v_dot_h * n_dot_l / n_dot_h
+            fc = math.pow(1.0 - v_dot_h, 5.0)
+            sum_a += (1.0 - fc) * g_vis
+            sum_b += fc * g_vis
+    return sum_a / NUM_SAMPLES, sum_b / NUM_SAMPLES
+
+
+def to_half_bits(x):
+    return struct.unpack('<H', struct.pack('<e', x))[0]
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: generate_brdf_lut.py <output header> [<dimension>]")
+        return 1
+
+    output_file = sys.argv[1]
+    dim = int(sys.argv[2]) if len(sys.argv) > 2 else 128
+
+    xi = [hammersley_2d(i, NUM_SAMPLES) for i in range(NUM_SAMPLES)]
+
+    values = []
+    for y in range(dim):
+        roughness = (y + 0.5) / dim
+        for x in range(dim):
+            n_dot_v = (x + 0.5) / dim
+            brdf_a, brdf_b = integrate_brdf(roughness, n_dot_v, xi)
+            values += [to_half_bits(brdf_a), to_half_bits(brdf_b)]
+
+    with open(output_file, 'w') as dst:
+        dst.write('// This file is generated by BuildTools/GenerateBRDF_LUT/generate_brdf_lut.py. Do not edit.\n\n')
+        dst.write('static constexpr Diligent::Uint32 g_GLTF_BRDF_LUT_Dim = {};\n\n'.format(dim))
+        dst.write('// RG16_FLOAT texels\n')
+        dst.write('static const Diligent::Uint16 g_GLTF_BRDF_LUT[] =\n{\n')
+        for row in range(0, len(values), 16):
+            dst.write('    ' + ', '.join('0x{:04X}'.format(v) for v in values[row:row + 16]) + ',\n')
+        dst.write('};\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+#
+# Compiles DiligentFX shader permutations ahead of time and packs the byte code into an archive
+# that is loaded at run time by DiligentFXShaderArchive.
+#
+# Usage:
+#   precompile_shaders.py --output <archive> --shader-dir <dir> --manifest <json> [--manifest <json>...]
+#                         --hlsl-definitions <HLSLDefinitions.fxh>
+#                         [--backend d3d11|d3d12|vulkan]... [--fxc <path>] [--dxc <path>] [--allow-failures]
+#
+# Permutations are listed in JSON manifests (see DiligentFXShaderPermutations.json). Every permutation
+# is flattened with FlattenShaderIncludes, so includes are resolved by file name exactly as
+# DiligentFXShaderSourceStreamFactory resolves them. The engine's HLSL definitions (NormalizedDeviceXYToTexUV,
+# MATRIX_ELEMENT, etc.) are prepended to the source the same way the engine does it before the shader is
+# compiled by the backend compiler.
+# The script fails if any permutation fails to compile. With --allow-failures, such permutations are
+# skipped with a warning and are compiled from source at run time.
+
+import argparse
+import itertools
+import json
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'FlattenShaderIncludes'))
+import flatten_shader_includes  # noqa: E402
+
+# Keep in sync with Utilities/src/DiligentFXShaderArchive.cpp
+ARCHIVE_MAGIC = 0x41584644  # 'DFXA'
+ARCHIVE_VERSION = 2
+
+# RENDER_DEVICE_TYPE values
+DEVICE_TYPES = {
+    'd3d11': 1,
+    'd3d12': 2,
+    'vulkan': 5,
+}
+
+# Macros that the engine defines for the HLSL shaders of every backend and stage
+BACKEND_MACROS = {
+    'd3d11': {'D3D11': '1'},
+    'd3d12': {'D3D12': '1'},
+    'vulkan': {'VULKAN': '1'},
+}
+STAGE_MACROS = {
+    'vs': 'VERTEX_SHADER',
+    'ps': 'FRAGMENT_SHADER',
+    'gs': 'GEOMETRY_SHADER',
+    'hs': 'TESS_CONTROL_SHADER',
+    'ds': 'TESS_EVALUATION_SHADER',
+    'cs': 'COMPUTE_SHADER',
+}
+
+FXC_PROFILES = {
+    'd3d11': '5_0',
+    'd3d12': '5_1',
+}
+DXC_PROFILE = '6_0'
+
+# SHADER_COMPILER values, see GetShaderCompilerKey() in DiligentFXShaderArchive.cpp
+SHADER_COMPILERS = ('default', 'glslang', 'dxc', 'fxc')
+
+# Default values of the ShaderCreateInfo members that are part of the permutation key.
+# All DiligentFX shaders use combined texture samplers.
+DEFAULT_COMPILER = 'default'
+DEFAULT_HLSL_VERSION = '0.0'
+DEFAULT_COMBINED_SAMPLERS = '1'
+
+
+def get_permutation_key(perm):
+    # Must match DiligentFXShaderArchive::GetPermutationKey()
+    key = '{}|{}|{}|{}|{}|{}'.format(perm['file'], perm['entry'], perm['type'],
+                                     perm['compiler'], perm['hlsl_version'], perm['combined_samplers'])
+    for name, definition in sorted(perm['macros'].items(), key=lambda m: m[0]):
+        key += '|{}={}'.format(name, definition)
+    return key
+
+
+def fnv1a64(s):
+    h = 14695981039346656037
+    for b in s.encode('utf-8'):
+        h ^= b
+        h = (h * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def as_list(value, file_name):
+    if isinstance(value, dict):
+        value = value[file_name]
+    return value if isinstance(value, list) else [value]
+
+
+def expand_manifest(manifest):
+    permutations = []
+    for desc in manifest['permutations']:
+        macro_names = list(desc.get('macros', {}).keys())
+        macro_values = [v if isinstance(v, list) else [v] for v in desc.get('macros', {}).values()]
+        compiler = desc.get('compiler', DEFAULT_COMPILER)
+        if compiler not in SHADER_COMPILERS:
+            raise RuntimeError("Unknown shader compiler '{}'".format(compiler))
+        hlsl_version = desc.get('hlsl_version', DEFAULT_HLSL_VERSION)
+        combined_samplers = desc.get('combined_samplers', DEFAULT_COMBINED_SAMPLERS)
+        if isinstance(combined_samplers, bool):
+            combined_samplers = '1' if combined_samplers else '0'
+        for file_name in as_list(desc['file'], None):
+            for entry, shader_type, values in itertools.product(as_list(desc.get('entry', 'main'), file_name),
+                                                                as_list(desc['type'], file_name),
+                                                                itertools.product(*macro_values)):
+                permutations.append({
+                    'file': file_name,
+                    'entry': entry,
+                    'type': shader_type,
+                    'compiler': compiler,
+                    'hlsl_version': hlsl_version,
+                    'combined_samplers': combined_samplers,
+                    'macros': dict(zip(macro_names, values))
+                })
+    return permutations
+
+
+def compile_permutation(perm, source_path, backend, args, output_path):
+    macros = dict(BACKEND_MACROS[backend])
+    macros[STAGE_MACROS[perm['type']]] = '1'
+    macros.update(perm['macros'])
+
+    # Explicit HLSL version overrides the default shader model of the compiler
+    version = perm['hlsl_version'].replace('.', '_') if perm['hlsl_version'] != DEFAULT_HLSL_VERSION else None
+
+    # D3D11 always uses FXC. D3D12 uses DXC only when it is requested, as the engine does.
+    # SPIR-V is always generated by DXC.
+    if backend == 'vulkan' or (backend == 'd3d12' and perm['compiler'] == 'dxc'):
+        cmd = [args.dxc, '-O3', '-T', '{}_{}'.format(perm['type'], version or DXC_PROFILE), '-E', perm['entry'], '-Fo', output_path]
+        if backend == 'vulkan':
+            cmd += ['-spirv', '-fspv-reflect']
+        cmd += ['-D{}={}'.format(name, definition) for name, definition in macros.items()]
+    else:
+        cmd = [args.fxc, '/nologo', '/O3',
+               '/T', '{}_{}'.format(perm['type'], version or FXC_PROFILES[backend]), '/E', perm['entry'], '/Fo', output_path]
+        cmd += ['/D{}={}'.format(name, definition) for name, definition in macros.items()]
+    cmd.append(source_path)
+
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    return result.returncode == 0, result.stdout
+
+
+def write_archive(output_file, sections):
+    # Section headers are followed by the byte code of all sections
+    header_size = 12 + sum(8 + 16 * len(entries) for _, entries in sections)
+
+    header = struct.pack('<III', ARCHIVE_MAGIC, ARCHIVE_VERSION, len(sections))
+    data = b''
+    for device_type, entries in sections:
+        header += struct.pack('<II', device_type, len(entries))
+        for perm_hash, byte_code in entries:
+            header += struct.pack('<QII', perm_hash, header_size + len(data), len(byte_code))
+            data += byte_code
+
+    output_dir = os.path.dirname(output_file)
+    if output_dir and not os.path.isdir(output_dir):
+        os.makedirs(output_dir)
+    with open(output_file, 'wb') as dst:
+        dst.write(header + data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Precompiles DiligentFX shader permutations')
+    parser.add_argument('--output', required=True, help='Output archive')
+    parser.add_argument('--shader-dir', required=True, action='append', help='DiligentFX shader directory')
+    parser.add_argument('--manifest', required=True, action='append', help='Permutation manifest')
+    parser.add_argument('--hlsl-definitions', required=True, help='HLSLDefinitions.fxh from DiligentCore')
+    parser.add_argument('--backend', action='append', choices=sorted(DEVICE_TYPES.keys()), help='Target backend')
+    parser.add_argument('--fxc', default='fxc', help='Path to FXC compiler (D3D11 and D3D12)')
+    parser.add_argument('--dxc', default='dxc', help='Path to DXC compiler (Vulkan and D3D12 permutations that request DXC)')
+    parser.add_argument('--allow-failures', action='store_true', help='Skip permutations that fail to compile instead of failing')
+    args = parser.parse_args()
+
+    backends = args.backend if args.backend else sorted(DEVICE_TYPES.keys())
+
+    permutations = {}
+    for manifest_path in args.manifest:
+        with open(manifest_path, 'r') as manifest_file:
+            for perm in expand_manifest(json.load(manifest_file)):
+                permutations[get_permutation_key(perm)] = perm
+
+    shader_files = flatten_shader_includes.find_shader_files(args.shader_dir)
+
+    # The engine prepends HLSL definitions to the source of every HLSL shader
+    with open(args.hlsl_definitions, 'r') as src:
+        hlsl_definitions = src.read().splitlines()
+
+    sections = []
+    num_failed = 0
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        flattened = {}
+        for perm in permutations.values():
+            if perm['file'] in flattened:
+                continue
+            if perm['file'] not in shader_files:
+                raise RuntimeError("Shader file '{}' is not found".format(perm['file']))
+            out_lines = list(hlsl_definitions)
+            flatten_shader_includes.flatten(shader_files[perm['file']], shader_files, [], out_lines)
+            flattened_path = os.path.join(tmp_dir, perm['file'])
+            with open(flattened_path, 'w') as dst:
+                dst.write('\n'.join(out_lines) + '\n')
+            flattened[perm['file']] = flattened_path
+
+        byte_code_path = os.path.join(tmp_dir, 'byte_code.bin')
+        for backend in backends:
+            entries = []
+            for key, perm in sorted(permutations.items()):
+                succeeded, log = compile_permutation(perm, flattened[perm['file']], backend, args, byte_code_path)
+                if not succeeded:
+                    num_failed += 1
+                    print('{}: failed to compile {} for {}:\n{}'.format('warning' if args.allow_failures else 'error', key, backend, log))
+                    continue
+                with open(byte_code_path, 'rb') as src:
+                    entries.append((fnv1a64(key), src.read()))
+            sections.append((DEVICE_TYPES[backend], entries))
+            print('{}: {} of {} permutations compiled'.format(backend, len(entries), len(permutations)))
+
+    if num_failed > 0 and not args.allow_failures:
+        print('error: {} permutation(s) failed to compile'.format(num_failed))
+        return 1
+
+    write_archive(args.output, sections)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
+#include "../../../DiligentCore/Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+class EpipolarLightScattering;
+class GLTF_PBR_Renderer;
+
+/// Keeps image-based lighting of the GLTF PBR renderer in sync with the sky produced by
+/// the epipolar light scattering effect.
+
+/// When the direction on the light changes by more than the threshold, the sky is rendered into a
+/// low-resolution cube map by EpipolarLightScattering::RenderSkyCubemap(), and the renderer's
+/// IBL cube maps are updated from it incrementally over the following frames.
+class DynamicSkyIBL
+{
+public:
+    // clang-format off
+
+    /// Dynamic sky IBL create info
+    struct CreateInfo
+    {
+        /// The angle, in radians, by which the direction on the light must change
+        /// since the last update to start a new one.
+        float  SunDirectionThreshold = 0.01f;
+
+        /// The maximum number of cube map faces filtered per frame,
+        /// see GLTF_PBR_Renderer::ProcessCubemapsUpdate().
+        Uint32 FacesPerFrame         = 8;
+    };
+
+    // clang-format on
+
+    explicit DynamicSkyIBL(const CreateInfo& CI);
+
+    /// Updates the IBL cube maps of the renderer.
+
+    /// \param [in] pDevice    - Render device.
+    /// \param [in] pCtx       - Device context.
+    /// \param [in] Scattering - Light scattering effect. The method must be called after
+    ///                          EpipolarLightScattering::PrepareForNewFrame().
+    /// \param [in] Renderer   - GLTF PBR renderer whose cube maps are updated.
+    /// \param [in] DirOnLight - Direction on the light, the same as used by the scattering effect.
+    /// \return    true if new cube maps are in use starting from this frame, and false otherwise.
+    ///
+    /// \remarks   The first update is performed in full, so that the cube maps are valid
+    ///            right away. A new update is only started when the previous one is complete.
+    bool Update(IRenderDevice*           pDevice,
+                IDeviceContext*          pCtx,
+                EpipolarLightScattering& Scattering,
+                GLTF_PBR_Renderer&       Renderer,
+                const float3&            DirOnLight);
+
+    /// Makes the next Update() call re-render the sky regardless of the light direction,
+    /// for instance, after the camera altitude or the atmosphere parameters have changed.
+    void Invalidate() { m_IsValid = false; }
+
+private:
+    const CreateInfo m_CI;
+    const float      m_CosThreshold;
+
+    // Direction on the light the cube maps were last rendered for
+    float3 m_DirOnLight;
+    bool   m_IsValid     = false;
+    bool   m_HasCubemaps = false;
+};
+
+} // namespace Diligent
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <array>
+#include <functional>
 
 #include "../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
 #include "../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
@@ -40,6 +41,8 @@ namespace Diligent
 
 #include "Shaders/Common/public/BasicStructures.fxh"
 
+class RenderGraph;
+
 class ShadowMapManager
 {
 public:
@@ -125,6 +128,16 @@ public:
 
     void ConvertToFilterable(IDeviceContext* pCtx, const ShadowMapAttribs& ShadowAttribs);
 
+    /// Adds shadow map rendering and, for filterable shadow modes, conversion passes to the render graph.
+
+    /// \param [in] Graph         - Render graph to add the passes to.
+    /// \param [in] RenderCascade - Callback that renders shadow casters into the given cascade.
+    ///                             The cascade's depth-stencil view is bound and cleared before the call.
+    /// \param [in] ShadowAttribs - Shadow map attributes used by the conversion pass.
+    void AddToRenderGraph(RenderGraph&                                  Graph,
+                          std::function<void(IDeviceContext*, Uint32)> RenderCascade,
+                          const ShadowMapAttribs&                      ShadowAttribs);
+
     const CascadeTransforms& GetCascadeTranform(Uint32 Cascade) const { return m_CascadeTransforms[Cascade]; }
 
 private:
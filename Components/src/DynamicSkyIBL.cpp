@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <cmath>
+
+#include "DynamicSkyIBL.hpp"
+#include "../../PostProcess/EpipolarLightScattering/interface/EpipolarLightScattering.hpp"
+#include "../../GLTF_PBR_Renderer/interface/GLTF_PBR_Renderer.hpp"
+
+namespace Diligent
+{
+
+DynamicSkyIBL::DynamicSkyIBL(const CreateInfo& CI) :
+    m_CI{CI},
+    m_CosThreshold{std::cos(CI.SunDirectionThreshold)}
+{
+}
+
+bool DynamicSkyIBL::Update(IRenderDevice*           pDevice,
+                           IDeviceContext*          pCtx,
+                           EpipolarLightScattering& Scattering,
+                           GLTF_PBR_Renderer&       Renderer,
+                           const float3&            DirOnLight)
+{
+    // The sky cube map is the environment map of the update in progress,
+    // so it must not be re-rendered until the update is complete.
+    if (!Renderer.IsCubemapsUpdateInProgress())
+    {
+        const auto NewDirOnLight = normalize(DirOnLight);
+        if (!m_IsValid || dot(NewDirOnLight, m_DirOnLight) < m_CosThreshold)
+        {
+            auto* pSkyCubemapSRV = Scattering.RenderSkyCubemap();
+            if (pSkyCubemapSRV == nullptr)
+                return false;
+
+            m_DirOnLight = NewDirOnLight;
+            m_IsValid    = true;
+
+            if (!m_HasCubemaps)
+            {
+                Renderer.PrecomputeCubemaps(pDevice, pCtx, pSkyCubemapSRV);
+                m_HasCubemaps = true;
+                return true;
+            }
+
+            Renderer.BeginCubemapsUpdate(pDevice, pSkyCubemapSRV);
+        }
+    }
+
+    return Renderer.IsCubemapsUpdateInProgress() ?
+        Renderer.ProcessCubemapsUpdate(pCtx, m_CI.FacesPerFrame) :
+        false;
+}
+
+} // namespace Diligent
@@ -30,6 +30,8 @@
 #include "ShadowMapManager.hpp"
 #include "AdvancedMath.hpp"
 #include "../../../Utilities/include/DiligentFXShaderSourceStreamFactory.hpp"
+#include "../../../Utilities/include/DiligentFXShaderArchive.hpp"
+#include "../../../Utilities/include/RenderGraph.hpp"
 #include "GraphicsUtilities.h"
 #include "MapHelper.hpp"
 #include "CommonlyUsedStates.h"
@@ -435,7 +437,7 @@ void ShadowMapManager::InitializeConversionTechniques(TEXTURE_FORMAT FilterableS
             VertShaderCI.FilePath                   = "FullScreenTriangleVS.fx";
             VertShaderCI.EntryPoint                 = "FullScreenTriangleVS";
             VertShaderCI.Desc.Name                  = "FullScreenTriangleVS";
-            m_pDevice->CreateShader(VertShaderCI, &pScreenSizeTriVS);
+            pScreenSizeTriVS = DiligentFXShaderArchive::GetInstance().CreateShader(m_pDevice, VertShaderCI);
         }
 
         GraphicsPipelineStateCreateInfo PSOCreateInfo;
@@ -464,7 +466,7 @@ void ShadowMapManager::InitializeConversionTechniques(TEXTURE_FORMAT FilterableS
             UNEXPECTED("Unexpected shadow mode");
         }
         RefCntAutoPtr<IShader> pVSMHorzPS;
-        m_pDevice->CreateShader(ShaderCI, &pVSMHorzPS);
+        pVSMHorzPS = DiligentFXShaderArchive::GetInstance().CreateShader(m_pDevice, ShaderCI);
 
         ShaderResourceVariableDesc Variables[] =
             {
@@ -509,7 +511,7 @@ void ShadowMapManager::InitializeConversionTechniques(TEXTURE_FORMAT FilterableS
             ShaderCI.Desc.Name  = "Vertical blur pass PS";
             PSODesc.Name        = "Vertical blur pass PSO";
             RefCntAutoPtr<IShader> pVertBlurPS;
-            m_pDevice->CreateShader(ShaderCI, &pVertBlurPS);
+            pVertBlurPS = DiligentFXShaderArchive::GetInstance().CreateShader(m_pDevice, ShaderCI);
             PSOCreateInfo.pPS = pVertBlurPS;
             m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &m_BlurVertTech.PSO);
             m_BlurVertTech.PSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbConversionAttribs")->Set(m_pConversionAttribsBuffer);
@@ -603,4 +605,39 @@ void ShadowMapManager::ConvertToFilterable(IDeviceContext* pCtx, const ShadowMap
     }
 }
 
+void ShadowMapManager::AddToRenderGraph(RenderGraph&                                  Graph,
+                                        std::function<void(IDeviceContext*, Uint32)> RenderCascade,
+                                        const ShadowMapAttribs&                      ShadowAttribs)
+{
+    const auto ShadowMapId = Graph.ImportTexture(m_pShadowMapSRV->GetTexture());
+
+    Graph.AddPass(
+        "Shadow map",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Write(ShadowMapId, RESOURCE_STATE_DEPTH_WRITE);
+        },
+        [this, RenderCascade](IDeviceContext* pCtx) {
+            for (Uint32 Cascade = 0; Cascade < m_pShadowMapDSVs.size(); ++Cascade)
+            {
+                auto* pCascadeDSV = m_pShadowMapDSVs[Cascade].RawPtr();
+                pCtx->SetRenderTargets(0, nullptr, pCascadeDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pCtx->ClearDepthStencil(pCascadeDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                RenderCascade(pCtx, Cascade);
+            }
+        });
+
+    if (m_pFilterableShadowMapSRV)
+    {
+        Graph.AddPass(
+            "Shadow map conversion",
+            [&](RenderGraph::PassBuilder& Builder) {
+                Builder.Read(ShadowMapId, RESOURCE_STATE_SHADER_RESOURCE);
+                Builder.Write(Graph.ImportTexture(m_pFilterableShadowMapSRV->GetTexture()), RESOURCE_STATE_RENDER_TARGET);
+            },
+            [this, ShadowAttribs](IDeviceContext* pCtx) {
+                ConvertToFilterable(pCtx, ShadowAttribs);
+            });
+    }
+}
+
 } // namespace Diligent
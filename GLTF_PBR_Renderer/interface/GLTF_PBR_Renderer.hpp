@@ -40,6 +40,8 @@
 namespace Diligent
 {
 
+class RenderGraph;
+
 // #include "Shaders/GLTF_PBR/public/GLTF_PBR_Structures.fxh"
 #include "Shaders/GLTF_PBR/public/QxGLTF_PBR_Structures.hlsl"
 
@@ -85,6 +87,49 @@ public:
         /// Whether to use texture atlas (e.g. apply UV transforms when sampling textures).
         bool UseTextureAtlas = false;
 
+        /// When set to true, tone mapping reads the average scene luminance from the texture
+        /// set by SetAverageLuminanceSRV() instead of using RenderInfo::AverageLogLum.
+        /// This keeps auto exposure on the GPU without reading the luminance back.
+        bool UseGPUExposure = false;
+
+        /// When set to true, tone mapping looks up the color in the table set by SetToneMappingLUT()
+        /// instead of evaluating the tone mapping curve. The table replaces the curve selected by
+        /// RenderInfo::WhitePoint, which is then ignored; RenderInfo::MiddleGray is still used for exposure.
+        bool UseToneMappingLUT = false;
+
+        /// When set to true, the renderer writes linear HDR color to the render target, which should
+        /// have a floating-point format, and tone mapping is performed by a separate pass, see ToneMap().
+        /// This way tone mapping runs once per pixel rather than once per shaded fragment, transparent
+        /// materials are blended in linear space, and the HDR image is available to other effects
+        /// (e.g. AutoExposure) before it is tone mapped. UseGPUExposure and UseToneMappingLUT
+        /// then apply to the tone mapping pass.
+        bool OutputHDR = false;
+
+        /// When set to true, the BRDF look-up table is initialized from the table embedded into
+        /// the library. When set to false, the table is computed on the GPU at a higher resolution.
+        bool UseEmbeddedBRDF_LUT = true;
+
+        /// When set to true, diffuse IBL is evaluated from 9 spherical harmonics coefficients
+        /// instead of sampling the irradiance cube map, and the irradiance cube map is not created.
+        /// Requires compute shaders; the irradiance cube map is used if they are not supported.
+        bool UseSHIrradiance = false;
+
+        /// Optional IBL data previously saved by SavePrecomputedIBL().
+        /// When the data is provided, the cube maps are initialized from it, and there is no need to
+        /// call PrecomputeCubemaps(). The data is only used by the constructor.
+        const void* pPrecomputedIBLData = nullptr;
+
+        /// The size of the data pointed to by pPrecomputedIBLData, in bytes.
+        size_t PrecomputedIBLDataSize = 0;
+
+        /// The maximum number of local reflection probes, see SetReflectionProbe().
+        /// Reflection probes require IBL and cube map array support, and are disabled otherwise.
+        Uint32 MaxReflectionProbes = 0;
+
+        /// Near and far clip plane distances of the projection used to capture reflection probes.
+        float ReflectionProbeNearPlane = 0.1f;
+        float ReflectionProbeFarPlane  = 1000.f;
+
         static const SamplerDesc DefaultSampler;
 
         /// Immutable sampler for color map texture.
@@ -104,6 +149,26 @@ public:
 
         /// Maximum number of joints
         Uint32 MaxJointCount = 64;
+
+        /// Multi-view output routing mode, see MaxViews.
+        enum class MultiViewMode : Uint8
+        {
+            /// View i is rendered into render target array slice i.
+            /// The render target and depth-stencil views must cover all array slices.
+            RenderTargetArray,
+
+            /// View i is rendered into viewport i. Requires the MultiViewport device feature.
+            Viewports
+        };
+
+        /// The maximum number of views that a single Render() call can draw the model to, see RenderInfo::pViews.
+        /// When greater than 1, every draw call is instanced across the views, and the vertex shader routes
+        /// every instance to its render target array slice or viewport. The device must support writing
+        /// these indices from the vertex shader.
+        Uint32 MaxViews = 1;
+
+        /// Multi-view output routing mode.
+        MultiViewMode MultiView = MultiViewMode::RenderTargetArray;
     };
 
     /// Initializes the renderer
@@ -170,7 +235,8 @@ public:
         /// IBL scale
         float IBLScale = 1;
 
-        /// Average log luminance used by tone mapping
+        /// Average log luminance used by tone mapping.
+        /// Ignored if the renderer was created with UseGPUExposure.
         float AverageLogLum = 0.3f;
 
         /// Middle gray value used by tone mapping
@@ -178,6 +244,28 @@ public:
 
         /// White point value used by tone mapping
         float WhitePoint = 3.f;
+
+        /// View attributes used by multi-view rendering
+        struct ViewAttribs
+        {
+            /// View-projection matrix
+            float4x4 ViewProj;
+
+            /// World-space camera position
+            float3 Position;
+        };
+
+        /// Views to render the model to when the renderer is created with CreateInfo::MaxViews > 1.
+        /// In this mode, the camera attributes buffer is not used by the renderer.
+        const ViewAttribs* pViews = nullptr;
+
+        /// The number of views in pViews, must be between 1 and CreateInfo::MaxViews.
+        Uint32 NumViews = 0;
+
+        /// When set to true, the model is rendered with the reflection probe capture pipeline states,
+        /// which write linear HDR radiance to a ReflectionProbeCaptureFmt render target without tone
+        /// mapping. Resource bindings must be created with GetReflectionProbeCapturePSO().
+        bool ProbeCapture = false;
     };
 
     /// GLTF Model shader resource binding information
@@ -214,25 +302,230 @@ public:
                 ModelResourceBindings* pModelBindings,
                 ResourceCacheBindings* pCacheBindings = nullptr);
 
+    /// Adds a pass that renders a GLTF model to the render graph.
+
+    /// \param [in] Graph          - Render graph to add the pass to.
+    /// \param [in] pRTV           - Render target view to render the model to. Can be null.
+    /// \param [in] pDSV           - Depth-stencil view. Can be null.
+    /// \param [in] GLTFModel      - GLTF model to render.
+    /// \param [in] RenderParams   - Render parameters.
+    /// \param [in] pModelBindings - The model's shader resource binding information.
+    /// \param [in] pCacheBindings - Shader resource cache binding information, if the
+    ///                              model has been created using the cache.
+    ///
+    /// \remarks   The model and the bindings must stay alive until the graph is executed.
+    void AddToRenderGraph(RenderGraph&           Graph,
+                          ITextureView*          pRTV,
+                          ITextureView*          pDSV,
+                          GLTF::Model&           GLTFModel,
+                          const RenderInfo&      RenderParams,
+                          ModelResourceBindings* pModelBindings,
+                          ResourceCacheBindings* pCacheBindings = nullptr);
+
+    /// Tone maps the linear HDR color rendered by the renderer created with OutputHDR.
+
+    /// \param [in] pDevice      - Render device.
+    /// \param [in] pCtx         - Device context.
+    /// \param [in] pHDRColorSRV - Shader resource view of the HDR color buffer the models were rendered to.
+    /// \param [in] pDstRTV      - Render target view to write the tone mapped color to.
+    ///                            It must have the same size as the HDR color buffer.
+    /// \param [in] RenderParams - Render parameters. Only AverageLogLum, MiddleGray and WhitePoint are used.
+    void ToneMap(IRenderDevice*    pDevice,
+                 IDeviceContext*   pCtx,
+                 ITextureView*     pHDRColorSRV,
+                 ITextureView*     pDstRTV,
+                 const RenderInfo& RenderParams);
+
+    /// Adds the tone mapping pass, see ToneMap(), to the render graph.
+
+    /// \param [in] Graph        - Render graph to add the pass to.
+    /// \param [in] pDevice      - Render device.
+    /// \param [in] pHDRColorSRV - Shader resource view of the HDR color buffer.
+    /// \param [in] pDstRTV      - Render target view to write the tone mapped color to.
+    /// \param [in] RenderParams - Render parameters.
+    void AddToneMappingToRenderGraph(RenderGraph&      Graph,
+                                     IRenderDevice*    pDevice,
+                                     ITextureView*     pHDRColorSRV,
+                                     ITextureView*     pDstRTV,
+                                     const RenderInfo& RenderParams);
+
     /// Creates resource bindings for a given GLTF model
-    ModelResourceBindings CreateResourceBindings(GLTF::Model& GLTFModel,
-                                                 IBuffer*     pCameraAttribs,
-                                                 IBuffer*     pLightAttribs);
+
+    /// \param [in] GLTFModel      - GLTF model.
+    /// \param [in] pCameraAttribs - Camera attributes constant buffer.
+    /// \param [in] pLightAttribs  - Light attributes constant buffer.
+    /// \param [in] pPSO           - Optional PSO object to use to create the bindings instead of the
+    ///                              default PSO, e.g. ReflectionProbeCaptureInfo::pPSO. Can be null.
+    ModelResourceBindings CreateResourceBindings(GLTF::Model&    GLTFModel,
+                                                 IBuffer*        pCameraAttribs,
+                                                 IBuffer*        pLightAttribs,
+                                                 IPipelineState* pPSO = nullptr);
 
     /// Precompute cubemaps used by IBL.
     void PrecomputeCubemaps(IRenderDevice*  pDevice,
                             IDeviceContext* pCtx,
                             ITextureView*   pEnvironmentMap);
 
+    /// Starts updating cubemaps used by IBL over several frames.
+
+    /// The cubemaps are filtered into internal textures by ProcessCubemapsUpdate().
+    /// When all faces are ready, both cubemaps are copied to the textures returned by
+    /// GetIrradianceCubeSRV() and GetPrefilteredEnvMapSRV() at once, so that the renderer
+    /// always uses a consistent set. Starting a new update discards the update in progress.
+    /// The environment map must stay alive until the update is complete.
+    void BeginCubemapsUpdate(IRenderDevice* pDevice,
+                             ITextureView*  pEnvironmentMap);
+
+    /// Filters up to MaxFaces cubemap faces of the update started by BeginCubemapsUpdate().
+
+    /// \param [in] pCtx     - Device context.
+    /// \param [in] MaxFaces - The maximum number of faces to filter. Every mip level of every face
+    ///                        of both cubemaps counts as one face, 96 faces in total.
+    ///                        When spherical harmonics irradiance is used, computing the coefficients
+    ///                        counts as one face instead of the irradiance cube map faces.
+    ///                        Faces are processed starting from the most detailed mip level.
+    /// \return    true if the update has completed and the new cubemaps are in use, and false otherwise.
+    ///
+    /// \remarks   The method changes the pipeline state and, if compute shaders are not supported,
+    ///            the render targets bound to the context.
+    bool ProcessCubemapsUpdate(IDeviceContext* pCtx,
+                               Uint32          MaxFaces);
+
+    /// Returns true if a cubemaps update started by BeginCubemapsUpdate() is in progress.
+    bool IsCubemapsUpdateInProgress() const { return m_CubemapsUpdate.pEnvironmentMap != nullptr; }
+
+    /// Sets the position and the radius of the influence sphere of a local reflection probe.
+
+    /// \param [in] Index    - Probe index, must be less than CreateInfo::MaxReflectionProbes.
+    /// \param [in] Position - World-space probe position.
+    /// \param [in] Radius   - Influence radius. Pixels closer to the probe than the radius blend
+    ///                        the probe with the global environment maps, with the weight falling
+    ///                        off linearly with the distance. Zero radius removes the probe.
+    ///
+    /// \remarks   The probe is scheduled for capture. The probe data are used by the renderer
+    ///            once the capture is complete.
+    void SetReflectionProbe(Uint32 Index, const float3& Position, float Radius);
+
+    /// Schedules the probe for capture, e.g. when the scene around it has changed.
+    void InvalidateReflectionProbe(Uint32 Index);
+
+    /// Reflection probe face capture information
+    struct ReflectionProbeCaptureInfo
+    {
+        /// Probe index
+        Uint32 ProbeIndex = 0;
+
+        /// Cube map face index (+X, -X, +Y, -Y, +Z, -Z)
+        Uint32 Face = 0;
+
+        /// World-space probe position
+        float3 Position;
+
+        /// View and projection matrices of the face camera
+        float4x4 View;
+        float4x4 Proj;
+
+        /// Render target and depth-stencil views of the face. The views are bound
+        /// to the context and cleared before the callback is called.
+        /// The render target uses ReflectionProbeCaptureFmt format.
+        ITextureView* pRTV = nullptr;
+        ITextureView* pDSV = nullptr;
+
+        /// Pipeline state to create resource bindings for GLTF models rendered with
+        /// RenderInfo::ProbeCapture set to true, see GetReflectionProbeCapturePSO().
+        IPipelineState* pPSO = nullptr;
+    };
+
+    /// Format of the reflection probe capture render target.
+    static constexpr TEXTURE_FORMAT ReflectionProbeCaptureFmt = TEX_FORMAT_RGBA16_FLOAT;
+
+    /// Callback that renders the scene into one face of a reflection probe.
+    /// The callback must output linear HDR radiance: the probes are blended with the HDR
+    /// environment maps, so the capture must not be tone mapped. GLTF models are rendered
+    /// by the renderer with RenderInfo::ProbeCapture set to true. The depth-stencil buffer
+    /// uses CreateInfo::DSVFmt format.
+    using ReflectionProbeCaptureCallbackType = std::function<void(IDeviceContext*, const ReflectionProbeCaptureInfo&)>;
+
+    /// Returns the pipeline state to create resource bindings for GLTF models rendered into
+    /// reflection probes with RenderInfo::ProbeCapture set to true, see CreateResourceBindings().
+    /// Returns null if reflection probes are not used.
+    IPipelineState* GetReflectionProbeCapturePSO();
+
+    /// Captures reflection probes that are scheduled for capture.
+
+    /// \param [in] pDevice     - Render device.
+    /// \param [in] pCtx        - Device context.
+    /// \param [in] CameraPos   - World-space camera position used to prioritize the probes.
+    /// \param [in] MaxFaces    - The maximum number of probe faces to capture.
+    /// \param [in] CaptureFace - Callback that renders the scene into a probe face.
+    /// \return    The number of probes whose capture has completed.
+    ///
+    /// \remarks   Probes that have never been captured go first, then other scheduled
+    ///            probes, nearest to the camera first. A probe that is being captured is always
+    ///            completed before the next one is started. When all faces of a probe are captured,
+    ///            the probe is filtered the same way as the global environment map.
+    ///            The method changes the pipeline state and the render targets bound to the context.
+    Uint32 UpdateReflectionProbes(IRenderDevice*                            pDevice,
+                                  IDeviceContext*                           pCtx,
+                                  const float3&                             CameraPos,
+                                  Uint32                                    MaxFaces,
+                                  const ReflectionProbeCaptureCallbackType& CaptureFace);
+
+    /// Saves the BRDF look-up table, the irradiance cube map and the prefiltered environment map.
+
+    /// \param [in]  pDevice - Render device.
+    /// \param [in]  pCtx    - Device context. The method waits until the context is idle.
+    /// \param [out] Data    - The data that can be passed to LoadPrecomputedIBL() or to
+    ///                        CreateInfo::pPrecomputedIBLData. All mip levels are stored in
+    ///                        the native texture formats.
+    /// \return     true if the data was saved successfully, and false otherwise.
+    bool SavePrecomputedIBL(IRenderDevice*      pDevice,
+                            IDeviceContext*     pCtx,
+                            std::vector<Uint8>& Data);
+
+    /// Loads IBL data saved by SavePrecomputedIBL().
+
+    /// \param [in] pCtx     - Device context.
+    /// \param [in] pData    - Pointer to the data.
+    /// \param [in] DataSize - The data size, in bytes.
+    /// \return    true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks   The cube maps must have the same sizes and formats as the renderer's cube maps.
+    ///            The BRDF look-up table is only loaded if its size matches the size of the renderer's
+    ///            table, which depends on CreateInfo::UseEmbeddedBRDF_LUT. The table does not depend on
+    ///            the environment, so the current one is kept otherwise. The data must be saved by
+    ///            a renderer with the same CreateInfo::UseSHIrradiance setting.
+    ///            Loading the data discards the cube maps update in progress.
+    bool LoadPrecomputedIBL(IDeviceContext* pCtx,
+                            const void*     pData,
+                            size_t          DataSize);
+
     // clang-format off
     ITextureView* GetIrradianceCubeSRV()    { return m_pIrradianceCubeSRV; }
     ITextureView* GetPrefilteredEnvMapSRV() { return m_pPrefilteredEnvMapSRV; }
     ITextureView* GetBRDFLUTSRV()           { return m_pBRDF_LUT_SRV; }
+    IBuffer*      GetIrradianceSHBuffer()   { return m_pIrradianceSHCB; }
+
+    ITextureView* GetReflectionProbeIrradianceSRV()        { return m_pProbeIrradianceSRV; }
+    ITextureView* GetReflectionProbePrefilteredEnvMapSRV() { return m_pProbePrefilteredEnvMapSRV; }
     ITextureView* GetWhiteTexSRV()          { return m_pWhiteTexSRV; }
     ITextureView* GetBlackTexSRV()          { return m_pBlackTexSRV; }
     ITextureView* GetDefaultNormalMapSRV()  { return m_pDefaultNormalMapSRV; }
     // clang-format on
 
+    /// Sets the texture that contains the average scene luminance in the first component of
+    /// texel (0, 0), e.g. EpipolarLightScattering::GetAverageLuminanceSRV().
+
+    /// \note  The renderer must be created with UseGPUExposure. The texture must be set before
+    ///        resource bindings are created, and the bindings must be re-created if it changes.
+    void SetAverageLuminanceSRV(ITextureView* pAverageLuminanceSRV);
+
+    /// Sets the tone mapping look-up table, see ToneMappingLUT::GetSRV().
+
+    /// \note  The renderer must be created with UseToneMappingLUT. The texture must be set before
+    ///        resource bindings are created, and the bindings must be re-created if it changes.
+    void SetToneMappingLUT(ITextureView* pToneMappingLUTSRV);
+
     /// Creates a shader resource binding for the given material.
 
     /// \param [in] Model          - GLTF model that keeps material textures.
@@ -292,7 +585,33 @@ private:
     void PrecomputeBRDF(IRenderDevice*  pDevice,
                         IDeviceContext* pCtx);
 
-    void CreatePSO(IRenderDevice* pDevice);
+    void CreateEmbeddedBRDF_LUT(IRenderDevice*  pDevice,
+                                IDeviceContext* pCtx);
+
+    void CreatePSO(IRenderDevice* pDevice, bool ProbeCapture);
+    void CreateToneMappingPSO(IRenderDevice* pDevice, TEXTURE_FORMAT RTVFmt);
+
+    void CreateCubemapViews(ITexture* pCubemap, std::vector<RefCntAutoPtr<ITextureView>>& Views, Uint32 FirstArraySlice = 0);
+    void CreateReflectionProbeResources(IRenderDevice* pDevice, IDeviceContext* pCtx);
+    void FilterReflectionProbe(IDeviceContext* pCtx, Uint32 Probe);
+    void UpdateReflectionProbesCB(IDeviceContext* pCtx);
+
+    void CreateCubemapFilteringPSOs(IRenderDevice* pDevice);
+    void CreateCubemapFilteringPSOsCS(IRenderDevice* pDevice);
+    void CreateCubemapFilteringPSOsPS(IRenderDevice* pDevice);
+
+    void FilterCubemapFaces(IDeviceContext*                                 pCtx,
+                            ITextureView*                                   pEnvironmentMap,
+                            bool                                            IsIrradianceCube,
+                            ITexture*                                       pCubemap,
+                            const std::vector<RefCntAutoPtr<ITextureView>>& Views,
+                            Uint32                                          Mip,
+                            Uint32                                          FirstFace,
+                            Uint32                                          NumFaces);
+
+    void ComputeIrradianceSH(IDeviceContext* pCtx,
+                             ITextureView*   pEnvironmentMap);
+    void CopyIrradianceSH(IDeviceContext* pCtx);
 
     void InitCommonSRBVars(IShaderResourceBinding* pSRB,
                            IBuffer*                pCameraAttribs,
@@ -301,30 +620,33 @@ private:
     struct PSOKey
     {
         PSOKey() noexcept {};
-        PSOKey(GLTF::Material::ALPHA_MODE _AlphaMode, bool _DoubleSided) :
+        PSOKey(GLTF::Material::ALPHA_MODE _AlphaMode, bool _DoubleSided, bool _ProbeCapture = false) :
             AlphaMode{_AlphaMode},
-            DoubleSided{_DoubleSided}
+            DoubleSided{_DoubleSided},
+            ProbeCapture{_ProbeCapture}
         {}
 
         bool operator==(const PSOKey& rhs) const
         {
-            return AlphaMode == rhs.AlphaMode && DoubleSided == rhs.DoubleSided;
+            return AlphaMode == rhs.AlphaMode && DoubleSided == rhs.DoubleSided && ProbeCapture == rhs.ProbeCapture;
         }
         bool operator!=(const PSOKey& rhs) const
         {
-            return AlphaMode != rhs.AlphaMode || DoubleSided != rhs.DoubleSided;
+            return !(*this == rhs);
         }
 
-        GLTF::Material::ALPHA_MODE AlphaMode   =
+        GLTF::Material::ALPHA_MODE AlphaMode    =
             GLTF::Material::ALPHA_MODE_OPAQUE;
-        bool                       DoubleSided = false;
+        bool                       DoubleSided  = false;
+        bool                       ProbeCapture = false;
     };
 
     static size_t GetPSOIdx(const PSOKey& Key)
     {
         size_t PSOIdx;
 
-        PSOIdx = Key.AlphaMode == GLTF::Material::ALPHA_MODE_BLEND ? 1 : 0;
+        PSOIdx = Key.ProbeCapture ? 1 : 0;
+        PSOIdx = PSOIdx * 2 + (Key.AlphaMode == GLTF::Material::ALPHA_MODE_BLEND ? 1 : 0);
         PSOIdx = PSOIdx * 2 + (Key.DoubleSided ? 1 : 0);
         return PSOIdx;
     }
@@ -356,6 +678,13 @@ private:
     RefCntAutoPtr<ITextureView> m_pBlackTexSRV;
     RefCntAutoPtr<ITextureView> m_pDefaultNormalMapSRV;
     RefCntAutoPtr<ITextureView> m_pDefaultPhysDescSRV;
+    RefCntAutoPtr<ITextureView> m_pAverageLuminanceSRV;
+    RefCntAutoPtr<ITextureView> m_pToneMappingLUTSRV;
+
+    // Separate tone mapping pass used in HDR output mode
+    RefCntAutoPtr<IPipelineState>         m_pToneMappingPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pToneMappingSRB;
+    RefCntAutoPtr<IBuffer>                m_pToneMappingAttribsCB;
 
 
     static constexpr TEXTURE_FORMAT IrradianceCubeFmt    =
@@ -371,11 +700,90 @@ private:
     RefCntAutoPtr<IShaderResourceBinding> m_pPrecomputeIrradianceCubeSRB;
     RefCntAutoPtr<IShaderResourceBinding> m_pPrefilterEnvMapSRB;
 
+    // When compute shaders are available, every mip level of the cube maps is filtered by a single dispatch
+    static constexpr Uint32               CubemapCSThreadGroupSize         = 8;
+    bool                                  m_UseComputeToPrecomputeCubemaps = false;
+    RefCntAutoPtr<IPipelineState>         m_pComputeIrradianceCubePSO;
+    RefCntAutoPtr<IPipelineState>         m_pComputePrefilteredEnvMapPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pComputeIrradianceCubeSRB;
+    RefCntAutoPtr<IShaderResourceBinding> m_pComputePrefilteredEnvMapSRB;
+
+    // Diffuse irradiance as 9 spherical harmonics coefficients (one float4 each) that replace the irradiance cube map.
+    // The coefficients are computed into the structured buffer and copied into the constant buffer read by the renderer.
+    static constexpr Uint32               IrradianceSHThreadGroupSize = 256;
+    static constexpr Uint32               IrradianceSHSize            = 9 * sizeof(float4);
+    bool                                  m_UseSHIrradiance           = false;
+    RefCntAutoPtr<IBuffer>                m_pIrradianceSHCB;
+    RefCntAutoPtr<IBuffer>                m_pIrradianceSHBuffer;
+    RefCntAutoPtr<IPipelineState>         m_pComputeIrradianceSHPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pComputeIrradianceSHSRB;
+
+    // Per-mip UAVs when compute shaders are used, per-mip per-face RTVs otherwise
+    std::vector<RefCntAutoPtr<ITextureView>> m_IrradianceCubeViews;
+    std::vector<RefCntAutoPtr<ITextureView>> m_PrefilteredEnvMapViews;
+
+    // Cubemaps that are filtered over several frames and the progress of the update
+    struct CubemapsUpdateState
+    {
+        RefCntAutoPtr<ITextureView> pEnvironmentMap;
+
+        Uint32 Cube = 0;
+        Uint32 Mip  = 0;
+        Uint32 Face = 0;
+    };
+    CubemapsUpdateState m_CubemapsUpdate;
+
+    RefCntAutoPtr<ITexture>                  m_pUpdateIrradianceCube;
+    RefCntAutoPtr<ITexture>                  m_pUpdatePrefilteredEnvMap;
+    std::vector<RefCntAutoPtr<ITextureView>> m_UpdateIrradianceCubeViews;
+    std::vector<RefCntAutoPtr<ITextureView>> m_UpdatePrefilteredEnvMapViews;
+
+    // Local reflection probes. Every probe occupies 6 slices of the cube map arrays.
+    // The scene is captured into a single cube map, one probe at a time.
+    static constexpr Uint32 ProbeIrradianceDim  = 32;
+    static constexpr Uint32 ProbePrefilteredDim = 128;
+
+    struct ReflectionProbe
+    {
+        float3 Position;
+        float  Radius = 0;
+
+        // Position and radius of the captured data that are used by the renderer
+        float3 CapturedPosition;
+        float  CapturedRadius = 0;
+
+        bool IsCaptured  = false;
+        bool IsScheduled = false;
+
+        // Per-mip UAVs or per-mip per-face RTVs of the probe slices
+        std::vector<RefCntAutoPtr<ITextureView>> IrradianceViews;
+        std::vector<RefCntAutoPtr<ITextureView>> PrefilteredEnvMapViews;
+    };
+    bool                         m_UseReflectionProbes       = false;
+    bool                         m_IsReflectionProbesCBStale = false;
+    std::vector<ReflectionProbe> m_ReflectionProbes;
+
+    // Probe that is being captured and the next face to capture
+    Uint32 m_CaptureProbe     = ~0u;
+    Uint32 m_CaptureProbeFace = 0;
+
+    RefCntAutoPtr<ITextureView>              m_pProbeIrradianceSRV;
+    RefCntAutoPtr<ITextureView>              m_pProbePrefilteredEnvMapSRV;
+    RefCntAutoPtr<ITextureView>              m_pProbeCaptureSRV;
+    std::vector<RefCntAutoPtr<ITextureView>> m_ProbeCaptureRTVs;
+    RefCntAutoPtr<ITextureView>              m_pProbeCaptureDSV;
+    RefCntAutoPtr<IBuffer>                   m_pReflectionProbesCB;
+
+    // Multi-view rendering: view-projection matrices followed by camera positions of all views
+    Uint32                 m_MaxViews = 1;
+    RefCntAutoPtr<IBuffer> m_pViewsCB;
+
     RenderInfo m_RenderParams;
 
     RefCntAutoPtr<IBuffer> m_TransformsCB;
     RefCntAutoPtr<IBuffer> m_GLTFAttribsCB;
     RefCntAutoPtr<IBuffer> m_PrecomputeEnvMapAttribsCB;
+    RefCntAutoPtr<IBuffer> m_CubemapFaceAttribsCB;
     RefCntAutoPtr<IBuffer> m_JointsBuffer;
 };
 
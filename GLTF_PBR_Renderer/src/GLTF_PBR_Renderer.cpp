@@ -27,9 +27,12 @@
 
 #include <cstring>
 #include <array>
+#include <algorithm>
 
 #include "GLTF_PBR_Renderer.hpp"
 #include "../../../Utilities/include/DiligentFXShaderSourceStreamFactory.hpp"
+#include "../../../Utilities/include/DiligentFXShaderArchive.hpp"
+#include "../../../Utilities/include/RenderGraph.hpp"
 #include "CommonlyUsedStates.h"
 #include "HashUtils.hpp"
 #include "ShaderMacroHelper.hpp"
@@ -38,9 +41,54 @@
 #include "MapHelper.hpp"
 #include "GraphicsAccessories.hpp"
 
+#include "GLTF_BRDF_LUT.h"
+
 namespace Diligent
 {
 
+namespace
+{
+
+// Precomputed IBL data layout (little-endian):
+//  Uint32 Magic, Uint32 Version, Uint32 NumTextures
+//  For every texture (BRDF LUT, irradiance cube map, prefiltered environment map):
+//      Uint32 Format, Uint32 Width, Uint32 Height, Uint32 ArraySize, Uint32 MipLevels
+//      Tightly packed texels of all subresources, slice by slice, starting from the most detailed mip level
+//  Spherical harmonics irradiance is stored in place of the irradiance cube map as a 9x1 RGBA32_FLOAT texture
+constexpr Uint32 IBLDataMagic    = 0x4C424944; // 'DIBL'
+constexpr Uint32 IBLDataVersion  = 1;
+constexpr Uint32 IBLDataTextures = 3;
+
+Uint32 GetTexelSize(TEXTURE_FORMAT Format)
+{
+    const auto& FmtAttribs = GetTextureFormatAttribs(Format);
+    return Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+}
+
+TextureDesc GetIrradianceSHDataDesc()
+{
+    TextureDesc Desc;
+    Desc.Name      = "Irradiance SH";
+    Desc.Format    = TEX_FORMAT_RGBA32_FLOAT;
+    Desc.Width     = 9;
+    Desc.Height    = 1;
+    Desc.ArraySize = 1;
+    Desc.MipLevels = 1;
+    return Desc;
+}
+
+// Must match cbToneMappingAttribs in ToneMapGLTF_PBR.psh
+struct ToneMappingPassAttribs
+{
+    float AverageLogLum;
+    float MiddleGray;
+    float WhitePoint;
+    float Padding;
+};
+
+} // namespace
+
+
 const SamplerDesc GLTF_PBR_Renderer::CreateInfo::DefaultSampler =
     Sam_LinearWrap;
 
@@ -51,22 +99,56 @@ GLTF_PBR_Renderer::GLTF_PBR_Renderer(IRenderDevice*    pDevice,
 {
     if (m_Settings.UseIBL)
     {
-        PrecomputeBRDF(pDevice, pCtx);
+        if (m_Settings.UseEmbeddedBRDF_LUT)
+            CreateEmbeddedBRDF_LUT(pDevice, pCtx);
+        else
+            PrecomputeBRDF(pDevice, pCtx);
+
+        m_UseComputeToPrecomputeCubemaps = pDevice->GetDeviceInfo().Features.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED;
+
+        m_UseSHIrradiance = m_Settings.UseSHIrradiance && m_UseComputeToPrecomputeCubemaps;
+        if (m_Settings.UseSHIrradiance && !m_UseSHIrradiance)
+            LOG_WARNING_MESSAGE("Spherical harmonics irradiance requires compute shaders. Irradiance cube map will be used instead.");
 
         TextureDesc TexDesc;
         TexDesc.Name      = "Irradiance cube map for GLTF renderer";
         TexDesc.Type      = RESOURCE_DIM_TEX_CUBE;
         TexDesc.Usage     = USAGE_DEFAULT;
-        TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE | (m_UseComputeToPrecomputeCubemaps ? BIND_UNORDERED_ACCESS : BIND_RENDER_TARGET);
         TexDesc.Width     = IrradianceCubeDim;
         TexDesc.Height    = IrradianceCubeDim;
         TexDesc.Format    = IrradianceCubeFmt;
         TexDesc.ArraySize = 6;
         TexDesc.MipLevels = 0;
 
-        RefCntAutoPtr<ITexture> IrradainceCubeTex;
-        pDevice->CreateTexture(TexDesc, nullptr, &IrradainceCubeTex);
-        m_pIrradianceCubeSRV = IrradainceCubeTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+        if (m_UseSHIrradiance)
+        {
+            const std::array<float4, 9> ZeroSH{};
+
+            BufferDesc BuffDesc;
+            BuffDesc.Name      = "Irradiance SH CB for GLTF renderer";
+            BuffDesc.Usage     = USAGE_DEFAULT;
+            BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+            BuffDesc.Size      = IrradianceSHSize;
+            BufferData InitData{ZeroSH.data(), BuffDesc.Size};
+            pDevice->CreateBuffer(BuffDesc, &InitData, &m_pIrradianceSHCB);
+
+            BuffDesc.Name              = "Irradiance SH buffer for GLTF renderer";
+            BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+            BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+            BuffDesc.ElementByteStride = sizeof(float4);
+            pDevice->CreateBuffer(BuffDesc, &InitData, &m_pIrradianceSHBuffer);
+
+            StateTransitionDesc Barrier{m_pIrradianceSHCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+            pCtx->TransitionResourceStates(1, &Barrier);
+        }
+        else
+        {
+            RefCntAutoPtr<ITexture> IrradainceCubeTex;
+            pDevice->CreateTexture(TexDesc, nullptr, &IrradainceCubeTex);
+            m_pIrradianceCubeSRV = IrradainceCubeTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+            CreateCubemapViews(IrradainceCubeTex, m_IrradianceCubeViews);
+        }
 
         TexDesc.Name   = "Prefiltered environment map for GLTF renderer";
         TexDesc.Width  = PrefilteredEnvMapDim;
@@ -76,6 +158,25 @@ GLTF_PBR_Renderer::GLTF_PBR_Renderer(IRenderDevice*    pDevice,
         pDevice->CreateTexture(TexDesc, nullptr, &PrefilteredEnvMapTex);
         m_pPrefilteredEnvMapSRV = PrefilteredEnvMapTex->GetDefaultView(
             TEXTURE_VIEW_SHADER_RESOURCE);
+
+        CreateCubemapViews(PrefilteredEnvMapTex, m_PrefilteredEnvMapViews);
+
+        if (m_Settings.pPrecomputedIBLData != nullptr)
+            LoadPrecomputedIBL(pCtx, m_Settings.pPrecomputedIBLData, m_Settings.PrecomputedIBLDataSize);
+
+        if (m_Settings.MaxReflectionProbes > 0)
+        {
+            // Probes are captured with the renderer's own pipeline states, which require a known render target format
+            m_UseReflectionProbes = pDevice->GetAdapterInfo().Texture.CubemapArraysSupported && m_Settings.RTVFmt != TEX_FORMAT_UNKNOWN;
+            if (m_UseReflectionProbes)
+                CreateReflectionProbeResources(pDevice, pCtx);
+            else
+                LOG_WARNING_MESSAGE("Reflection probes require cube map arrays and a known render target format. Reflection probes will be disabled.");
+        }
+    }
+    else if (m_Settings.MaxReflectionProbes > 0)
+    {
+        LOG_WARNING_MESSAGE("Reflection probes require IBL. Reflection probes will be disabled.");
     }
 
     {
@@ -155,7 +256,26 @@ GLTF_PBR_Renderer::GLTF_PBR_Renderer(IRenderDevice*    pDevice,
         // clang-format on
         pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
 
-        CreatePSO(pDevice);
+        m_MaxViews = std::max(m_Settings.MaxViews, 1u);
+        if (m_MaxViews > 1 && m_Settings.MultiView == CreateInfo::MultiViewMode::Viewports &&
+            pDevice->GetDeviceInfo().Features.MultiViewport == DEVICE_FEATURE_STATE_DISABLED)
+        {
+            LOG_WARNING_MESSAGE("Multi-view rendering to viewports requires the MultiViewport device feature. Multi-view rendering is disabled.");
+            m_MaxViews = 1;
+        }
+
+        if (m_MaxViews > 1)
+        {
+            CreateUniformBuffer(pDevice, static_cast<Uint32>((sizeof(float4x4) + sizeof(float4)) * m_MaxViews),
+                "GLTF views CB", &m_pViewsCB);
+
+            StateTransitionDesc Barrier{m_pViewsCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+            pCtx->TransitionResourceStates(1, &Barrier);
+        }
+
+        CreatePSO(pDevice, false);
+        if (m_UseReflectionProbes)
+            CreatePSO(pDevice, true);
     }
 }
 
@@ -200,7 +320,7 @@ void GLTF_PBR_Renderer::PrecomputeBRDF(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "FullScreenTriangleVS";
             ShaderCI.Desc.Name       = "Full screen triangle VS";
             ShaderCI.FilePath        = "FullScreenTriangleVS.fx";
-            pDevice->CreateShader(ShaderCI, &pVS);
+            pVS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         // Create pixel shader
@@ -210,7 +330,7 @@ void GLTF_PBR_Renderer::PrecomputeBRDF(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "PrecomputeBRDF_PS";
             ShaderCI.Desc.Name       = "Precompute GLTF BRDF PS";
             ShaderCI.FilePath        = "PrecomputeGLTF_BRDF.psh";
-            pDevice->CreateShader(ShaderCI, &pPS);
+            pPS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         // Finally, create the pipeline state
@@ -239,17 +359,316 @@ void GLTF_PBR_Renderer::PrecomputeBRDF(IRenderDevice*  pDevice,
     pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
 }
 
-void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
+void GLTF_PBR_Renderer::CreateEmbeddedBRDF_LUT(IRenderDevice*  pDevice,
+                                               IDeviceContext* pCtx)
+{
+    static_assert(sizeof(g_GLTF_BRDF_LUT) == g_GLTF_BRDF_LUT_Dim * g_GLTF_BRDF_LUT_Dim * 2 * sizeof(Uint16), "Unexpected BRDF LUT size");
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "GLTF BRDF Look-up texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Width     = g_GLTF_BRDF_LUT_Dim;
+    TexDesc.Height    = g_GLTF_BRDF_LUT_Dim;
+    TexDesc.Format    = TEX_FORMAT_RG16_FLOAT;
+    TexDesc.MipLevels = 1;
+
+    TextureSubResData       Level0Data{g_GLTF_BRDF_LUT, g_GLTF_BRDF_LUT_Dim * 2 * sizeof(Uint16)};
+    TextureData             InitData{&Level0Data, 1};
+    RefCntAutoPtr<ITexture> pBRDF_LUT;
+    pDevice->CreateTexture(TexDesc, &InitData, &pBRDF_LUT);
+    m_pBRDF_LUT_SRV = pBRDF_LUT->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    StateTransitionDesc Barrier{pBRDF_LUT, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pCtx->TransitionResourceStates(1, &Barrier);
+}
+
+bool GLTF_PBR_Renderer::SavePrecomputedIBL(IRenderDevice*      pDevice,
+                                           IDeviceContext*     pCtx,
+                                           std::vector<Uint8>& Data)
+{
+    if (!m_Settings.UseIBL)
+    {
+        LOG_ERROR_MESSAGE("IBL is disabled, so there is no IBL data to save");
+        return false;
+    }
+
+    // The irradiance cube map is null when spherical harmonics are used
+    ITexture* pTextures[] = {
+        m_pBRDF_LUT_SRV->GetTexture(),
+        m_pIrradianceCubeSRV ? m_pIrradianceCubeSRV->GetTexture() : nullptr,
+        m_pPrefilteredEnvMapSRV->GetTexture() //
+    };
+    static_assert(_countof(pTextures) == IBLDataTextures, "Unexpected number of IBL textures");
+
+    RefCntAutoPtr<IBuffer> pStagingSH;
+    if (m_UseSHIrradiance)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "IBL data staging buffer";
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        BuffDesc.Size           = IrradianceSHSize;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingSH);
+        if (!pStagingSH)
+        {
+            LOG_ERROR_MESSAGE("Failed to create staging buffer to save IBL data");
+            return false;
+        }
+        pCtx->CopyBuffer(m_pIrradianceSHCB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingSH, 0, IrradianceSHSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    std::vector<StateTransitionDesc> Barriers;
+    if (pStagingSH)
+        Barriers.emplace_back(m_pIrradianceSHCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE);
+
+    RefCntAutoPtr<ITexture> pStagingTextures[IBLDataTextures];
+    for (Uint32 i = 0; i < IBLDataTextures; ++i)
+    {
+        if (pTextures[i] == nullptr)
+            continue;
+
+        Barriers.emplace_back(pTextures[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+
+        auto TexDesc           = pTextures[i]->GetDesc();
+        TexDesc.Name           = "IBL data staging texture";
+        TexDesc.Usage          = USAGE_STAGING;
+        TexDesc.BindFlags      = BIND_NONE;
+        TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateTexture(TexDesc, nullptr, &pStagingTextures[i]);
+        if (!pStagingTextures[i])
+        {
+            LOG_ERROR_MESSAGE("Failed to create staging texture to save IBL data");
+            return false;
+        }
+
+        for (Uint32 slice = 0; slice < TexDesc.ArraySize; ++slice)
+        {
+            for (Uint32 mip = 0; mip < TexDesc.MipLevels; ++mip)
+            {
+                CopyTextureAttribs CopyAttribs{pTextures[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTextures[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+                CopyAttribs.SrcMipLevel = mip;
+                CopyAttribs.SrcSlice    = slice;
+                CopyAttribs.DstMipLevel = mip;
+                CopyAttribs.DstSlice    = slice;
+                pCtx->CopyTexture(CopyAttribs);
+            }
+        }
+    }
+
+    pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+    pCtx->WaitForIdle();
+
+    Data.clear();
+    auto WriteUint32 = [&Data](Uint32 Val) //
+    {
+        const auto* pVal = reinterpret_cast<const Uint8*>(&Val);
+        Data.insert(Data.end(), pVal, pVal + sizeof(Val));
+    };
+    WriteUint32(IBLDataMagic);
+    WriteUint32(IBLDataVersion);
+    WriteUint32(IBLDataTextures);
+    for (Uint32 i = 0; i < IBLDataTextures; ++i)
+    {
+        const auto& TexDesc = pStagingTextures[i] ? pStagingTextures[i]->GetDesc() : GetIrradianceSHDataDesc();
+        WriteUint32(TexDesc.Format);
+        WriteUint32(TexDesc.Width);
+        WriteUint32(TexDesc.Height);
+        WriteUint32(TexDesc.ArraySize);
+        WriteUint32(TexDesc.MipLevels);
+
+        if (!pStagingTextures[i])
+        {
+            PVoid pMappedData = nullptr;
+            pCtx->MapBuffer(pStagingSH, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pMappedData);
+            if (pMappedData == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Failed to map staging buffer to save IBL data");
+                Data.clear();
+                return false;
+            }
+            Data.insert(Data.end(), static_cast<const Uint8*>(pMappedData), static_cast<const Uint8*>(pMappedData) + IrradianceSHSize);
+            pCtx->UnmapBuffer(pStagingSH, MAP_READ);
+            continue;
+        }
+
+        const auto TexelSize = GetTexelSize(TexDesc.Format);
+        for (Uint32 slice = 0; slice < TexDesc.ArraySize; ++slice)
+        {
+            for (Uint32 mip = 0; mip < TexDesc.MipLevels; ++mip)
+            {
+                const Uint32 RowSize = std::max(TexDesc.Width >> mip, 1u) * TexelSize;
+                const Uint32 Height  = std::max(TexDesc.Height >> mip, 1u);
+
+                MappedTextureSubresource MappedData;
+                pCtx->MapTextureSubresource(pStagingTextures[i], mip, slice, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+                if (MappedData.pData == nullptr)
+                {
+                    LOG_ERROR_MESSAGE("Failed to map staging texture to save IBL data");
+                    Data.clear();
+                    return false;
+                }
+                for (Uint32 y = 0; y < Height; ++y)
+                {
+                    const auto* pRow = reinterpret_cast<const Uint8*>(MappedData.pData) + y * MappedData.Stride;
+                    Data.insert(Data.end(), pRow, pRow + RowSize);
+                }
+                pCtx->UnmapTextureSubresource(pStagingTextures[i], mip, slice);
+            }
+        }
+    }
+
+    return true;
+}
+
+bool GLTF_PBR_Renderer::LoadPrecomputedIBL(IDeviceContext* pCtx,
+                                           const void*     pData,
+                                           size_t          DataSize)
+{
+    if (!m_Settings.UseIBL)
+    {
+        LOG_WARNING_MESSAGE("IBL is disabled, so loading IBL data will have no effect");
+        return false;
+    }
+
+    const auto* const pBytes = static_cast<const Uint8*>(pData);
+
+    size_t Offset     = 0;
+    auto   ReadUint32 = [&](Uint32& Val) //
+    {
+        if (Offset + sizeof(Val) > DataSize)
+            return false;
+        memcpy(&Val, pBytes + Offset, sizeof(Val));
+        Offset += sizeof(Val);
+        return true;
+    };
+
+    Uint32 Magic       = 0;
+    Uint32 Version     = 0;
+    Uint32 NumTextures = 0;
+    if (pData == nullptr || !ReadUint32(Magic) || !ReadUint32(Version) || !ReadUint32(NumTextures) || Magic != IBLDataMagic)
+    {
+        LOG_ERROR_MESSAGE("The data is not valid precomputed IBL data");
+        return false;
+    }
+    if (Version != IBLDataVersion || NumTextures != IBLDataTextures)
+    {
+        LOG_ERROR_MESSAGE("Precomputed IBL data version ", Version, " is not supported. Expected version: ", IBLDataVersion);
+        return false;
+    }
+
+    // The irradiance cube map is null when spherical harmonics are used
+    ITexture* pTextures[] = {
+        m_pBRDF_LUT_SRV->GetTexture(),
+        m_pIrradianceCubeSRV ? m_pIrradianceCubeSRV->GetTexture() : nullptr,
+        m_pPrefilteredEnvMapSRV->GetTexture() //
+    };
+
+    // Validate the whole data before updating any texture
+    std::vector<TextureSubResData> SubresData[IBLDataTextures];
+    for (Uint32 i = 0; i < IBLDataTextures; ++i)
+    {
+        Uint32 Format    = 0;
+        Uint32 Width     = 0;
+        Uint32 Height    = 0;
+        Uint32 ArraySize = 0;
+        Uint32 MipLevels = 0;
+        if (!ReadUint32(Format) || !ReadUint32(Width) || !ReadUint32(Height) || !ReadUint32(ArraySize) || !ReadUint32(MipLevels))
+        {
+            LOG_ERROR_MESSAGE("Precomputed IBL data is truncated");
+            return false;
+        }
+
+        if (Format == TEX_FORMAT_UNKNOWN || Format >= TEX_FORMAT_NUM_FORMATS ||
+            GetTextureFormatAttribs(static_cast<TEXTURE_FORMAT>(Format)).ComponentType == COMPONENT_TYPE_COMPRESSED ||
+            Width == 0 || Height == 0 || MipLevels == 0 || MipLevels > 32)
+        {
+            LOG_ERROR_MESSAGE("Precomputed IBL data is corrupted");
+            return false;
+        }
+
+        const auto& TexDesc  = pTextures[i] != nullptr ? pTextures[i]->GetDesc() : GetIrradianceSHDataDesc();
+        const bool  IsCompat = Format == TexDesc.Format && Width == TexDesc.Width && Height == TexDesc.Height &&
+            ArraySize == TexDesc.ArraySize && MipLevels == TexDesc.MipLevels;
+        // The BRDF look-up table does not depend on the environment and may be skipped
+        if (!IsCompat && i != 0)
+        {
+            LOG_ERROR_MESSAGE("Texture '", TexDesc.Name, "' in precomputed IBL data is incompatible with the renderer");
+            return false;
+        }
+
+        const auto TexelSize = GetTexelSize(static_cast<TEXTURE_FORMAT>(Format));
+        for (Uint32 slice = 0; slice < ArraySize; ++slice)
+        {
+            for (Uint32 mip = 0; mip < MipLevels; ++mip)
+            {
+                const Uint32 RowSize = std::max(Width >> mip, 1u) * TexelSize;
+                const size_t Size    = size_t{RowSize} * std::max(Height >> mip, 1u);
+                if (Offset + Size > DataSize)
+                {
+                    LOG_ERROR_MESSAGE("Precomputed IBL data is truncated");
+                    return false;
+                }
+                if (IsCompat)
+                    SubresData[i].emplace_back(pBytes + Offset, RowSize);
+                Offset += Size;
+            }
+        }
+    }
+
+    if (SubresData[0].empty())
+        LOG_INFO_MESSAGE("BRDF look-up table in precomputed IBL data has a different size and is not loaded");
+
+    // An update that is in progress would overwrite the loaded cube maps
+    m_CubemapsUpdate = CubemapsUpdateState{};
+
+    std::vector<StateTransitionDesc> Barriers;
+    for (Uint32 i = 0; i < IBLDataTextures; ++i)
+    {
+        if (pTextures[i] == nullptr)
+        {
+            pCtx->UpdateBuffer(m_pIrradianceSHCB, 0, IrradianceSHSize, SubresData[i][0].pData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            Barriers.emplace_back(m_pIrradianceSHCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE);
+            continue;
+        }
+
+        Barriers.emplace_back(pTextures[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+
+        const auto& TexDesc = pTextures[i]->GetDesc();
+        for (Uint32 subres = 0; subres < SubresData[i].size(); ++subres)
+        {
+            const Uint32 slice = subres / TexDesc.MipLevels;
+            const Uint32 mip   = subres % TexDesc.MipLevels;
+
+            Box DstBox{0, std::max(TexDesc.Width >> mip, 1u), 0, std::max(TexDesc.Height >> mip, 1u)};
+            pCtx->UpdateTexture(pTextures[i], mip, slice, DstBox, SubresData[i][subres], RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+    }
+    pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+    return true;
+}
+
+void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice, bool ProbeCapture)
 {
+    // Reflection probes store linear radiance that is blended with the HDR environment maps,
+    // so probe capture pipelines always skip tone mapping
+    const bool OutputHDR = m_Settings.OutputHDR || ProbeCapture;
+
     GraphicsPipelineStateCreateInfo PSOCreateInfo;
     PipelineStateDesc&              PSODesc          = PSOCreateInfo.PSODesc;
     GraphicsPipelineDesc&           GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
 
-    PSODesc.Name         = "Render GLTF PBR PSO";
+    PSODesc.Name         = ProbeCapture ? "Render GLTF PBR probe capture PSO" : "Render GLTF PBR PSO";
     PSODesc.PipelineType = PIPELINE_TYPE_GRAPHICS;
 
     GraphicsPipeline.NumRenderTargets                     = 1;
     GraphicsPipeline.RTVFormats[0]                        = m_Settings.RTVFmt;
+    if (ProbeCapture)
+        GraphicsPipeline.RTVFormats[0] = ReflectionProbeCaptureFmt;
     GraphicsPipeline.DSVFormat                            = m_Settings.DSVFmt;
     GraphicsPipeline.PrimitiveTopology                    = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
     GraphicsPipeline.RasterizerDesc.CullMode              = CULL_MODE_BACK;
@@ -269,6 +688,14 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
     Macros.AddShaderMacro("GLTF_PBR_USE_AO", m_Settings.UseAO);
     Macros.AddShaderMacro("GLTF_PBR_USE_EMISSIVE", m_Settings.UseEmissive);
     Macros.AddShaderMacro("USE_TEXTURE_ATLAS", m_Settings.UseTextureAtlas);
+    // In HDR output mode, exposure and the tone mapping LUT are only used by the tone mapping pass
+    Macros.AddShaderMacro("GLTF_PBR_USE_GPU_EXPOSURE", m_Settings.UseGPUExposure && !OutputHDR);
+    Macros.AddShaderMacro("GLTF_PBR_USE_TONE_MAPPING_LUT", m_Settings.UseToneMappingLUT && !OutputHDR);
+    Macros.AddShaderMacro("GLTF_PBR_OUTPUT_HDR", OutputHDR);
+    Macros.AddShaderMacro("GLTF_PBR_USE_SH_IRRADIANCE", m_UseSHIrradiance);
+    Macros.AddShaderMacro("GLTF_PBR_MAX_REFLECTION_PROBES", m_UseReflectionProbes ? static_cast<Int32>(m_Settings.MaxReflectionProbes) : 0);
+    Macros.AddShaderMacro("GLTF_PBR_MAX_VIEWS", static_cast<Int32>(m_MaxViews));
+    Macros.AddShaderMacro("GLTF_PBR_MULTI_VIEW_VIEWPORTS", m_Settings.MultiView == CreateInfo::MultiViewMode::Viewports);
     Macros.AddShaderMacro("PBR_WORKFLOW_METALLIC_ROUGHNESS", GLTF::Material::PBR_WORKFLOW_METALL_ROUGH);
     Macros.AddShaderMacro("PBR_WORKFLOW_SPECULAR_GLOSINESS", GLTF::Material::PBR_WORKFLOW_SPEC_GLOSS);
     Macros.AddShaderMacro("GLTF_ALPHA_MODE_OPAQUE", GLTF::Material::ALPHA_MODE_OPAQUE);
@@ -281,7 +708,7 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
         ShaderCI.EntryPoint      = "main";
         ShaderCI.Desc.Name       = "GLTF PBR VS";
         ShaderCI.FilePath        = "RenderGLTF_PBR.vsh";
-        pDevice->CreateShader(ShaderCI, &pVS);
+        pVS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
     }
 
     // Create pixel shader
@@ -291,7 +718,7 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
         ShaderCI.EntryPoint      = "main";
         ShaderCI.Desc.Name       = "GLTF PBR PS";
         ShaderCI.FilePath        = "RenderGLTF_PBR.psh";
-        pDevice->CreateShader(ShaderCI, &pPS);
+        pPS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
     }
 
     // clang-format off
@@ -318,6 +745,9 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
     };
     // clang-format on
 
+    if (m_MaxViews > 1)
+        Vars.emplace_back(SHADER_TYPE_VERTEX, "cbViews", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
     std::vector<ImmutableSamplerDesc> ImtblSamplers;
     // clang-format off
     if (m_Settings.UseImmutableSamplers)
@@ -338,18 +768,35 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
         ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_EmissiveMap", m_Settings.EmissiveMapImmutableSampler);
     }
 
+    if (m_Settings.UseToneMappingLUT && !OutputHDR)
+    {
+        ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_ToneMappingLUT", Sam_LinearClamp);
+    }
+
     if (m_Settings.UseIBL)
     {
         Vars.emplace_back(SHADER_TYPE_PIXEL, "g_BRDF_LUT", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+        if (m_UseSHIrradiance)
+            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbIrradianceSH", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
 
         // clang-format off
         ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_BRDF_LUT",
             Sam_LinearClamp);
-        ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_IrradianceMap",
-            Sam_LinearClamp);
+        if (!m_UseSHIrradiance)
+        {
+            ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_IrradianceMap",
+                Sam_LinearClamp);
+        }
         ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_PrefilteredEnvMap",
             Sam_LinearClamp);
         // clang-format on
+
+        if (m_UseReflectionProbes)
+        {
+            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbReflectionProbes", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+            ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_ProbeIrradianceMaps", Sam_LinearClamp);
+            ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_ProbePrefilteredEnvMaps", Sam_LinearClamp);
+        }
     }
 
     PSODesc.ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
@@ -361,7 +808,7 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
     PSOCreateInfo.pPS = pPS;
 
     {
-        PSOKey Key{GLTF::Material::ALPHA_MODE_OPAQUE, false};
+        PSOKey Key{GLTF::Material::ALPHA_MODE_OPAQUE, false, ProbeCapture};
 
         RefCntAutoPtr<IPipelineState> pSingleSidedOpaquePSO;
         pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pSingleSidedOpaquePSO);
@@ -389,7 +836,7 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
     RT0.BlendOpAlpha   = BLEND_OPERATION_ADD;
 
     {
-        PSOKey Key{GLTF::Material::ALPHA_MODE_BLEND, false};
+        PSOKey Key{GLTF::Material::ALPHA_MODE_BLEND, false, ProbeCapture};
 
         RefCntAutoPtr<IPipelineState> pSingleSidedBlendPSO;
         pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pSingleSidedBlendPSO);
@@ -404,13 +851,19 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
         AddPSO(Key, std::move(pDoubleSidedBlendPSO));
     }
 
-    for (auto& PSO : m_PSOCache)
+    // Probe capture pipelines follow the regular ones in the cache
+    for (auto PSOIdx = GetPSOIdx(PSOKey{GLTF::Material::ALPHA_MODE_OPAQUE, false, ProbeCapture}); PSOIdx < m_PSOCache.size(); ++PSOIdx)
     {
+        auto& PSO = m_PSOCache[PSOIdx];
         if (m_Settings.UseIBL)
         {
             PSO->GetStaticVariableByName(
                 SHADER_TYPE_PIXEL,
                 "g_BRDF_LUT")->Set(m_pBRDF_LUT_SRV);
+            if (m_UseSHIrradiance)
+                PSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbIrradianceSH")->Set(m_pIrradianceSHCB);
+            if (m_UseReflectionProbes)
+                PSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbReflectionProbes")->Set(m_pReflectionProbesCB);
         }
         // clang-format off
         PSO->GetStaticVariableByName(
@@ -421,6 +874,8 @@ void GLTF_PBR_Renderer::CreatePSO(IRenderDevice* pDevice)
         PSO->GetStaticVariableByName(SHADER_TYPE_VERTEX,
             "cbJointTransforms")->Set(m_JointsBuffer);
         // clang-format on
+        if (m_MaxViews > 1)
+            PSO->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbViews")->Set(m_pViewsCB);
     }
 }
 
@@ -457,7 +912,159 @@ void GLTF_PBR_Renderer::InitCommonSRBVars(IShaderResourceBinding* pSRB,
         if (auto* pPrefilteredEnvMap =
             pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_PrefilteredEnvMap"))
             pPrefilteredEnvMap->Set(m_pPrefilteredEnvMapSRV);
+
+        if (auto* pProbeIrradianceMapsVar =
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_ProbeIrradianceMaps"))
+            pProbeIrradianceMapsVar->Set(m_pProbeIrradianceSRV);
+
+        if (auto* pProbePrefilteredEnvMapsVar =
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_ProbePrefilteredEnvMaps"))
+            pProbePrefilteredEnvMapsVar->Set(m_pProbePrefilteredEnvMapSRV);
+    }
+
+    if (m_Settings.UseGPUExposure && !m_Settings.OutputHDR)
+    {
+        DEV_CHECK_ERR(m_pAverageLuminanceSRV != nullptr, "Average luminance SRV must be set by SetAverageLuminanceSRV() before creating resource bindings");
+        if (auto* pAverageLuminanceVar =
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_AverageLuminance"))
+            pAverageLuminanceVar->Set(m_pAverageLuminanceSRV);
+    }
+
+    if (m_Settings.UseToneMappingLUT && !m_Settings.OutputHDR)
+    {
+        DEV_CHECK_ERR(m_pToneMappingLUTSRV != nullptr, "Tone mapping LUT must be set by SetToneMappingLUT() before creating resource bindings");
+        if (auto* pToneMappingLUTVar =
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_ToneMappingLUT"))
+            pToneMappingLUTVar->Set(m_pToneMappingLUTSRV);
+    }
+}
+
+void GLTF_PBR_Renderer::SetAverageLuminanceSRV(ITextureView* pAverageLuminanceSRV)
+{
+    DEV_CHECK_ERR(m_Settings.UseGPUExposure, "The renderer must be created with UseGPUExposure to use the average luminance texture");
+    m_pAverageLuminanceSRV = pAverageLuminanceSRV;
+}
+
+void GLTF_PBR_Renderer::SetToneMappingLUT(ITextureView* pToneMappingLUTSRV)
+{
+    DEV_CHECK_ERR(m_Settings.UseToneMappingLUT, "The renderer must be created with UseToneMappingLUT to use the tone mapping LUT");
+    m_pToneMappingLUTSRV = pToneMappingLUTSRV;
+}
+
+void GLTF_PBR_Renderer::CreateToneMappingPSO(IRenderDevice* pDevice, TEXTURE_FORMAT RTVFmt)
+{
+    if (!m_pToneMappingAttribsCB)
+    {
+        CreateUniformBuffer(pDevice, sizeof(ToneMappingPassAttribs), "GLTF tone mapping attribs CB", &m_pToneMappingAttribsCB);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PipelineStateDesc&              PSODesc          = PSOCreateInfo.PSODesc;
+    GraphicsPipelineDesc&           GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name         = "GLTF tone mapping PSO";
+    PSODesc.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = RTVFmt;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.pShaderSourceStreamFactory = &DiligentFXShaderSourceStreamFactory::GetInstance();
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.EntryPoint      = "FullScreenTriangleVS";
+        ShaderCI.Desc.Name       = "Full screen triangle VS";
+        ShaderCI.FilePath        = "FullScreenTriangleVS.fx";
+        pVS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+    }
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TONE_MAPPING_MODE", "TONE_MAPPING_MODE_UNCHARTED2");
+    Macros.AddShaderMacro("GLTF_PBR_USE_GPU_EXPOSURE", m_Settings.UseGPUExposure);
+    Macros.AddShaderMacro("GLTF_PBR_USE_TONE_MAPPING_LUT", m_Settings.UseToneMappingLUT);
+    ShaderCI.Macros = Macros;
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "GLTF tone mapping PS";
+        ShaderCI.FilePath        = "ToneMapGLTF_PBR.psh";
+        pPS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+    }
+
+    // All textures may change between frames, so they are bound right before the draw call
+    PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    // clang-format off
+    ShaderResourceVariableDesc Vars[] =
+    {
+        {SHADER_TYPE_PIXEL, "cbToneMappingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC}
+    };
+    ImmutableSamplerDesc ImtblSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_ToneMappingLUT", Sam_LinearClamp}
+    };
+    // clang-format on
+    PSODesc.ResourceLayout.NumVariables         = _countof(Vars);
+    PSODesc.ResourceLayout.Variables            = Vars;
+    PSODesc.ResourceLayout.NumImmutableSamplers = m_Settings.UseToneMappingLUT ? _countof(ImtblSamplers) : 0;
+    PSODesc.ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    m_pToneMappingPSO.Release();
+    m_pToneMappingSRB.Release();
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &m_pToneMappingPSO);
+    m_pToneMappingPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbToneMappingAttribs")->Set(m_pToneMappingAttribsCB);
+    m_pToneMappingPSO->CreateShaderResourceBinding(&m_pToneMappingSRB, true);
+}
+
+void GLTF_PBR_Renderer::ToneMap(IRenderDevice*    pDevice,
+                                IDeviceContext*   pCtx,
+                                ITextureView*     pHDRColorSRV,
+                                ITextureView*     pDstRTV,
+                                const RenderInfo& RenderParams)
+{
+    DEV_CHECK_ERR(m_Settings.OutputHDR, "The renderer must be created with OutputHDR to use the tone mapping pass");
+    DEV_CHECK_ERR(pHDRColorSRV != nullptr && pDstRTV != nullptr, "HDR color SRV and destination RTV must not be null");
+
+    const auto DstFmt = pDstRTV->GetDesc().Format;
+    if (!m_pToneMappingPSO || m_pToneMappingPSO->GetGraphicsPipelineDesc().RTVFormats[0] != DstFmt)
+        CreateToneMappingPSO(pDevice, DstFmt);
+
+    {
+        MapHelper<ToneMappingPassAttribs> Attribs{pCtx, m_pToneMappingAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        Attribs->AverageLogLum = RenderParams.AverageLogLum;
+        Attribs->MiddleGray    = RenderParams.MiddleGray;
+        Attribs->WhitePoint    = RenderParams.WhitePoint;
+    }
+
+    m_pToneMappingSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_HDRColor")->Set(pHDRColorSRV);
+    if (m_Settings.UseGPUExposure)
+    {
+        DEV_CHECK_ERR(m_pAverageLuminanceSRV != nullptr, "Average luminance SRV must be set by SetAverageLuminanceSRV()");
+        m_pToneMappingSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_AverageLuminance")->Set(m_pAverageLuminanceSRV);
+    }
+    if (m_Settings.UseToneMappingLUT)
+    {
+        DEV_CHECK_ERR(m_pToneMappingLUTSRV != nullptr, "Tone mapping LUT must be set by SetToneMappingLUT()");
+        m_pToneMappingSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_ToneMappingLUT")->Set(m_pToneMappingLUTSRV);
     }
+
+    ITextureView* pRTVs[] = {pDstRTV};
+    pCtx->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->SetPipelineState(m_pToneMappingPSO);
+    pCtx->CommitShaderResources(m_pToneMappingSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+    pCtx->Draw(DrawAttrs);
 }
 
 
@@ -577,6 +1184,91 @@ void GLTF_PBR_Renderer::CreateResourceCacheSRB(IRenderDevice*              pDevi
     }
 }
 
+void GLTF_PBR_Renderer::CreateCubemapViews(ITexture* pCubemap, std::vector<RefCntAutoPtr<ITextureView>>& Views, Uint32 FirstArraySlice)
+{
+    // Views are created once, so that updating the cube maps does not allocate any objects.
+    // The compute path writes all faces of a mip level through a single UAV, while
+    // the rasterization path renders every face of every mip level separately.
+    const auto& Desc = pCubemap->GetDesc();
+    for (Uint32 mip = 0; mip < Desc.MipLevels; ++mip)
+    {
+        TextureViewDesc ViewDesc;
+        ViewDesc.TextureDim      = RESOURCE_DIM_TEX_2D_ARRAY;
+        ViewDesc.MostDetailedMip = mip;
+        ViewDesc.NumMipLevels    = 1;
+        if (m_UseComputeToPrecomputeCubemaps)
+        {
+            ViewDesc.Name            = "UAV of a cube map mip level";
+            ViewDesc.ViewType        = TEXTURE_VIEW_UNORDERED_ACCESS;
+            ViewDesc.FirstArraySlice = FirstArraySlice;
+            ViewDesc.NumArraySlices  = 6;
+            ViewDesc.AccessFlags     = UAV_ACCESS_FLAG_WRITE;
+            RefCntAutoPtr<ITextureView> pUAV;
+            pCubemap->CreateView(ViewDesc, &pUAV);
+            Views.emplace_back(std::move(pUAV));
+        }
+        else
+        {
+            ViewDesc.Name     = "RTV of a cube map face";
+            ViewDesc.ViewType = TEXTURE_VIEW_RENDER_TARGET;
+            for (Uint32 face = 0; face < 6; ++face)
+            {
+                ViewDesc.FirstArraySlice = FirstArraySlice + face;
+                ViewDesc.NumArraySlices  = 1;
+                RefCntAutoPtr<ITextureView> pRTV;
+                pCubemap->CreateView(ViewDesc, &pRTV);
+                Views.emplace_back(std::move(pRTV));
+            }
+        }
+    }
+}
+
+namespace
+{
+
+struct CubemapFilterAttribsCS
+{
+    float4x4 FaceRotation[6];
+
+    float Roughness;
+    float EnvMapDim;
+    uint  NumSamples;
+    uint  MipDim;
+
+    uint FirstFace;
+    uint Padding0;
+    uint Padding1;
+    uint Padding2;
+};
+
+struct CubemapFilterAttribsPS
+{
+    float4x4 Rotation;
+
+    float Roughness;
+    float EnvMapDim;
+    uint  NumSamples;
+    float Dummy;
+};
+
+} // namespace
+
+static const std::array<float4x4, 6>& GetCubemapFaceRotations()
+{
+    // clang-format off
+    static const std::array<float4x4, 6> Matrices =
+    {
+/* +X */ float4x4::RotationY(+PI_F / 2.f),
+/* -X */ float4x4::RotationY(-PI_F / 2.f),
+/* +Y */ float4x4::RotationX(-PI_F / 2.f),
+/* -Y */ float4x4::RotationX(+PI_F / 2.f),
+/* +Z */ float4x4::Identity(),
+/* -Z */ float4x4::RotationY(PI_F)
+    };
+    // clang-format on
+    return Matrices;
+}
+
 void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
                                            IDeviceContext* pCtx,
                                            ITextureView*   pEnvironmentMap)
@@ -587,20 +1279,257 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
         return;
     }
 
-    struct PrecomputeEnvMapAttribs
-    {
-        float4x4 Rotation;
+    CreateCubemapFilteringPSOs(pDevice);
 
-        float Roughness;
-        float EnvMapDim;
-        uint  NumSamples;
-        float Dummy;
+    // An update that is in progress would overwrite the result
+    m_CubemapsUpdate = CubemapsUpdateState{};
+
+    for (Uint32 cube = 0; cube < 2; ++cube)
+    {
+        const bool IsIrradianceCube = cube == 0;
+        if (IsIrradianceCube && m_UseSHIrradiance)
+        {
+            ComputeIrradianceSH(pCtx, pEnvironmentMap);
+            CopyIrradianceSH(pCtx);
+            continue;
+        }
+
+        auto*      pCubemap         = IsIrradianceCube ? m_pIrradianceCubeSRV->GetTexture() : m_pPrefilteredEnvMapSRV->GetTexture();
+        const auto NumMips          = pCubemap->GetDesc().MipLevels;
+        for (Uint32 mip = 0; mip < NumMips; ++mip)
+        {
+            FilterCubemapFaces(pCtx, pEnvironmentMap, IsIrradianceCube, pCubemap,
+                               IsIrradianceCube ? m_IrradianceCubeViews : m_PrefilteredEnvMapViews,
+                               mip, 0, 6);
+        }
+    }
+
+    // clang-format off
+    StateTransitionDesc Barriers[] = 
+    {
+        {m_pPrefilteredEnvMapSRV->GetTexture(), RESOURCE_STATE_UNKNOWN,
+            RESOURCE_STATE_SHADER_RESOURCE,
+            STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {m_pIrradianceCubeSRV ? m_pIrradianceCubeSRV->GetTexture() : nullptr,
+            RESOURCE_STATE_UNKNOWN,
+            RESOURCE_STATE_SHADER_RESOURCE,
+            STATE_TRANSITION_FLAG_UPDATE_STATE}
     };
+    // clang-format on
+    pCtx->TransitionResourceStates(m_pIrradianceCubeSRV ? 2 : 1, Barriers);
+
+    // To avoid crashes on some low-end Android devices
+    pCtx->Flush();
+}
+
+
+void GLTF_PBR_Renderer::BeginCubemapsUpdate(IRenderDevice* pDevice,
+                                            ITextureView*  pEnvironmentMap)
+{
+    if (!m_Settings.UseIBL)
+    {
+        LOG_WARNING_MESSAGE("IBL is disabled, so updating cube maps will have no effect");
+        return;
+    }
+
+    CreateCubemapFilteringPSOs(pDevice);
+
+    auto CreateUpdateCubemap = [&](ITexture* pCubemap, const char* Name, RefCntAutoPtr<ITexture>& pUpdateCubemap, std::vector<RefCntAutoPtr<ITextureView>>& Views) //
+    {
+        if (pUpdateCubemap)
+            return;
+
+        auto TexDesc = pCubemap->GetDesc();
+        TexDesc.Name = Name;
+        pDevice->CreateTexture(TexDesc, nullptr, &pUpdateCubemap);
+        CreateCubemapViews(pUpdateCubemap, Views);
+    };
+    // Spherical harmonics are computed into a separate buffer and do not need an update cube map
+    if (!m_UseSHIrradiance)
+    {
+        CreateUpdateCubemap(m_pIrradianceCubeSRV->GetTexture(), "Irradiance cube map update for GLTF renderer",
+                            m_pUpdateIrradianceCube, m_UpdateIrradianceCubeViews);
+    }
+    CreateUpdateCubemap(m_pPrefilteredEnvMapSRV->GetTexture(), "Prefiltered environment map update for GLTF renderer",
+                        m_pUpdatePrefilteredEnvMap, m_UpdatePrefilteredEnvMapViews);
+
+    m_CubemapsUpdate                 = CubemapsUpdateState{};
+    m_CubemapsUpdate.pEnvironmentMap = pEnvironmentMap;
+}
+
+bool GLTF_PBR_Renderer::ProcessCubemapsUpdate(IDeviceContext* pCtx,
+                                              Uint32          MaxFaces)
+{
+    auto& Update = m_CubemapsUpdate;
+    if (!Update.pEnvironmentMap)
+        return false;
+
+    MaxFaces = std::max(MaxFaces, 1u);
+    while (MaxFaces > 0 && Update.Cube < 2)
+    {
+        const bool IsIrradianceCube = Update.Cube == 0;
+        if (IsIrradianceCube && m_UseSHIrradiance)
+        {
+            ComputeIrradianceSH(pCtx, Update.pEnvironmentMap);
+            MaxFaces -= 1;
+            ++Update.Cube;
+            continue;
+        }
+
+        ITexture*  pCubemap         = IsIrradianceCube ? m_pUpdateIrradianceCube.RawPtr() : m_pUpdatePrefilteredEnvMap.RawPtr();
+        const auto NumFaces         = std::min(MaxFaces, 6 - Update.Face);
+        FilterCubemapFaces(pCtx, Update.pEnvironmentMap, IsIrradianceCube, pCubemap,
+                           IsIrradianceCube ? m_UpdateIrradianceCubeViews : m_UpdatePrefilteredEnvMapViews,
+                           Update.Mip, Update.Face, NumFaces);
+
+        MaxFaces -= NumFaces;
+        Update.Face += NumFaces;
+        if (Update.Face == 6)
+        {
+            Update.Face = 0;
+            if (++Update.Mip == pCubemap->GetDesc().MipLevels)
+            {
+                Update.Mip = 0;
+                ++Update.Cube;
+            }
+        }
+    }
+
+    if (Update.Cube < 2)
+        return false;
+
+    // All faces are ready. Copy both cube maps in one go, so that the renderer never
+    // uses irradiance and prefiltered maps that correspond to different environments.
+    // The textures are copied rather than swapped because they are referenced by SRBs.
+    auto CopyCubemap = [pCtx](ITexture* pSrc, ITexture* pDst) //
+    {
+        const auto& Desc = pSrc->GetDesc();
+        for (Uint32 mip = 0; mip < Desc.MipLevels; ++mip)
+        {
+            for (Uint32 face = 0; face < 6; ++face)
+            {
+                CopyTextureAttribs CopyAttribs{pSrc, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pDst, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+                CopyAttribs.SrcMipLevel = mip;
+                CopyAttribs.SrcSlice    = face;
+                CopyAttribs.DstMipLevel = mip;
+                CopyAttribs.DstSlice    = face;
+                pCtx->CopyTexture(CopyAttribs);
+            }
+        }
+    };
+    if (m_UseSHIrradiance)
+        CopyIrradianceSH(pCtx);
+    else
+        CopyCubemap(m_pUpdateIrradianceCube, m_pIrradianceCubeSRV->GetTexture());
+    CopyCubemap(m_pUpdatePrefilteredEnvMap, m_pPrefilteredEnvMapSRV->GetTexture());
+
+    // clang-format off
+    StateTransitionDesc Barriers[] =
+    {
+        {m_pPrefilteredEnvMapSRV->GetTexture(),                                          RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {m_pIrradianceCubeSRV ? m_pIrradianceCubeSRV->GetTexture() : nullptr, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE}
+    };
+    // clang-format on
+    pCtx->TransitionResourceStates(m_pIrradianceCubeSRV ? 2 : 1, Barriers);
 
+    Update = CubemapsUpdateState{};
+    return true;
+}
+
+void GLTF_PBR_Renderer::CreateCubemapFilteringPSOs(IRenderDevice* pDevice)
+{
+    if (m_UseComputeToPrecomputeCubemaps)
+        CreateCubemapFilteringPSOsCS(pDevice);
+    else
+        CreateCubemapFilteringPSOsPS(pDevice);
+}
+
+void GLTF_PBR_Renderer::CreateCubemapFilteringPSOsCS(IRenderDevice* pDevice)
+{
+    if (!m_CubemapFaceAttribsCB)
+    {
+        CreateUniformBuffer(pDevice, sizeof(CubemapFilterAttribsCS), "Cubemap face attribs CB", &m_CubemapFaceAttribsCB);
+    }
+
+    auto CreateComputePSO = [&](const char* FilePath, const char* Name, const char* UAVName, const ShaderMacro* Macros,
+                                RefCntAutoPtr<IPipelineState>& PSO, RefCntAutoPtr<IShaderResourceBinding>& SRB) //
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.UseCombinedTextureSamplers = true;
+        ShaderCI.pShaderSourceStreamFactory = &DiligentFXShaderSourceStreamFactory::GetInstance();
+        ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.Desc.Name                  = Name;
+        ShaderCI.FilePath                   = FilePath;
+        ShaderCI.Macros                     = Macros;
+        auto pCS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PipelineStateDesc&             PSODesc = PSOCreateInfo.PSODesc;
+
+        PSODesc.Name         = Name;
+        PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.pCS    = pCS;
+
+        PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+        // clang-format off
+        ShaderResourceVariableDesc Vars[] = 
+        {
+            {SHADER_TYPE_COMPUTE, "g_EnvironmentMap", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_COMPUTE, UAVName,            SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+        };
+        ImmutableSamplerDesc ImtblSamplers[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_EnvironmentMap", Sam_LinearClamp}
+        };
+        // clang-format on
+        PSODesc.ResourceLayout.NumVariables         = _countof(Vars);
+        PSODesc.ResourceLayout.Variables            = Vars;
+        PSODesc.ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
+        PSODesc.ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &PSO);
+        PSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbCubemapFaceAttribs")->Set(m_CubemapFaceAttribsCB);
+        PSO->CreateShaderResourceBinding(&SRB, true);
+    };
+
+    if (m_UseSHIrradiance && !m_pComputeIrradianceSHPSO)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<Int32>(IrradianceSHThreadGroupSize));
+        Macros.AddShaderMacro("SH_SAMPLE_DIM", static_cast<Int32>(IrradianceCubeDim));
+        CreateComputePSO("ComputeIrradianceSH.csh", "Compute irradiance SH CS", "g_rwIrradianceSH", Macros,
+                         m_pComputeIrradianceSHPSO, m_pComputeIrradianceSHSRB);
+    }
+
+    // Reflection probes always use irradiance cube maps
+    if ((!m_UseSHIrradiance || m_UseReflectionProbes) && !m_pComputeIrradianceCubePSO)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("NUM_PHI_SAMPLES", 64);
+        Macros.AddShaderMacro("NUM_THETA_SAMPLES", 32);
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<Int32>(CubemapCSThreadGroupSize));
+        CreateComputePSO("ComputeIrradianceMap.csh", "Compute irradiance cube CS", "g_rwtex2DIrradianceCube", Macros,
+                         m_pComputeIrradianceCubePSO, m_pComputeIrradianceCubeSRB);
+    }
+
+    if (!m_pComputePrefilteredEnvMapPSO)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("OPTIMIZE_SAMPLES", 1);
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<Int32>(CubemapCSThreadGroupSize));
+        CreateComputePSO("PrefilterEnvMap.csh", "Prefilter environment map CS", "g_rwtex2DPrefilteredEnvMap", Macros,
+                         m_pComputePrefilteredEnvMapPSO, m_pComputePrefilteredEnvMapSRB);
+    }
+}
+
+void GLTF_PBR_Renderer::CreateCubemapFilteringPSOsPS(IRenderDevice* pDevice)
+{
     if (!m_PrecomputeEnvMapAttribsCB)
     {
         CreateUniformBuffer(pDevice,
-            sizeof(PrecomputeEnvMapAttribs),
+            sizeof(CubemapFilterAttribsPS),
             "Precompute env map attribs CB",
             &m_PrecomputeEnvMapAttribsCB);
     }
@@ -622,7 +1551,7 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "main";
             ShaderCI.Desc.Name       = "Cubemap face VS";
             ShaderCI.FilePath        = "CubemapFace.vsh";
-            pDevice->CreateShader(ShaderCI, &pVS);
+            pVS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         // Create pixel shader
@@ -632,7 +1561,7 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "main";
             ShaderCI.Desc.Name       = "Precompute irradiance cube map PS";
             ShaderCI.FilePath        = "ComputeIrradianceMap.psh";
-            pDevice->CreateShader(ShaderCI, &pPS);
+            pPS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         GraphicsPipelineStateCreateInfo PSOCreateInfo;
@@ -702,7 +1631,7 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "main";
             ShaderCI.Desc.Name       = "Cubemap face VS";
             ShaderCI.FilePath        = "CubemapFace.vsh";
-            pDevice->CreateShader(ShaderCI, &pVS);
+            pVS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         // Create pixel shader
@@ -712,7 +1641,7 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
             ShaderCI.EntryPoint      = "main";
             ShaderCI.Desc.Name       = "Prefilter environment map PS";
             ShaderCI.FilePath        = "PrefilterEnvMap.psh";
-            pDevice->CreateShader(ShaderCI, &pPS);
+            pPS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
         }
 
         GraphicsPipelineStateCreateInfo PSOCreateInfo;
@@ -765,123 +1694,403 @@ void GLTF_PBR_Renderer::PrecomputeCubemaps(IRenderDevice*  pDevice,
         m_pPrefilterEnvMapPSO->CreateShaderResourceBinding(
             &m_pPrefilterEnvMapSRB, true);
     }
+}
 
+void GLTF_PBR_Renderer::FilterCubemapFaces(IDeviceContext*                                 pCtx,
+                                           ITextureView*                                   pEnvironmentMap,
+                                           bool                                            IsIrradianceCube,
+                                           ITexture*                                       pCubemap,
+                                           const std::vector<RefCntAutoPtr<ITextureView>>& Views,
+                                           Uint32                                          Mip,
+                                           Uint32                                          FirstFace,
+                                           Uint32                                          NumFaces)
+{
+    VERIFY_EXPR(FirstFace + NumFaces <= 6);
 
-    // clang-format off
-	const std::array<float4x4, 6> Matrices =
+    const auto& CubemapDesc = pCubemap->GetDesc();
+    const auto  MipDim      = std::max(CubemapDesc.Width >> Mip, 1u);
+    const auto& Matrices    = GetCubemapFaceRotations();
+
+    // Mip levels are independent and are filtered directly from the environment map
+    const auto Roughness  = static_cast<float>(Mip) / static_cast<float>(CubemapDesc.MipLevels);
+    const auto EnvMapDim  = static_cast<float>(CubemapDesc.Width);
+    const auto NumSamples = 256u;
+
+    if (m_UseComputeToPrecomputeCubemaps)
     {
-/* +X */ float4x4::RotationY(+PI_F / 2.f),
-/* -X */ float4x4::RotationY(-PI_F / 2.f),
-/* +Y */ float4x4::RotationX(-PI_F / 2.f),
-/* -Y */ float4x4::RotationX(+PI_F / 2.f),
-/* +Z */ float4x4::Identity(),
-/* -Z */ float4x4::RotationY(PI_F)
-	};
-    // clang-format on
+        IPipelineState*         pPSO = IsIrradianceCube ? m_pComputeIrradianceCubePSO.RawPtr() : m_pComputePrefilteredEnvMapPSO.RawPtr();
+        IShaderResourceBinding* pSRB = IsIrradianceCube ? m_pComputeIrradianceCubeSRB.RawPtr() : m_pComputePrefilteredEnvMapSRB.RawPtr();
+        pCtx->SetPipelineState(pPSO);
+        {
+            MapHelper<CubemapFilterAttribsCS> Attribs(pCtx, m_CubemapFaceAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD);
+            for (Uint32 face = 0; face < 6; ++face)
+                Attribs->FaceRotation[face] = Matrices[face];
+            Attribs->Roughness  = Roughness;
+            Attribs->EnvMapDim  = EnvMapDim;
+            Attribs->NumSamples = NumSamples;
+            Attribs->MipDim     = MipDim;
+            Attribs->FirstFace  = FirstFace;
+        }
+        pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_EnvironmentMap")->Set(pEnvironmentMap);
+        pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, IsIrradianceCube ? "g_rwtex2DIrradianceCube" : "g_rwtex2DPrefilteredEnvMap")->Set(Views[Mip]);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 
-    pCtx->SetPipelineState(m_pPrecomputeIrradianceCubePSO);
-    m_pPrecomputeIrradianceCubeSRB->GetVariableByName(SHADER_TYPE_PIXEL,
-        "g_EnvironmentMap")->Set(pEnvironmentMap);
-    pCtx->CommitShaderResources(m_pPrecomputeIrradianceCubeSRB,
-        RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-    auto*       pIrradianceCube    = m_pIrradianceCubeSRV->GetTexture();
-    const auto& IrradianceCubeDesc = pIrradianceCube->GetDesc();
-    for (Uint32 mip = 0; mip < IrradianceCubeDesc.MipLevels; ++mip)
+        const auto             NumGroups = (MipDim + CubemapCSThreadGroupSize - 1) / CubemapCSThreadGroupSize;
+        DispatchComputeAttribs DispatchAttrs{NumGroups, NumGroups, NumFaces};
+        pCtx->DispatchCompute(DispatchAttrs);
+    }
+    else
     {
-        for (Uint32 face = 0; face < 6; ++face)
+        IPipelineState*         pPSO = IsIrradianceCube ? m_pPrecomputeIrradianceCubePSO.RawPtr() : m_pPrefilterEnvMapPSO.RawPtr();
+        IShaderResourceBinding* pSRB = IsIrradianceCube ? m_pPrecomputeIrradianceCubeSRB.RawPtr() : m_pPrefilterEnvMapSRB.RawPtr();
+        pCtx->SetPipelineState(pPSO);
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_EnvironmentMap")->Set(pEnvironmentMap);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        for (Uint32 face = FirstFace; face < FirstFace + NumFaces; ++face)
         {
-            TextureViewDesc RTVDesc{"RTV for irradiance cube texture",
-                TEXTURE_VIEW_RENDER_TARGET, RESOURCE_DIM_TEX_2D_ARRAY};
-            RTVDesc.MostDetailedMip = mip;
-            RTVDesc.FirstArraySlice = face;
-            RTVDesc.NumArraySlices  = 1;
-            RefCntAutoPtr<ITextureView> pRTV;
-            pIrradianceCube->CreateView(RTVDesc, &pRTV);
-            ITextureView* ppRTVs[] = {pRTV};
-            pCtx->SetRenderTargets(
-                _countof(ppRTVs), ppRTVs,
-                nullptr,
-                RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ITextureView* ppRTVs[] = {Views[Mip * 6 + face]};
+            pCtx->SetRenderTargets(_countof(ppRTVs), ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
             {
-                MapHelper<PrecomputeEnvMapAttribs> Attribs(pCtx,
-                    m_PrecomputeEnvMapAttribsCB,
-                    MAP_WRITE,
-                    MAP_FLAG_DISCARD);
-                Attribs->Rotation = Matrices[face];
+                MapHelper<CubemapFilterAttribsPS> Attribs(pCtx, m_PrecomputeEnvMapAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD);
+                Attribs->Rotation   = Matrices[face];
+                Attribs->Roughness  = Roughness;
+                Attribs->EnvMapDim  = EnvMapDim;
+                Attribs->NumSamples = NumSamples;
             }
             DrawAttribs drawAttrs(4, DRAW_FLAG_VERIFY_ALL);
             pCtx->Draw(drawAttrs);
         }
     }
+}
 
-    pCtx->SetPipelineState(m_pPrefilterEnvMapPSO);
-    m_pPrefilterEnvMapSRB->GetVariableByName(SHADER_TYPE_PIXEL,
-        "g_EnvironmentMap")->Set(pEnvironmentMap);
-    pCtx->CommitShaderResources(m_pPrefilterEnvMapSRB,
-        RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-    auto*       pPrefilteredEnvMap    = m_pPrefilteredEnvMapSRV->
-        GetTexture();
-    const auto& PrefilteredEnvMapDesc = pPrefilteredEnvMap->GetDesc();
-    for (Uint32 mip = 0; mip < PrefilteredEnvMapDesc.MipLevels; ++mip)
+void GLTF_PBR_Renderer::ComputeIrradianceSH(IDeviceContext* pCtx,
+                                            ITextureView*   pEnvironmentMap)
+{
+    VERIFY_EXPR(m_UseSHIrradiance);
+
+    pCtx->SetPipelineState(m_pComputeIrradianceSHPSO);
     {
+        const auto&                       Matrices = GetCubemapFaceRotations();
+        MapHelper<CubemapFilterAttribsCS> Attribs(pCtx, m_CubemapFaceAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD);
         for (Uint32 face = 0; face < 6; ++face)
-        {
-            TextureViewDesc RTVDesc{
-                "RTV for prefiltered env map cube texture",
-                TEXTURE_VIEW_RENDER_TARGET,
-                RESOURCE_DIM_TEX_2D_ARRAY};
-            RTVDesc.MostDetailedMip = mip;
-            RTVDesc.FirstArraySlice = face;
-            RTVDesc.NumArraySlices  = 1;
-            RefCntAutoPtr<ITextureView> pRTV;
-            pPrefilteredEnvMap->CreateView(RTVDesc, &pRTV);
-            ITextureView* ppRTVs[] = {pRTV};
-            pCtx->SetRenderTargets(
-                _countof(ppRTVs),
-                ppRTVs,
-                nullptr,
-                RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            Attribs->FaceRotation[face] = Matrices[face];
+        Attribs->EnvMapDim = static_cast<float>(pEnvironmentMap->GetTexture()->GetDesc().Width);
+    }
+    m_pComputeIrradianceSHSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_EnvironmentMap")->Set(pEnvironmentMap);
+    m_pComputeIrradianceSHSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_rwIrradianceSH")->Set(m_pIrradianceSHBuffer->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    pCtx->CommitShaderResources(m_pComputeIrradianceSHSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // The whole reduction is performed by a single thread group
+    DispatchComputeAttribs DispatchAttrs{1, 1, 1};
+    pCtx->DispatchCompute(DispatchAttrs);
+}
+
+void GLTF_PBR_Renderer::CopyIrradianceSH(IDeviceContext* pCtx)
+{
+    pCtx->CopyBuffer(m_pIrradianceSHBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                     m_pIrradianceSHCB, 0, IrradianceSHSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    StateTransitionDesc Barrier{m_pIrradianceSHCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pCtx->TransitionResourceStates(1, &Barrier);
+}
+
+void GLTF_PBR_Renderer::CreateReflectionProbeResources(IRenderDevice*  pDevice,
+                                                       IDeviceContext* pCtx)
+{
+    const auto NumProbes = m_Settings.MaxReflectionProbes;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Reflection probe irradiance cube map array for GLTF renderer";
+    TexDesc.Type      = RESOURCE_DIM_TEX_CUBE_ARRAY;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | (m_UseComputeToPrecomputeCubemaps ? BIND_UNORDERED_ACCESS : BIND_RENDER_TARGET);
+    TexDesc.Width     = ProbeIrradianceDim;
+    TexDesc.Height    = ProbeIrradianceDim;
+    TexDesc.Format    = IrradianceCubeFmt;
+    TexDesc.ArraySize = 6 * NumProbes;
+    // Irradiance is smooth and is sampled in the normal direction, so one mip level is enough
+    TexDesc.MipLevels = 1;
+    RefCntAutoPtr<ITexture> pIrradianceTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pIrradianceTex);
+    m_pProbeIrradianceSRV = pIrradianceTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    TexDesc.Name      = "Reflection probe prefiltered environment map array for GLTF renderer";
+    TexDesc.Width     = ProbePrefilteredDim;
+    TexDesc.Height    = ProbePrefilteredDim;
+    TexDesc.Format    = PrefilteredEnvMapFmt;
+    TexDesc.MipLevels = 0;
+    RefCntAutoPtr<ITexture> pPrefilteredEnvMapTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pPrefilteredEnvMapTex);
+    m_pProbePrefilteredEnvMapSRV = pPrefilteredEnvMapTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    m_ReflectionProbes.resize(NumProbes);
+    for (Uint32 probe = 0; probe < NumProbes; ++probe)
+    {
+        CreateCubemapViews(pIrradianceTex, m_ReflectionProbes[probe].IrradianceViews, probe * 6);
+        CreateCubemapViews(pPrefilteredEnvMapTex, m_ReflectionProbes[probe].PrefilteredEnvMapViews, probe * 6);
+    }
+
+    // The scene is captured into the most detailed level, and the other levels are generated
+    // before filtering to reduce aliasing when the prefiltering shader samples coarser levels.
+    TexDesc.Name      = "Reflection probe capture cube map for GLTF renderer";
+    TexDesc.Type      = RESOURCE_DIM_TEX_CUBE;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+    TexDesc.MiscFlags = MISC_TEXTURE_FLAG_GENERATE_MIPS;
+    TexDesc.Format    = ReflectionProbeCaptureFmt;
+    TexDesc.ArraySize = 6;
+    RefCntAutoPtr<ITexture> pCaptureTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pCaptureTex);
+    m_pProbeCaptureSRV = pCaptureTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    for (Uint32 face = 0; face < 6; ++face)
+    {
+        TextureViewDesc ViewDesc;
+        ViewDesc.Name            = "RTV of a reflection probe capture face";
+        ViewDesc.ViewType        = TEXTURE_VIEW_RENDER_TARGET;
+        ViewDesc.TextureDim      = RESOURCE_DIM_TEX_2D_ARRAY;
+        ViewDesc.MostDetailedMip = 0;
+        ViewDesc.NumMipLevels    = 1;
+        ViewDesc.FirstArraySlice = face;
+        ViewDesc.NumArraySlices  = 1;
+        RefCntAutoPtr<ITextureView> pRTV;
+        pCaptureTex->CreateView(ViewDesc, &pRTV);
+        m_ProbeCaptureRTVs.emplace_back(std::move(pRTV));
+    }
+
+    if (m_Settings.DSVFmt != TEX_FORMAT_UNKNOWN)
+    {
+        TextureDesc DepthDesc;
+        DepthDesc.Name      = "Reflection probe capture depth buffer for GLTF renderer";
+        DepthDesc.Type      = RESOURCE_DIM_TEX_2D;
+        DepthDesc.Usage     = USAGE_DEFAULT;
+        DepthDesc.BindFlags = BIND_DEPTH_STENCIL;
+        DepthDesc.Width     = ProbePrefilteredDim;
+        DepthDesc.Height    = ProbePrefilteredDim;
+        DepthDesc.Format    = m_Settings.DSVFmt;
+        DepthDesc.MipLevels = 1;
+        RefCntAutoPtr<ITexture> pDepthTex;
+        pDevice->CreateTexture(DepthDesc, nullptr, &pDepthTex);
+        m_pProbeCaptureDSV = pDepthTex->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+    }
+
+    // Zero radius disables the probe in the shader until it is captured
+    const std::vector<float4> InitProbes(NumProbes + 1, float4{0, 0, 0, 0});
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Reflection probes CB for GLTF renderer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BuffDesc.Size      = static_cast<Uint64>(InitProbes.size() * sizeof(float4));
+    BufferData InitData{InitProbes.data(), BuffDesc.Size};
+    pDevice->CreateBuffer(BuffDesc, &InitData, &m_pReflectionProbesCB);
+
+    // clang-format off
+    StateTransitionDesc Barriers[] =
+    {
+        {m_pReflectionProbesCB,  RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pIrradianceTex,         RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pPrefilteredEnvMapTex,  RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE}
+    };
+    // clang-format on
+    pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+}
+
+void GLTF_PBR_Renderer::SetReflectionProbe(Uint32 Index, const float3& Position, float Radius)
+{
+    if (Index >= m_ReflectionProbes.size())
+    {
+        DEV_CHECK_ERR(!m_UseReflectionProbes, "Reflection probe index (", Index, ") is out of range");
+        return;
+    }
+
+    auto& Probe       = m_ReflectionProbes[Index];
+    Probe.Position    = Position;
+    Probe.Radius      = std::max(Radius, 0.f);
+    Probe.IsScheduled = Probe.Radius > 0;
+    if (Probe.Radius == 0 && Probe.IsCaptured)
+    {
+        Probe.IsCaptured            = false;
+        m_IsReflectionProbesCBStale = true;
+    }
+
+    // Restart the capture of the probe that has moved
+    if (m_CaptureProbe == Index)
+        m_CaptureProbe = ~0u;
+}
+
+void GLTF_PBR_Renderer::InvalidateReflectionProbe(Uint32 Index)
+{
+    if (Index >= m_ReflectionProbes.size())
+    {
+        DEV_CHECK_ERR(!m_UseReflectionProbes, "Reflection probe index (", Index, ") is out of range");
+        return;
+    }
+
+    auto& Probe       = m_ReflectionProbes[Index];
+    Probe.IsScheduled = Probe.Radius > 0;
+}
+
+IPipelineState* GLTF_PBR_Renderer::GetReflectionProbeCapturePSO()
+{
+    return m_UseReflectionProbes ? GetPSO(PSOKey{GLTF::Material::ALPHA_MODE_OPAQUE, false, true}) : nullptr;
+}
+
+Uint32 GLTF_PBR_Renderer::UpdateReflectionProbes(IRenderDevice*                            pDevice,
+                                                 IDeviceContext*                           pCtx,
+                                                 const float3&                             CameraPos,
+                                                 Uint32                                    MaxFaces,
+                                                 const ReflectionProbeCaptureCallbackType& CaptureFace)
+{
+    if (!m_UseReflectionProbes)
+        return 0;
+
+    CreateCubemapFilteringPSOs(pDevice);
+
+    const bool IsGL = pDevice->GetDeviceInfo().IsGLDevice();
+    const auto Proj = float4x4::Projection(PI_F / 2.f, 1.f, m_Settings.ReflectionProbeNearPlane, m_Settings.ReflectionProbeFarPlane, IsGL);
+
+    // Face cameras follow the same face orientation as GetCubemapFaceRotations()
+    // clang-format off
+    static const std::array<std::pair<float3, float3>, 6> FaceBasis =
+    {{
+        /* +X */ {float3{+1, 0, 0}, float3{0, 1,  0}},
+        /* -X */ {float3{-1, 0, 0}, float3{0, 1,  0}},
+        /* +Y */ {float3{0, +1, 0}, float3{0, 0, -1}},
+        /* -Y */ {float3{0, -1, 0}, float3{0, 0, +1}},
+        /* +Z */ {float3{0, 0, +1}, float3{0, 1,  0}},
+        /* -Z */ {float3{0, 0, -1}, float3{0, 1,  0}}
+    }};
+    // clang-format on
 
+    Uint32 NumCompletedProbes = 0;
+    while (MaxFaces > 0)
+    {
+        if (m_CaptureProbe == ~0u)
+        {
+            // Probes without data go first, then the nearest to the camera
+            for (Uint32 i = 0; i < m_ReflectionProbes.size(); ++i)
             {
-                MapHelper<PrecomputeEnvMapAttribs> Attribs(pCtx,
-                    m_PrecomputeEnvMapAttribsCB,
-                    MAP_WRITE,
-                    MAP_FLAG_DISCARD);
-                Attribs->Rotation   = Matrices[face];
-                Attribs->Roughness  = static_cast<float>(mip) /
-                    static_cast<float>(PrefilteredEnvMapDesc.MipLevels);
-                Attribs->EnvMapDim  = static_cast<float>(PrefilteredEnvMapDesc.Width);
-                Attribs->NumSamples = 256;
+                const auto& Probe = m_ReflectionProbes[i];
+                if (!Probe.IsScheduled)
+                    continue;
+
+                if (m_CaptureProbe == ~0u)
+                {
+                    m_CaptureProbe = i;
+                    continue;
+                }
+
+                const auto& Best = m_ReflectionProbes[m_CaptureProbe];
+                if (Probe.IsCaptured != Best.IsCaptured)
+                {
+                    if (!Probe.IsCaptured)
+                        m_CaptureProbe = i;
+                }
+                else if (length(Probe.Position - CameraPos) < length(Best.Position - CameraPos))
+                {
+                    m_CaptureProbe = i;
+                }
             }
+            if (m_CaptureProbe == ~0u)
+                break;
 
-            DrawAttribs drawAttrs(4, DRAW_FLAG_VERIFY_ALL);
-            pCtx->Draw(drawAttrs);
+            m_CaptureProbeFace = 0;
         }
+
+        auto& Probe = m_ReflectionProbes[m_CaptureProbe];
+
+        ReflectionProbeCaptureInfo CaptureInfo;
+        CaptureInfo.ProbeIndex = m_CaptureProbe;
+        CaptureInfo.Face       = m_CaptureProbeFace;
+        CaptureInfo.Position   = Probe.Position;
+        CaptureInfo.View       = float4x4::Translation(-Probe.Position) *
+            float4x4::ViewFromBasis(cross(FaceBasis[m_CaptureProbeFace].second, FaceBasis[m_CaptureProbeFace].first),
+                                    FaceBasis[m_CaptureProbeFace].second,
+                                    FaceBasis[m_CaptureProbeFace].first);
+        CaptureInfo.Proj       = Proj;
+        CaptureInfo.pRTV       = m_ProbeCaptureRTVs[m_CaptureProbeFace];
+        CaptureInfo.pDSV       = m_pProbeCaptureDSV;
+        CaptureInfo.pPSO       = GetReflectionProbeCapturePSO();
+
+        ITextureView* pRTVs[] = {CaptureInfo.pRTV};
+        pCtx->SetRenderTargets(_countof(pRTVs), pRTVs, CaptureInfo.pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        const float ClearColor[] = {0, 0, 0, 0};
+        pCtx->ClearRenderTarget(CaptureInfo.pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        if (CaptureInfo.pDSV != nullptr)
+            pCtx->ClearDepthStencil(CaptureInfo.pDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        CaptureFace(pCtx, CaptureInfo);
+
+        --MaxFaces;
+        if (++m_CaptureProbeFace < 6)
+            continue;
+
+        FilterReflectionProbe(pCtx, m_CaptureProbe);
+
+        Probe.CapturedPosition = Probe.Position;
+        Probe.CapturedRadius   = Probe.Radius;
+        Probe.IsCaptured       = true;
+        Probe.IsScheduled      = false;
+
+        m_CaptureProbe = ~0u;
+        ++NumCompletedProbes;
     }
 
+    if (NumCompletedProbes > 0 || m_IsReflectionProbesCBStale)
+    {
+        UpdateReflectionProbesCB(pCtx);
+        m_IsReflectionProbesCBStale = false;
+    }
+
+    return NumCompletedProbes;
+}
+
+void GLTF_PBR_Renderer::FilterReflectionProbe(IDeviceContext* pCtx, Uint32 Probe)
+{
+    pCtx->GenerateMips(m_pProbeCaptureSRV);
+
+    auto* pIrradianceTex        = m_pProbeIrradianceSRV->GetTexture();
+    auto* pPrefilteredEnvMapTex = m_pProbePrefilteredEnvMapSRV->GetTexture();
+
+    const auto& ProbeData = m_ReflectionProbes[Probe];
+    for (Uint32 mip = 0; mip < pIrradianceTex->GetDesc().MipLevels; ++mip)
+        FilterCubemapFaces(pCtx, m_pProbeCaptureSRV, true, pIrradianceTex, ProbeData.IrradianceViews, mip, 0, 6);
+    for (Uint32 mip = 0; mip < pPrefilteredEnvMapTex->GetDesc().MipLevels; ++mip)
+        FilterCubemapFaces(pCtx, m_pProbeCaptureSRV, false, pPrefilteredEnvMapTex, ProbeData.PrefilteredEnvMapViews, mip, 0, 6);
+
     // clang-format off
-    StateTransitionDesc Barriers[] = 
+    StateTransitionDesc Barriers[] =
     {
-        {m_pPrefilteredEnvMapSRV->GetTexture(), RESOURCE_STATE_UNKNOWN,
-            RESOURCE_STATE_SHADER_RESOURCE,
-            STATE_TRANSITION_FLAG_UPDATE_STATE},
-        {m_pIrradianceCubeSRV->GetTexture(),
-            RESOURCE_STATE_UNKNOWN,
-            RESOURCE_STATE_SHADER_RESOURCE,
-            STATE_TRANSITION_FLAG_UPDATE_STATE}
+        {pIrradianceTex,        RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pPrefilteredEnvMapTex, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE}
     };
     // clang-format on
     pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+}
 
-    // To avoid crashes on some low-end Android devices
-    pCtx->Flush();
+void GLTF_PBR_Renderer::UpdateReflectionProbesCB(IDeviceContext* pCtx)
+{
+    // Every probe is stored as float4(position, radius), followed by the number of prefiltered mip levels
+    std::vector<float4> Probes(m_ReflectionProbes.size() + 1, float4{0, 0, 0, 0});
+    for (size_t i = 0; i < m_ReflectionProbes.size(); ++i)
+    {
+        const auto& Probe = m_ReflectionProbes[i];
+        if (Probe.IsCaptured)
+            Probes[i] = float4{Probe.CapturedPosition, Probe.CapturedRadius};
+    }
+    Probes.back().x = static_cast<float>(m_pProbePrefilteredEnvMapSRV->GetTexture()->GetDesc().MipLevels);
+
+    pCtx->UpdateBuffer(m_pReflectionProbesCB, 0, static_cast<Uint64>(Probes.size() * sizeof(float4)), Probes.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    StateTransitionDesc Barrier{m_pReflectionProbesCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pCtx->TransitionResourceStates(1, &Barrier);
 }
 
 
 GLTF_PBR_Renderer::ModelResourceBindings GLTF_PBR_Renderer::CreateResourceBindings(
-    GLTF::Model& GLTFModel,
-    IBuffer*     pCameraAttribs,
-    IBuffer*     pLightAttribs)
+    GLTF::Model&    GLTFModel,
+    IBuffer*        pCameraAttribs,
+    IBuffer*        pLightAttribs,
+    IPipelineState* pPSO)
 {
     ModelResourceBindings ResourceBindings;
     ResourceBindings.MaterialSRB.resize(GLTFModel.Materials.size());
@@ -891,7 +2100,7 @@ GLTF_PBR_Renderer::ModelResourceBindings GLTF_PBR_Renderer::CreateResourceBindin
             GLTFModel.Materials[mat],
             pCameraAttribs,
             pLightAttribs,
-            nullptr,
+            pPSO,
             &ResourceBindings.MaterialSRB[mat]);
     }
     return ResourceBindings;
@@ -977,6 +2186,29 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
 
     m_RenderParams = RenderParams;
 
+    Uint32 NumInstances = 1;
+    if (m_MaxViews > 1)
+    {
+        DEV_CHECK_ERR(RenderParams.pViews != nullptr && RenderParams.NumViews > 0,
+                      "The renderer was created for multi-view rendering, so views must be provided");
+        DEV_CHECK_ERR(RenderParams.NumViews <= m_MaxViews, "The number of views (", RenderParams.NumViews,
+                      ") exceeds the maximum number of views (", m_MaxViews, ") the renderer was created with");
+        NumInstances = std::min(RenderParams.NumViews, m_MaxViews);
+        if (RenderParams.pViews == nullptr || NumInstances == 0)
+            return;
+
+        // Every draw call is instanced across the views, and the vertex shader uses
+        // the instance index to select the view and its render target slice or viewport.
+        MapHelper<float4x4> pViewsData{pCtx, m_pViewsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        float4x4* pViewProj  = pViewsData;
+        float4*   pCameraPos = reinterpret_cast<float4*>(pViewProj + m_MaxViews);
+        for (Uint32 i = 0; i < NumInstances; ++i)
+        {
+            pViewProj[i]  = RenderParams.pViews[i].ViewProj.Transpose();
+            pCameraPos[i] = float4{RenderParams.pViews[i].Position, 1};
+        }
+    }
+
     if (pModelBindings != nullptr)
     {
         std::array<IBuffer*, 2> pVBs =
@@ -1031,7 +2263,7 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
 
                 // 根据需要更新和设置当前pso,以及SRB
                 {
-                const PSOKey Key{AlphaMode, material.DoubleSided};
+                const PSOKey Key{AlphaMode, material.DoubleSided, RenderParams.ProbeCapture};
                 if (Key != CurrPSOKey)
                 {
                     CurrPSOKey = Key;
@@ -1046,7 +2278,7 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
                 }
                 else
                 {
-                    VERIFY_EXPR(pCurrPSO == GetPSO(PSOKey{AlphaMode, material.DoubleSided}));
+                    VERIFY_EXPR(pCurrPSO == GetPSO(PSOKey{AlphaMode, material.DoubleSided, RenderParams.ProbeCapture}));
                 }
                 }
 
@@ -1139,6 +2371,7 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
                         DRAW_FLAG_VERIFY_ALL};
                     drawAttrs.FirstIndexLocation = FirstIndexLocation + primitive.FirstIndex;
                     drawAttrs.BaseVertex         = BaseVertex;
+                    drawAttrs.NumInstances       = NumInstances;
                     pCtx->DrawIndexed(drawAttrs);
                 }
                 else
@@ -1146,6 +2379,7 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
                     DrawAttribs drawAttrs{primitive.VertexCount,
                         DRAW_FLAG_VERIFY_ALL};
                     drawAttrs.StartVertexLocation = BaseVertex;
+                    drawAttrs.NumInstances        = NumInstances;
                     pCtx->Draw(drawAttrs);
                 }
             }
@@ -1153,4 +2387,81 @@ void GLTF_PBR_Renderer::Render(IDeviceContext*        pCtx,
     }
 }
 
+void GLTF_PBR_Renderer::AddToRenderGraph(RenderGraph&           Graph,
+                                         ITextureView*          pRTV,
+                                         ITextureView*          pDSV,
+                                         GLTF::Model&           GLTFModel,
+                                         const RenderInfo&      RenderParams,
+                                         ModelResourceBindings* pModelBindings,
+                                         ResourceCacheBindings* pCacheBindings)
+{
+    Graph.AddPass(
+        "GLTF PBR",
+        [&](RenderGraph::PassBuilder& Builder) {
+            if (pRTV != nullptr)
+                Builder.Write(Graph.ImportTexture(pRTV->GetTexture()), RESOURCE_STATE_RENDER_TARGET);
+            if (pDSV != nullptr)
+                Builder.Write(Graph.ImportTexture(pDSV->GetTexture()), RESOURCE_STATE_DEPTH_WRITE);
+
+            if (m_Settings.UseIBL)
+            {
+                for (auto* pSRV : {m_pIrradianceCubeSRV.RawPtr(), m_pPrefilteredEnvMapSRV.RawPtr(), m_pBRDF_LUT_SRV.RawPtr(),
+                                   m_pProbeIrradianceSRV.RawPtr(), m_pProbePrefilteredEnvMapSRV.RawPtr()})
+                {
+                    if (pSRV != nullptr)
+                        Builder.Read(Graph.ImportTexture(pSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+                }
+            }
+
+            if (m_pIrradianceSHCB)
+                Builder.Read(Graph.ImportBuffer(m_pIrradianceSHCB), RESOURCE_STATE_CONSTANT_BUFFER);
+
+            if (m_pReflectionProbesCB)
+                Builder.Read(Graph.ImportBuffer(m_pReflectionProbesCB), RESOURCE_STATE_CONSTANT_BUFFER);
+
+            if (m_Settings.UseGPUExposure && !m_Settings.OutputHDR && m_pAverageLuminanceSRV)
+                Builder.Read(Graph.ImportTexture(m_pAverageLuminanceSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+
+            if (m_Settings.UseToneMappingLUT && !m_Settings.OutputHDR && m_pToneMappingLUTSRV)
+                Builder.Read(Graph.ImportTexture(m_pToneMappingLUTSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+
+            if (pModelBindings != nullptr)
+            {
+                // clang-format off
+                if (auto* pVB0 = GLTFModel.GetBuffer(GLTF::Model::BUFFER_ID_VERTEX_BASIC_ATTRIBS)) Builder.Read(Graph.ImportBuffer(pVB0), RESOURCE_STATE_VERTEX_BUFFER);
+                if (auto* pVB1 = GLTFModel.GetBuffer(GLTF::Model::BUFFER_ID_VERTEX_SKIN_ATTRIBS))  Builder.Read(Graph.ImportBuffer(pVB1), RESOURCE_STATE_VERTEX_BUFFER);
+                if (auto* pIB  = GLTFModel.GetBuffer(GLTF::Model::BUFFER_ID_INDEX))                Builder.Read(Graph.ImportBuffer(pIB),  RESOURCE_STATE_INDEX_BUFFER);
+                // clang-format on
+            }
+        },
+        [this, pRTV, pDSV, &GLTFModel, RenderParams, pModelBindings, pCacheBindings](IDeviceContext* pCtx) {
+            ITextureView* pRTVs[] = {pRTV};
+            pCtx->SetRenderTargets(pRTV != nullptr ? 1 : 0, pRTVs, pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            Render(pCtx, GLTFModel, RenderParams, pModelBindings, pCacheBindings);
+        });
+}
+
+void GLTF_PBR_Renderer::AddToneMappingToRenderGraph(RenderGraph&      Graph,
+                                                    IRenderDevice*    pDevice,
+                                                    ITextureView*     pHDRColorSRV,
+                                                    ITextureView*     pDstRTV,
+                                                    const RenderInfo& RenderParams)
+{
+    Graph.AddPass(
+        "GLTF tone mapping",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Read(Graph.ImportTexture(pHDRColorSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+            Builder.Write(Graph.ImportTexture(pDstRTV->GetTexture()), RESOURCE_STATE_RENDER_TARGET);
+
+            if (m_Settings.UseGPUExposure && m_pAverageLuminanceSRV)
+                Builder.Read(Graph.ImportTexture(m_pAverageLuminanceSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+
+            if (m_Settings.UseToneMappingLUT && m_pToneMappingLUTSRV)
+                Builder.Read(Graph.ImportTexture(m_pToneMappingLUTSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+        },
+        [this, pDevice, pHDRColorSRV, pDstRTV, RenderParams](IDeviceContext* pCtx) {
+            ToneMap(pDevice, pCtx, pHDRColorSRV, pDstRTV, RenderParams);
+        });
+}
+
 } // namespace Diligent
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/Buffer.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/TextureView.h"
+#include "../../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+#include "../../../../DiligentCore/Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+using uint = uint32_t;
+
+#include "Shaders/PostProcess/AutoExposure/public/AutoExposureStructures.fxh"
+
+/// Computes the average scene luminance from a luminance histogram.
+
+/// The first compute pass builds the histogram of the source color buffer using shared memory atomics.
+/// The second pass, executed by a single thread group, excludes the darkest and the brightest pixels
+/// by percentile clipping, averages the log luminance of the remaining pixels and blends the result
+/// with the previous value to simulate eye adaptation.
+/// The average luminance is written to texel (0, 0) of a 1x1 texture that stays on the GPU,
+/// so it can be bound by any effect without a readback, e.g. by GLTF_PBR_Renderer::SetAverageLuminanceSRV().
+/// Requires compute shaders.
+class AutoExposure
+{
+public:
+    /// The number of histogram bins, must match NUM_HISTOGRAM_BINS in AutoExposureCommon.fxh.
+    static constexpr Uint32 NumHistogramBins = 256;
+
+    explicit AutoExposure(IRenderDevice* pDevice);
+
+    /// Updates the average luminance.
+
+    /// \param [in] pDevice      - Render device.
+    /// \param [in] pCtx         - Device context.
+    /// \param [in] pSrcColorSRV - Shader resource view of the HDR color buffer.
+    /// \param [in] Attribs      - Auto exposure attributes.
+    /// \param [in] ElapsedTime  - Time elapsed since the previous update, in seconds.
+    void Compute(IRenderDevice*             pDevice,
+                 IDeviceContext*            pCtx,
+                 ITextureView*              pSrcColorSRV,
+                 const AutoExposureAttribs& Attribs,
+                 float                      ElapsedTime);
+
+    /// Makes the next update skip the adaptation, e.g. after a camera cut.
+    void ResetAdaptation()
+    {
+        m_ResetAdaptation = true;
+    }
+
+    /// Returns the shader resource view of the 1x1 average luminance texture,
+    /// or null if compute shaders are not supported.
+    ITextureView* GetAverageLuminanceSRV() const
+    {
+        return m_pAverageLuminanceSRV;
+    }
+
+private:
+    void CreatePSOs(IRenderDevice* pDevice);
+
+    RefCntAutoPtr<ITextureView>           m_pAverageLuminanceSRV;
+    RefCntAutoPtr<ITextureView>           m_pAverageLuminanceUAV;
+    RefCntAutoPtr<IBuffer>                m_pHistogram;
+    RefCntAutoPtr<IBuffer>                m_pAttribsCB;
+    RefCntAutoPtr<IPipelineState>         m_pHistogramPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pHistogramSRB;
+    RefCntAutoPtr<IPipelineState>         m_pExposurePSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pExposureSRB;
+
+    bool m_ResetAdaptation = true;
+};
+
+} // namespace Diligent
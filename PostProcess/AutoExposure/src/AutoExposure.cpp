@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "AutoExposure.hpp"
+
+#include <vector>
+
+#include "../../../Utilities/include/DiligentFXShaderSourceStreamFactory.hpp"
+#include "../../../Utilities/include/DiligentFXShaderArchive.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Must match cbAutoExposureAttribs in AutoExposureCommon.fxh
+struct AutoExposureCBData
+{
+    AutoExposureAttribs Attribs;
+
+    Uint32 SrcWidth;
+    Uint32 SrcHeight;
+    float  ElapsedTime;
+    Uint32 ResetAdaptation;
+};
+static_assert(sizeof(AutoExposureCBData) % 16 == 0, "sizeof(AutoExposureCBData) is not multiple of 16");
+
+// Must match HISTOGRAM_GROUP_SIZE in AutoExposureCommon.fxh
+static constexpr Uint32 HistogramGroupSize = 16;
+static_assert(HistogramGroupSize * HistogramGroupSize == AutoExposure::NumHistogramBins,
+              "Every thread of the histogram group must handle one bin");
+
+} // namespace
+
+AutoExposure::AutoExposure(IRenderDevice* pDevice)
+{
+    if (pDevice->GetDeviceInfo().Features.ComputeShaders == DEVICE_FEATURE_STATE_DISABLED)
+    {
+        LOG_WARNING_MESSAGE("Histogram-based auto exposure requires compute shaders");
+        return;
+    }
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Average luminance";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+    TexDesc.Width     = 1;
+    TexDesc.Height    = 1;
+    TexDesc.Format    = TEX_FORMAT_R32_FLOAT;
+    TexDesc.MipLevels = 1;
+
+    RefCntAutoPtr<ITexture> pAverageLuminance;
+    pDevice->CreateTexture(TexDesc, nullptr, &pAverageLuminance);
+    m_pAverageLuminanceSRV = pAverageLuminance->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_pAverageLuminanceUAV = pAverageLuminance->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+
+    // The histogram is cleared by the exposure pass after it is read, so it only needs to be
+    // initialized once.
+    std::vector<Uint32> ZeroHistogram(NumHistogramBins);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = "Luminance histogram";
+    BuffDesc.Usage             = USAGE_DEFAULT;
+    BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+    BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+    BuffDesc.ElementByteStride = sizeof(Uint32);
+    BuffDesc.Size              = sizeof(Uint32) * NumHistogramBins;
+    BufferData InitData{ZeroHistogram.data(), BuffDesc.Size};
+    pDevice->CreateBuffer(BuffDesc, &InitData, &m_pHistogram);
+
+    CreateUniformBuffer(pDevice, sizeof(AutoExposureCBData), "Auto exposure attribs CB", &m_pAttribsCB);
+}
+
+void AutoExposure::CreatePSOs(IRenderDevice* pDevice)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.pShaderSourceStreamFactory = &DiligentFXShaderSourceStreamFactory::GetInstance();
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.EntryPoint                 = "main";
+
+    {
+        ShaderCI.Desc.Name = "Compute luminance histogram CS";
+        ShaderCI.FilePath  = "ComputeLuminanceHistogram.csh";
+        auto pCS           = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PipelineStateDesc&             PSODesc = PSOCreateInfo.PSODesc;
+
+        PSODesc.Name         = "Compute luminance histogram PSO";
+        PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.pCS    = pCS;
+
+        PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+        // clang-format off
+        ShaderResourceVariableDesc Vars[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_tex2DColor", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+        };
+        // clang-format on
+        PSODesc.ResourceLayout.NumVariables = _countof(Vars);
+        PSODesc.ResourceLayout.Variables    = Vars;
+
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &m_pHistogramPSO);
+        m_pHistogramPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbAutoExposureAttribs")->Set(m_pAttribsCB);
+        m_pHistogramPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "g_rwHistogram")->Set(m_pHistogram->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        m_pHistogramPSO->CreateShaderResourceBinding(&m_pHistogramSRB, true);
+    }
+
+    {
+        ShaderCI.Desc.Name = "Compute exposure CS";
+        ShaderCI.FilePath  = "ComputeExposure.csh";
+        auto pCS           = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PipelineStateDesc&             PSODesc = PSOCreateInfo.PSODesc;
+
+        PSODesc.Name         = "Compute exposure PSO";
+        PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.pCS    = pCS;
+
+        PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &m_pExposurePSO);
+        m_pExposurePSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbAutoExposureAttribs")->Set(m_pAttribsCB);
+        m_pExposurePSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "g_rwHistogram")->Set(m_pHistogram->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        m_pExposurePSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "g_rwtex2DAverageLuminance")->Set(m_pAverageLuminanceUAV);
+        m_pExposurePSO->CreateShaderResourceBinding(&m_pExposureSRB, true);
+    }
+}
+
+void AutoExposure::Compute(IRenderDevice*             pDevice,
+                           IDeviceContext*            pCtx,
+                           ITextureView*              pSrcColorSRV,
+                           const AutoExposureAttribs& Attribs,
+                           float                      ElapsedTime)
+{
+    if (!m_pAverageLuminanceSRV)
+        return;
+
+    DEV_CHECK_ERR(pSrcColorSRV != nullptr, "Source color SRV must not be null");
+    DEV_CHECK_ERR(Attribs.fMaxLogLuminance > Attribs.fMinLogLuminance, "Histogram luminance range must not be empty");
+
+    if (!m_pHistogramPSO)
+        CreatePSOs(pDevice);
+
+    const auto& SrcTexDesc = pSrcColorSRV->GetTexture()->GetDesc();
+    {
+        MapHelper<AutoExposureCBData> CBData{pCtx, m_pAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        CBData->Attribs         = Attribs;
+        CBData->SrcWidth        = SrcTexDesc.Width;
+        CBData->SrcHeight       = SrcTexDesc.Height;
+        CBData->ElapsedTime     = ElapsedTime;
+        CBData->ResetAdaptation = m_ResetAdaptation ? 1 : 0;
+    }
+
+    m_pHistogramSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex2DColor")->Set(pSrcColorSRV);
+
+    pCtx->SetPipelineState(m_pHistogramPSO);
+    pCtx->CommitShaderResources(m_pHistogramSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    DispatchComputeAttribs HistogramDispatchAttribs{(SrcTexDesc.Width + HistogramGroupSize - 1) / HistogramGroupSize,
+                                                    (SrcTexDesc.Height + HistogramGroupSize - 1) / HistogramGroupSize};
+    pCtx->DispatchCompute(HistogramDispatchAttribs);
+
+    // The exposure is computed by a single thread group
+    pCtx->SetPipelineState(m_pExposurePSO);
+    pCtx->CommitShaderResources(m_pExposureSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+
+    StateTransitionDesc Barrier{m_pAverageLuminanceSRV->GetTexture(), RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pCtx->TransitionResourceStates(1, &Barrier);
+
+    m_ResetAdaptation = false;
+}
+
+} // namespace Diligent
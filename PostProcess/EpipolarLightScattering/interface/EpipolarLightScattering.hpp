@@ -26,6 +26,10 @@
  */
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <memory>
+
 #include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
 #include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
 #include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/Buffer.h"
@@ -33,6 +37,7 @@
 #include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/BufferView.h"
 #include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/TextureView.h"
 #include "../../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+#include "../../../../DiligentCore/Common/interface/ObjectBase.hpp"
 #include "../../../../DiligentCore/Common/interface/BasicMath.hpp"
 
 namespace Diligent
@@ -44,6 +49,9 @@ using uint = uint32_t;
 #include "Shaders/PostProcess/ToneMapping/public/ToneMappingStructures.fxh"
 #include "Shaders/PostProcess/EpipolarLightScattering/public/EpipolarLightScatteringStructures.fxh"
 
+class TransientTexturePool;
+class RenderGraph;
+class AtmosphereLUTs;
 
 class EpipolarLightScattering
 {
@@ -74,8 +82,26 @@ public:
         /// Depth-stencil view of the destination depth buffer where final image will be rendered.
         ITextureView* ptex2DDstDepthBufferDSV = nullptr;
 
+        /// Optional unordered access view of the destination color buffer.
+        /// If provided and the device supports compute shaders, epipolar sampling unwarps inscattering,
+        /// corrects it at depth breaks and performs tone mapping in a single compute pass.
+        /// The view must not be an sRGB view since the output is written without conversion.
+        ITextureView* ptex2DDstColorBufferUAV = nullptr;
+
+        /// Optional tone mapping lookup table built by ToneMappingLUT.
+        /// If provided, tone mapping and color grading are performed with a single fetch from the table
+        /// instead of evaluating the tone mapping curve. The view must have a sampler assigned
+        /// (see ToneMappingLUT::GetSRV()).
+        ITextureView* ptex3DToneMappingLUTSRV = nullptr;
+
         /// Shadow map shader resource view
         ITextureView* ptex2DShadowMapSRV = nullptr;
+
+        /// Pool that provides intermediate textures which are only needed during a part of the frame
+        /// (coordinate texture, epipolar camera-space z and depth-stencil, slice end points,
+        /// initial scattered light and min/max shadow maps). Sharing one pool between several effects
+        /// allows them to reuse the same textures. If this parameter is null, the effect will use its own pool.
+        TransientTexturePool* pTransientTexturePool = nullptr;
     };
 
     EpipolarLightScattering(IRenderDevice*              in_pDevice,
@@ -84,6 +110,16 @@ public:
                             TEXTURE_FORMAT              DepthBufferFmt,
                             TEXTURE_FORMAT              OffscreenBackBuffer,
                             const AirScatteringAttribs& ScatteringAttibs = AirScatteringAttribs{});
+
+    /// Creates the effect that uses precomputed atmosphere resources shared with other instances.
+    /// The effect keeps a strong reference to pAtmosphereLUTs.
+    EpipolarLightScattering(IRenderDevice*  in_pDevice,
+                            IDeviceContext* in_pContext,
+                            TEXTURE_FORMAT  BackBufferFmt,
+                            TEXTURE_FORMAT  DepthBufferFmt,
+                            TEXTURE_FORMAT  OffscreenBackBuffer,
+                            AtmosphereLUTs* pAtmosphereLUTs);
+
     ~EpipolarLightScattering();
 
 
@@ -106,12 +142,79 @@ public:
 
     void PerformPostProcessing();
 
+    /// Pre-builds shaders and pipeline states required to render the effect with every
+    /// set of attributes in pAttribs, so that switching to these settings later reuses
+    /// the cached variants instead of compiling them in the frame.
+    /// The method performs post-processing once for every set of attributes, so it should be
+    /// called at load time. The contents of the destination buffers are undefined afterwards.
+    void WarmUp(FrameAttribs&                         FrameAttribs,
+                const EpipolarLightScatteringAttribs* pAttribs,
+                Uint32                                NumAttribs);
 
-    IBuffer*      GetMediaAttribsCB() { return m_pcbMediaAttribs; }
-    ITextureView* GetPrecomputedNetDensitySRV() { return m_ptex2DOccludedNetDensityToAtmTopSRV; }
+
+    /// Adds the post-processing pass to the render graph. The pass reads the source color, depth
+    /// and shadow map and writes the destination buffers; it calls PrepareForNewFrame() and
+    /// PerformPostProcessing() when the graph is executed. Light and camera attributes referenced
+    /// by FrameAttribs must stay valid until then. If FrameAttribs::pTransientTexturePool is null,
+    /// the effect allocates its transient textures from the graph's pool.
+    void AddToRenderGraph(RenderGraph&                          Graph,
+                          const FrameAttribs&                   FrameAttribs,
+                          const EpipolarLightScatteringAttribs& PPAttribs);
+
+
+    /// Error of the low-precision intermediates relative to the full-precision ones.
+    struct LowPrecisionErrorStats
+    {
+        /// Maximum absolute difference of a color component, in [0, 1] for normalized formats.
+        float MaxError = 0;
+
+        /// Mean absolute difference of color components.
+        float MeanError = 0;
+
+        /// Peak signal-to-noise ratio, in dB. Infinite if the images are identical.
+        float PSNR = 0;
+
+        /// Fraction of pixels that differ.
+        float DifferentPixelsFraction = 0;
+    };
+
+    /// Renders the frame twice, with bUseLowPrecisionIntermediates set to FALSE and to TRUE,
+    /// into internal targets and compares the results on the CPU.
+    /// The method waits for the GPU to become idle and is only intended to quantify the quality
+    /// cost of the low-precision formats. Invalid epipolar samples remain invalid in all formats,
+    /// so the measured error is the rounding error only.
+    /// The destination buffers in FrameAttribs are not written.
+    /// Only 8-bit normalized and 32-bit float destination formats are supported.
+    bool MeasureLowPrecisionError(FrameAttribs&                         FrameAttribs,
+                                  const EpipolarLightScatteringAttribs& PPAttribs,
+                                  LowPrecisionErrorStats&               Stats);
+
+
+    /// Renders the sky radiance as seen from the camera position into a low-resolution HDR cube map
+    /// and returns its shader resource view. The sun disk is not included.
+    /// The cube map has a full mip chain and can be used as the environment map by
+    /// GLTF_PBR_Renderer::PrecomputeCubemaps() or GLTF_PBR_Renderer::BeginCubemapsUpdate().
+    /// The method must be called after PrepareForNewFrame() and requires compute shaders; it returns
+    /// null otherwise. The same cube map is overwritten every time the method is called.
+    ITextureView* RenderSkyCubemap();
+
+    IBuffer*      GetMediaAttribsCB();
+    ITextureView* GetPrecomputedNetDensitySRV();
     ITextureView* GetAmbientSkyLightSRV(IRenderDevice* pDevice, IDeviceContext* pContext);
 
+    /// Returns the 1x1 texture whose first component contains the adapted average scene luminance
+    /// computed by the effect when auto exposure is enabled. The texture can be bound to other shaders
+    /// (e.g. GLTF_PBR_Renderer created with UseGPUExposure) to keep exposure on the GPU without a readback.
+    /// The texture is created on first request (which sets render targets in pContext) and never changes afterwards.
+    ITextureView* GetAverageLuminanceSRV(IRenderDevice* pDevice, IDeviceContext* pContext);
+
+    /// Returns the precomputed atmosphere resources used by the effect. The object
+    /// can be passed to other instances to share the resources between them.
+    AtmosphereLUTs* GetAtmosphereLUTs() { return m_pAtmosphereLUTs; }
+
 private:
+    friend class AtmosphereLUTs;
+
     void ReconstructCameraSpaceZ();
     void RenderSliceEndpoints();
     void RenderCoordinateTexture();
@@ -120,9 +223,12 @@ private:
     void MarkRayMarchingSamples();
     void RenderSliceUVDirAndOrig();
     void Build1DMinMaxMipMap(int iCascadeIndex);
+    void Build1DMinMaxMipMapCS(int iCascadeIndex);
     void DoRayMarching(Uint32 uiMaxStepsAlongRay, int iCascadeIndex);
+    void RayMarchCompactedSamples(Uint32 uiMaxStepsAlongRay, int iCascadeIndex);
     void InterpolateInsctrIrradiance();
     void UnwarpEpipolarScattering(bool bRenderLuminance);
+    void UnwarpAndFixInscatteringCS();
     void UpdateAverageLuminance();
     enum class EFixInscatteringMode
     {
@@ -131,28 +237,38 @@ private:
         FullScreenRayMarching = 2
     };
     void FixInscatteringAtDepthBreaks(Uint32 uiMaxStepsAlongRay, EFixInscatteringMode Mode);
+    void RayMarchDownscaled(Uint32 uiMaxStepsAlongRay);
+    void UpsampleInscattering(bool bRenderLuminance);
+    void InjectFroxelInscattering();
+    void IntegrateFroxelInscattering();
+    void ApplyFroxelInscattering(bool bRenderLuminance);
+    void ComputeSkyViewAndAerialPerspectiveLUTs();
+    void UpdateAtmosphereLUTs();
     void RenderSampleLocations();
 
-    void PrecomputeOpticalDepthTexture(IRenderDevice* pDevice, IDeviceContext* pContext);
-    void PrecomputeScatteringLUT(IRenderDevice* pDevice, IDeviceContext* pContext);
-    void CreateRandomSphereSamplingTexture(IRenderDevice* pDevice);
-    void ComputeAmbientSkyLightTexture(IRenderDevice* pDevice, IDeviceContext* pContext);
-    void ComputeScatteringCoefficients(IDeviceContext* pDeviceCtx = nullptr);
+    void BindAtmosphereLUTs();
     void CreateEpipolarTextures(IRenderDevice* pDevice);
-    void CreateSliceEndPointsTexture(IRenderDevice* pDevice);
     void CreateExtinctionTexture(IRenderDevice* pDevice);
-    void CreateAmbientSkyLightTexture(IRenderDevice* pDevice);
     void CreateLowResLuminanceTexture(IRenderDevice* pDevice, IDeviceContext* pDeviceCtx);
     void CreateSliceUVDirAndOriginTexture(IRenderDevice* pDevice);
     void CreateCamSpaceZTexture(IRenderDevice* pDevice);
-    void CreateMinMaxShadowMap(IRenderDevice* pDevice);
+    void CreateDownscaledInsctrTextures(IRenderDevice* pDevice);
+    void CreateFroxelTextures(IRenderDevice* pDevice);
+    void UpdateFroxelGridAttribs();
+    void CreateSkyViewAndAerialPerspectiveTextures(IRenderDevice* pDevice);
+    void CreateSkyCubemap(IRenderDevice* pDevice);
+    void CreateRayMarchingSampleListBuffers(IRenderDevice* pDevice);
+    void AcquireSliceEndPointsTexture();
+    void AcquireCoordinateTextures();
+    void AcquireInitialScatteredLightTexture();
+    void AcquireMinMaxShadowMap();
+    void ReleaseMinMaxShadowMap();
 
     void DefineMacros(class ShaderMacroHelper& Macros);
 
     const TEXTURE_FORMAT m_BackBufferFmt;
     const TEXTURE_FORMAT m_DepthBufferFmt;
 
-    static constexpr TEXTURE_FORMAT PrecomputedNetDensityTexFmt = TEX_FORMAT_RG32_FLOAT;
     static constexpr TEXTURE_FORMAT CoordinateTexFmt            = TEX_FORMAT_RG32_FLOAT;
     static constexpr TEXTURE_FORMAT SliceEndpointsFmt           = TEX_FORMAT_RGBA32_FLOAT;
     static constexpr TEXTURE_FORMAT InterpolationSourceTexFmt   = TEX_FORMAT_RGBA32_UINT;
@@ -161,11 +277,33 @@ private:
     static constexpr TEXTURE_FORMAT EpipolarImageDepthFmt0      = TEX_FORMAT_D24_UNORM_S8_UINT;
     static constexpr TEXTURE_FORMAT EpipolarImageDepthFmt1      = TEX_FORMAT_D32_FLOAT_S8X24_UINT;
     static constexpr TEXTURE_FORMAT EpipolarExtinctionFmt       = TEX_FORMAT_RGBA8_UNORM;
-    static constexpr TEXTURE_FORMAT AmbientSkyLightTexFmt       = TEX_FORMAT_RGBA16_FLOAT;
     static constexpr TEXTURE_FORMAT WeightedLogLumTexFmt        = TEX_FORMAT_RG16_FLOAT;
     static constexpr TEXTURE_FORMAT AverageLuminanceTexFmt      = TEX_FORMAT_R16_FLOAT;
     static constexpr TEXTURE_FORMAT SliceUVDirAndOriginTexFmt   = TEX_FORMAT_RGBA32_FLOAT;
     static constexpr TEXTURE_FORMAT CamSpaceZFmt                = TEX_FORMAT_R32_FLOAT;
+    static constexpr TEXTURE_FORMAT DownscaledInsctrTexFmt      = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT DownscaledCamSpaceZFmt      = TEX_FORMAT_R32_FLOAT;
+    static constexpr TEXTURE_FORMAT FroxelInsctrTexFmt          = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT SkyViewInsctrTexFmt         = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT SkyViewExtinctionTexFmt     = TEX_FORMAT_RGBA8_UNORM;
+    static constexpr TEXTURE_FORMAT AerialPerspectiveInsctrTexFmt     = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT AerialPerspectiveExtinctionTexFmt = TEX_FORMAT_RGBA8_UNORM;
+    static constexpr TEXTURE_FORMAT SkyCubemapFmt               = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT MinMaxShadowMap16BitFmt     = TEX_FORMAT_RG16_UNORM;
+    static constexpr TEXTURE_FORMAT MinMaxShadowMap32BitFmt     = TEX_FORMAT_RG32_FLOAT;
+
+    // Formats used when EpipolarLightScatteringAttribs::bUseLowPrecisionIntermediates is TRUE.
+    // Coordinates must use a float format: invalid samples are marked with -1e+30, which a normalized
+    // format would clamp to -1, i.e. to a valid screen corner. Half float turns it into -inf instead.
+    static constexpr TEXTURE_FORMAT CoordinateTexLowPrecFmt       = TEX_FORMAT_RG16_FLOAT;
+    static constexpr TEXTURE_FORMAT SliceEndpointsLowPrecFmt      = TEX_FORMAT_RGBA16_FLOAT;
+    static constexpr TEXTURE_FORMAT SliceUVDirAndOriginLowPrecFmt = TEX_FORMAT_RGBA16_FLOAT;
+    // Note that epipolar camera space z is always 32-bit: the far plane distance may exceed
+    // the half float range, and sky pixels are detected by comparing z with the far plane.
+
+    TEXTURE_FORMAT m_CoordinateTexFmt          = CoordinateTexFmt;
+    TEXTURE_FORMAT m_SliceEndpointsFmt         = SliceEndpointsFmt;
+    TEXTURE_FORMAT m_SliceUVDirAndOriginTexFmt = SliceUVDirAndOriginTexFmt;
 
 
     EpipolarLightScatteringAttribs m_PostProcessingAttribs;
@@ -178,37 +316,50 @@ private:
         Int32 SrcColorBufferSRV = -1;
         Int32 SrcDepthBufferSRV = -1;
         Int32 ShadowMapSRV      = -1;
+        Int32 DstColorBufferUAV = -1;
+        Int32 ToneMappingLUTSRV = -1;
     } m_UserResourceIds;
 
     bool   m_bUseCombinedMinMaxTexture;
+    bool   m_bCompactRayMarchingSamples;
+    // Whether sky-view and aerial perspective tables are used. Requires compute shaders.
+    bool   m_bUseSkyViewAndAerialPerspectiveLUTs = false;
+    bool   m_bBuildMinMaxTreeInCS;
+    // Whether sample refinement uses wave intrinsics. This is determined by the device capabilities.
+    bool   m_bUseWaveOpsInSampleRefinement;
+    bool   m_bUnwarpAndFixInscatteringInCS;
+    bool   m_bUseToneMappingLUT = false;
     Uint32 m_uiSampleRefinementCSThreadGroupSize;
     Uint32 m_uiSampleRefinementCSMinimumThreadGroupSize;
 
-    static const int sm_iNumPrecomputedHeights = 1024;
-    static const int sm_iNumPrecomputedAngles  = 1024;
-
-    int m_iPrecomputedSctrUDim = 32;
-    int m_iPrecomputedSctrVDim = 128;
-    int m_iPrecomputedSctrWDim = 64;
-    int m_iPrecomputedSctrQDim = 16;
+    static constexpr Uint32 sm_uiRayMarchCSThreadGroupSize = 64;
+    static constexpr Uint32 sm_uiUnwarpCSThreadGroupSize   = 8;
+    static constexpr Uint32 sm_uiFroxelCSThreadGroupSize   = 8;
+    static constexpr Uint32 sm_uiSkyViewLUTWidth           = 192;
+    static constexpr Uint32 sm_uiSkyViewLUTHeight          = 108;
+    static constexpr Uint32 sm_uiSkyViewAndAPCSThreadGroupSize = 8;
+    static constexpr Uint32 sm_uiSkyCubemapDim                 = 64;
 
-    RefCntAutoPtr<ITextureView> m_ptex3DSingleScatteringSRV;
-    RefCntAutoPtr<ITextureView> m_ptex3DHighOrderScatteringSRV;
-    RefCntAutoPtr<ITextureView> m_ptex3DMultipleScatteringSRV;
+    static constexpr Uint32 sm_uiMinMaxTreeCSThreadGroupSize = 256;
+    // The tree levels are kept in group shared memory, which limits the resolution
+    static constexpr Uint32 sm_uiMaxMinMaxTreeCSResolution = 4096;
 
-    Uint32                      m_uiNumRandomSamplesOnSphere = 128;
-    RefCntAutoPtr<ITextureView> m_ptex2DSphereRandomSamplingSRV;
+    RefCntAutoPtr<AtmosphereLUTs> m_pAtmosphereLUTs;
 
     static const int            sm_iLowResLuminanceMips = 7; // 64x64
     RefCntAutoPtr<ITextureView> m_ptex2DLowResLuminanceRTV;  // 64 X 64 R16F
     RefCntAutoPtr<ITextureView> m_ptex2DLowResLuminanceSRV;
     RefCntAutoPtr<ITextureView> m_ptex2DAverageLuminanceRTV; // 1  X  1 R16F
 
-    static const int            sm_iAmbientSkyLightTexDim = 1024;
-    RefCntAutoPtr<ITextureView> m_ptex2DAmbientSkyLightSRV; // 1024 x 1 RGBA16F
-    RefCntAutoPtr<ITextureView> m_ptex2DAmbientSkyLightRTV;
-    RefCntAutoPtr<ITextureView> m_ptex2DOccludedNetDensityToAtmTopSRV; // 1024 x 1024 RG32F
-    RefCntAutoPtr<ITextureView> m_ptex2DOccludedNetDensityToAtmTopRTV;
+    RefCntAutoPtr<IShader> CreateShader(IRenderDevice*     pDevice,
+                                        const Char*        FileName,
+                                        const Char*        EntryPoint,
+                                        SHADER_TYPE        Type,
+                                        const ShaderMacro* Macros   = nullptr,
+                                        SHADER_COMPILER    Compiler = SHADER_COMPILER_DEFAULT);
+
+    // Shader variants keyed by the source file, entry point and full set of macros
+    std::unordered_map<std::string, RefCntAutoPtr<IShader>> m_ShaderCache;
 
     RefCntAutoPtr<IShader> m_pFullScreenTriangleVS;
 
@@ -223,11 +374,33 @@ private:
     RefCntAutoPtr<ITextureView> m_ptex2DInitialScatteredLightRTV; // Max Samples X Num Slices   RGBA16F
     RefCntAutoPtr<ITextureView> m_ptex2DSliceUVDirAndOriginRTV;   // Num Slices  X Num Cascaes  RGBA32F
     RefCntAutoPtr<ITextureView> m_ptex2DCamSpaceZRTV;             // BckBfrWdth  x BckBfrHght   R32F
+    RefCntAutoPtr<ITextureView> m_ptex2DDownscaledInsctrRTV;      // BckBfrWdth/DownscaleFactor x BckBfrHght/DownscaleFactor  RGBA16F
+    RefCntAutoPtr<ITextureView> m_ptex2DDownscaledCamSpaceZRTV;   // BckBfrWdth/DownscaleFactor x BckBfrHght/DownscaleFactor  R32F
     RefCntAutoPtr<ITextureView> m_ptex2DMinMaxShadowMapSRV[2];    // MinMaxSMRes x Num Slices   RG32F or RG16UNORM
     RefCntAutoPtr<ITextureView> m_ptex2DMinMaxShadowMapRTV[2];
+    RefCntAutoPtr<ITextureView> m_ptex3DFroxelInsctrUAV[2];       // GridWidth x GridHeight x GridDepth  RGBA16F (current and history)
+    RefCntAutoPtr<ITextureView> m_ptex3DFroxelIntegratedInsctrUAV;// GridWidth x GridHeight x GridDepth  RGBA16F
+    RefCntAutoPtr<ITextureView> m_ptex2DSkyViewInsctrUAV;               // SkyViewLUTWidth x SkyViewLUTHeight  RGBA16F
+    RefCntAutoPtr<ITextureView> m_ptex2DSkyViewExtinctionUAV;           // SkyViewLUTWidth x SkyViewLUTHeight  RGBA8_UNORM
+    RefCntAutoPtr<ITextureView> m_ptex3DAerialPerspectiveInsctrUAV;     // APLUTResolution x APLUTResolution x APLUTDepth  RGBA16F
+    RefCntAutoPtr<ITextureView> m_ptex3DAerialPerspectiveExtinctionUAV; // APLUTResolution x APLUTResolution x APLUTDepth  RGBA8_UNORM
+    RefCntAutoPtr<ITextureView> m_ptex2DSkyCubemapUAV;                  // SkyCubemapDim x SkyCubemapDim x 6, mip 0  RGBA16F
+
+    // Froxel grid state of the previous frame used by the temporal reprojection
+    float4x4 m_mPrevViewProjT;
+    float4   m_f4PrevCameraPos;
+    float4   m_f4PrevFroxelGridDepthParams;
+    bool     m_bFroxelHistoryValid = false;
+    Uint32   m_uiFroxelFrameIndex  = 0;
+
+    RefCntAutoPtr<IBuffer> m_pbufRayMarchingSampleList;    // Max Samples * Num Slices   uint
+    RefCntAutoPtr<IBuffer> m_pbufRayMarchingSampleCounter; // 1                          uint
+    RefCntAutoPtr<IBuffer> m_pbufRayMarchingDispatchArgs;  // 3                          uint
 
     RefCntAutoPtr<ISampler> m_pPointClampSampler, m_pLinearClampSampler;
 
+    std::unique_ptr<TransientTexturePool> m_pTransientTexturePool;
+
     struct RenderTechnique
     {
         RefCntAutoPtr<IPipelineState>         PSO;
@@ -235,6 +408,10 @@ private:
         Uint32                                PSODependencyFlags = 0;
         Uint32                                SRBDependencyFlags = 0;
 
+        // All pipeline state variants created by this technique. Stale pipeline states are
+        // kept in the cache, so switching back to earlier settings does not create them again.
+        std::unordered_map<std::string, RefCntAutoPtr<IPipelineState>> PSOCache;
+
         void InitializeFullScreenTriangleTechnique(IRenderDevice*                    pDevice,
                                                    const char*                       PSOName,
                                                    IShader*                          VertexShader,
@@ -267,6 +444,8 @@ private:
 
         void DispatchCompute(IDeviceContext* pDeviceContext, const DispatchComputeAttribs& DispatchAttrs);
 
+        void DispatchComputeIndirect(IDeviceContext* pDeviceContext, IBuffer* pAttribsBuffer);
+
         void CheckStaleFlags(Uint32 StalePSODependencies, Uint32 StaleSRBDependencies);
     };
 
@@ -281,28 +460,33 @@ private:
         RENDER_TECH_RENDER_SLICE_UV_DIRECTION,
         RENDER_TECH_INIT_MIN_MAX_SHADOW_MAP,
         RENDER_TECH_COMPUTE_MIN_MAX_SHADOW_MAP_LEVEL,
+        RENDER_TECH_BUILD_MIN_MAX_SHADOW_MAP,
         RENDER_TECH_RAY_MARCH_NO_MIN_MAX_OPT,
         RENDER_TECH_RAY_MARCH_MIN_MAX_OPT,
+        RENDER_TECH_COMPUTE_RAY_MARCHING_DISPATCH_ARGS,
+        RENDER_TECH_RAY_MARCH_COMPACTED_NO_MIN_MAX_OPT,
+        RENDER_TECH_RAY_MARCH_COMPACTED_MIN_MAX_OPT,
         RENDER_TECH_INTERPOLATE_IRRADIANCE,
         RENDER_TECH_UNWARP_EPIPOLAR_SCATTERING,
         RENDER_TECH_UNWARP_AND_RENDER_LUMINANCE,
+        RENDER_TECH_UNWARP_AND_FIX_INSCATTERING,
         RENDER_TECH_UPDATE_AVERAGE_LUMINANCE,
         RENDER_TECH_FIX_INSCATTERING_LUM_ONLY,
         RENDER_TECH_FIX_INSCATTERING,
         RENDER_TECH_BRUTE_FORCE_RAY_MARCHING,
+        RENDER_TECH_RAY_MARCH_DOWNSCALED,
+        RENDER_TECH_UPSAMPLE_INSCATTERING,
+        RENDER_TECH_UPSAMPLE_AND_RENDER_LUMINANCE,
+        RENDER_TECH_INJECT_FROXEL_INSCATTERING,
+        RENDER_TECH_INTEGRATE_FROXEL_INSCATTERING,
+        RENDER_TECH_APPLY_FROXEL_INSCATTERING,
+        RENDER_TECH_APPLY_FROXEL_INSCTR_AND_RENDER_LUMINANCE,
+        RENDER_TECH_COMPUTE_SKY_VIEW_LUT,
+        RENDER_TECH_COMPUTE_AERIAL_PERSPECTIVE_LUT,
+        RENDER_TECH_RENDER_SKY_CUBEMAP,
         RENDER_TECH_RENDER_SUN,
         RENDER_TECH_RENDER_SAMPLE_LOCATIONS,
 
-        // Precomputation techniques
-        RENDER_TECH_PRECOMPUTE_NET_DENSITY_TO_ATM_TOP,
-        RENDER_TECH_PRECOMPUTE_SINGLE_SCATTERING,
-        RENDER_TECH_COMPUTE_SCATTERING_RADIANCE,
-        RENDER_TECH_COMPUTE_SCATTERING_ORDER,
-        RENDER_TECH_INIT_HIGH_ORDER_SCATTERING,
-        RENDER_TECH_UPDATE_HIGH_ORDER_SCATTERING,
-        RENDER_TECH_COMBINE_SCATTERING_ORDERS,
-        RENDER_TECH_PRECOMPUTE_AMBIENT_SKY_LIGHT,
-
         RENDER_TECH_TOTAL_TECHNIQUES
     };
 
@@ -326,7 +510,12 @@ private:
         PSO_DEPENDENCY_AUTO_EXPOSURE             = 0x02000,
         PSO_DEPENDENCY_TONE_MAPPING_MODE         = 0x04000,
         PSO_DEPENDENCY_LIGHT_ADAPTATION          = 0x08000,
-        PSO_DEPENDENCY_EXTINCTION_EVAL_MODE      = 0x10000
+        PSO_DEPENDENCY_EXTINCTION_EVAL_MODE      = 0x10000,
+        PSO_DEPENDENCY_COMPACT_RAY_MARCHING      = 0x20000,
+        PSO_DEPENDENCY_MIN_MAX_SHADOW_MAP_RES    = 0x40000,
+        PSO_DEPENDENCY_LOW_PRECISION_FORMATS     = 0x80000,
+        PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS = 0x100000,
+        PSO_DEPENDENCY_TONE_MAPPING_LUT          = 0x200000
     };
 
     enum SRB_DEPENDENCY_FLAGS
@@ -347,32 +536,150 @@ private:
         SRB_DEPENDENCY_INITIAL_SCTR_LIGHT_TEX   = 0x02000,
         SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX    = 0x04000,
         SRB_DEPENDENCY_SLICE_UV_DIR_TEX         = 0x08000,
-        SRB_DEPENDENCY_CAM_SPACE_Z_TEX          = 0x10000
+        SRB_DEPENDENCY_CAM_SPACE_Z_TEX          = 0x10000,
+        SRB_DEPENDENCY_DOWNSCALED_INSCTR_TEX    = 0x20000,
+        SRB_DEPENDENCY_RAY_MARCHING_SAMPLE_LIST = 0x40000,
+        SRB_DEPENDENCY_DST_COLOR_BUFFER         = 0x80000,
+        SRB_DEPENDENCY_FROXEL_INSCTR_TEX        = 0x100000,
+        SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS = 0x200000,
+        SRB_DEPENDENCY_TONE_MAPPING_LUT         = 0x400000
     };
 
     RefCntAutoPtr<IShaderResourceBinding> m_pComputeMinMaxSMLevelSRB[2];
 
-    RefCntAutoPtr<ITexture> m_ptex3DHighOrderSctr, m_ptex3DHighOrderSctr2;
-
     RefCntAutoPtr<IBuffer> m_pcbPostProcessingAttribs;
-    RefCntAutoPtr<IBuffer> m_pcbMediaAttribs;
     RefCntAutoPtr<IBuffer> m_pcbMiscParams;
     RefCntAutoPtr<IBuffer> m_pcbLightAttribs;
     RefCntAutoPtr<IBuffer> m_pcbCameraAttribs;
+    RefCntAutoPtr<IBuffer> m_pcbFroxelGridAttribs;
 
     Uint32 m_uiBackBufferWidth  = 0;
     Uint32 m_uiBackBufferHeight = 0;
+};
+
+
+// {0A8E9D2F-6B3C-4E71-9F5A-2C7D84B1E063}
+static const INTERFACE_ID IID_AtmosphereLUTs =
+    {0xa8e9d2f, 0x6b3c, 0x4e71, {0x9f, 0x5a, 0x2c, 0x7d, 0x84, 0xb1, 0xe0, 0x63}};
+
+/// Precomputed atmosphere resources: optical depth texture, single and multiple scattering
+/// look-up tables, random sphere sampling texture and ambient sky light.
+/// The resources only depend on the participating media parameters and scattering coefficients,
+/// so a single object can be shared by several EpipolarLightScattering instances rendering
+/// different views. All instances that share the object must use the same scattering coefficient
+/// settings (bUseCustomSctrCoeffs, f4CustomRlghBeta, etc.), otherwise the tables are recomputed
+/// every time a different instance is rendered.
+class AtmosphereLUTs final : public ObjectBase<IObject>
+{
+public:
+    using TBase = ObjectBase<IObject>;
+
+    static RefCntAutoPtr<AtmosphereLUTs> Create(IRenderDevice*              pDevice,
+                                                IDeviceContext*             pContext,
+                                                const AirScatteringAttribs& ScatteringAttibs = AirScatteringAttribs{});
+
+    AtmosphereLUTs(IReferenceCounters*         pRefCounters,
+                   IRenderDevice*              pDevice,
+                   IDeviceContext*             pContext,
+                   const AirScatteringAttribs& ScatteringAttibs);
+    ~AtmosphereLUTs();
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_AtmosphereLUTs, TBase)
+
+    /// Recomputes the scattering coefficients if the settings in PPAttribs differ from
+    /// the ones the tables were computed with. The tables are then recomputed on next update.
+    void UpdateScatteringCoefficients(const EpipolarLightScatteringAttribs& PPAttribs, IDeviceContext* pContext);
+
+    /// Recomputes outdated tables. Scattering look-up tables are only computed when bScatteringLUTsRequired is true.
+    /// Note that the method changes render targets and pipeline states.
+    void Update(IRenderDevice* pDevice, IDeviceContext* pContext, bool bScatteringLUTsRequired);
+
+    const AirScatteringAttribs& GetMediaParams() const { return m_MediaParams; }
+
+    IBuffer*      GetMediaAttribsCB() { return m_pcbMediaAttribs; }
+    ITextureView* GetPrecomputedNetDensitySRV() { return m_ptex2DOccludedNetDensityToAtmTopSRV; }
+    ITextureView* GetSingleScatteringSRV() { return m_ptex3DSingleScatteringSRV; }
+    ITextureView* GetHighOrderScatteringSRV() { return m_ptex3DHighOrderScatteringSRV; }
+    ITextureView* GetMultipleScatteringSRV() { return m_ptex3DMultipleScatteringSRV; }
+    ITextureView* GetAmbientSkyLightSRV(IRenderDevice* pDevice, IDeviceContext* pContext);
+
+    /// Returns the dimensions of the scattering look-up tables as the shader expects them in PRECOMPUTED_SCTR_LUT_DIM.
+    float4 GetPrecomputedSctrLUTDim() const
+    {
+        return float4{static_cast<float>(m_iPrecomputedSctrUDim), static_cast<float>(m_iPrecomputedSctrVDim),
+                      static_cast<float>(m_iPrecomputedSctrWDim), static_cast<float>(m_iPrecomputedSctrQDim)};
+    }
+
+private:
+    void PrecomputeOpticalDepthTexture(IRenderDevice* pDevice, IDeviceContext* pContext);
+    void PrecomputeScatteringLUT(IRenderDevice* pDevice, IDeviceContext* pContext);
+    void CreateRandomSphereSamplingTexture(IRenderDevice* pDevice);
+    void ComputeAmbientSkyLightTexture(IRenderDevice* pDevice, IDeviceContext* pContext);
+    void ComputeScatteringCoefficients(IDeviceContext* pDeviceCtx = nullptr);
+    void CreateAmbientSkyLightTexture(IRenderDevice* pDevice);
+    void DefineMacros(class ShaderMacroHelper& Macros);
+
+    static constexpr TEXTURE_FORMAT PrecomputedNetDensityTexFmt = TEX_FORMAT_RG32_FLOAT;
+    static constexpr TEXTURE_FORMAT AmbientSkyLightTexFmt       = TEX_FORMAT_RGBA16_FLOAT;
+
+    static const int sm_iNumPrecomputedHeights = 1024;
+    static const int sm_iNumPrecomputedAngles  = 1024;
+
+    int m_iPrecomputedSctrUDim = 32;
+    int m_iPrecomputedSctrVDim = 128;
+    int m_iPrecomputedSctrWDim = 64;
+    int m_iPrecomputedSctrQDim = 16;
+
+    RefCntAutoPtr<ITextureView> m_ptex3DSingleScatteringSRV;
+    RefCntAutoPtr<ITextureView> m_ptex3DHighOrderScatteringSRV;
+    RefCntAutoPtr<ITextureView> m_ptex3DMultipleScatteringSRV;
+
+    // High-order scattering is accumulated by ping-ponging between two textures
+    RefCntAutoPtr<ITexture> m_ptex3DHighOrderSctr[2];
+
+    Uint32                      m_uiNumRandomSamplesOnSphere = 128;
+    RefCntAutoPtr<ITextureView> m_ptex2DSphereRandomSamplingSRV;
+
+    static const int            sm_iAmbientSkyLightTexDim = 1024;
+    RefCntAutoPtr<ITextureView> m_ptex2DAmbientSkyLightSRV; // 1024 x 1 RGBA16F
+    RefCntAutoPtr<ITextureView> m_ptex2DAmbientSkyLightRTV;
+    RefCntAutoPtr<ITextureView> m_ptex2DOccludedNetDensityToAtmTopSRV; // 1024 x 1024 RG32F
+    RefCntAutoPtr<ITextureView> m_ptex2DOccludedNetDensityToAtmTopRTV;
+
+    RefCntAutoPtr<IResourceMapping> m_pResMapping;
+    RefCntAutoPtr<IShader>          m_pFullScreenTriangleVS;
+    RefCntAutoPtr<ISampler>         m_pLinearClampSampler;
+    RefCntAutoPtr<IBuffer>          m_pcbMediaAttribs;
+
+    enum RENDER_TECH
+    {
+        RENDER_TECH_PRECOMPUTE_NET_DENSITY_TO_ATM_TOP = 0,
+        RENDER_TECH_PRECOMPUTE_SINGLE_SCATTERING,
+        RENDER_TECH_COMPUTE_SCATTERING_RADIANCE,
+        RENDER_TECH_COMPUTE_SCATTERING_ORDER,
+        RENDER_TECH_INIT_HIGH_ORDER_SCATTERING,
+        RENDER_TECH_UPDATE_HIGH_ORDER_SCATTERING,
+        RENDER_TECH_COMBINE_SCATTERING_ORDERS,
+        RENDER_TECH_PRECOMPUTE_AMBIENT_SKY_LIGHT,
+
+        RENDER_TECH_TOTAL_TECHNIQUES
+    };
+
+    EpipolarLightScattering::RenderTechnique m_RenderTech[RENDER_TECH_TOTAL_TECHNIQUES];
 
     //const float m_fTurbidity = 1.02f;
     AirScatteringAttribs m_MediaParams;
 
+    // Scattering coefficient settings the tables were computed with
+    EpipolarLightScatteringAttribs m_SctrCoeffsAttribs;
+
     enum UpToDateResourceFlags
     {
         PrecomputedOpticalDepthTex = 0x01,
         AmbientSkyLightTex         = 0x02,
         PrecomputedIntegralsTex    = 0x04
     };
-    Uint32 m_uiUpToDateResourceFlags;
+    Uint32 m_uiUpToDateResourceFlags = 0;
 };
 
 } // namespace Diligent
@@ -29,15 +29,22 @@
 #include <unordered_set>
 #include <array>
 #include <cstring>
+#include <sstream>
+#include <limits>
+#include <cmath>
 
 #include "EpipolarLightScattering.hpp"
 #include "ShaderMacroHelper.hpp"
 #include "GraphicsUtilities.h"
 #include "GraphicsAccessories.hpp"
 #include "../../../Utilities/include/DiligentFXShaderSourceStreamFactory.hpp"
+#include "../../../Utilities/include/DiligentFXShaderArchive.hpp"
+#include "../../../Utilities/include/TransientTexturePool.hpp"
+#include "../../../Utilities/include/RenderGraph.hpp"
 #include "MapHelper.hpp"
 #include "CommonlyUsedStates.h"
 #include "Align.hpp"
+#include "HashUtils.hpp"
 
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -176,6 +183,31 @@ static void RenderFullScreenTriangle(IDeviceContext*         pDeviceContext,
 }
 
 
+// Returns the key that identifies pipeline state variant in the technique cache.
+// Shaders are identified by their addresses since the variants are cached by CreateShader().
+static std::string GetPSOCacheKey(const char*                       PSOName,
+                                  const PipelineResourceLayoutDesc& ResourceLayout,
+                                  std::initializer_list<IShader*>   Shaders)
+{
+    std::stringstream ss;
+    ss << PSOName;
+    for (auto* pShader : Shaders)
+        ss << '|' << pShader;
+
+    ss << '|' << ResourceLayout.DefaultVariableType;
+    for (Uint32 i = 0; i < ResourceLayout.NumVariables; ++i)
+    {
+        const auto& Var = ResourceLayout.Variables[i];
+        ss << '|' << Var.ShaderStages << ':' << Var.Name << ':' << Var.Type;
+    }
+    for (Uint32 i = 0; i < ResourceLayout.NumImmutableSamplers; ++i)
+    {
+        const auto& Sam = ResourceLayout.ImmutableSamplers[i];
+        ss << '|' << Sam.ShaderStages << ':' << Sam.SamplerOrTextureName << ':' << std::hash<SamplerDesc>{}(Sam.Desc);
+    }
+    return ss.str();
+}
+
 void EpipolarLightScattering::RenderTechnique::InitializeFullScreenTriangleTechnique(
     IRenderDevice*                    pDevice,
     const char*                       PSOName,
@@ -211,7 +243,26 @@ void EpipolarLightScattering::RenderTechnique::InitializeFullScreenTriangleTechn
 
     PSO.Release();
     SRB.Release();
+
+    std::stringstream KeySS;
+    KeySS << GetPSOCacheKey(PSOName, ResourceLayout, {VertexShader, PixelShader});
+    for (Uint32 rt = 0; rt < NumRTVs; ++rt)
+        KeySS << '|' << RTVFmts[rt];
+    KeySS << '|' << DSVFmt
+          << '|' << std::hash<DepthStencilStateDesc>{}(DSSDesc)
+          << '|' << std::hash<BlendStateDesc>{}(BSDesc);
+    auto Key = KeySS.str();
+
+    auto CachedPSO = PSOCache.find(Key);
+    if (CachedPSO != PSOCache.end())
+    {
+        PSO = CachedPSO->second;
+        return;
+    }
+
     pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &PSO);
+    if (PSO)
+        PSOCache.emplace(std::move(Key), PSO);
 }
 
 void EpipolarLightScattering::RenderTechnique::InitializeFullScreenTriangleTechnique(
@@ -242,7 +293,19 @@ void EpipolarLightScattering::RenderTechnique::InitializeComputeTechnique(IRende
     PSOCreateInfo.pCS      = ComputeShader;
     PSO.Release();
     SRB.Release();
+
+    auto Key = GetPSOCacheKey(PSOName, ResourceLayout, {ComputeShader});
+
+    auto CachedPSO = PSOCache.find(Key);
+    if (CachedPSO != PSOCache.end())
+    {
+        PSO = CachedPSO->second;
+        return;
+    }
+
     pDevice->CreateComputePipelineState(PSOCreateInfo, &PSO);
+    if (PSO)
+        PSOCache.emplace(std::move(Key), PSO);
 }
 
 void EpipolarLightScattering::RenderTechnique::PrepareSRB(IRenderDevice* pDevice, IResourceMapping* pResMapping, BIND_SHADER_RESOURCES_FLAGS Flags = BIND_SHADER_RESOURCES_KEEP_EXISTING | BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED)
@@ -266,6 +329,13 @@ void EpipolarLightScattering::RenderTechnique::DispatchCompute(IDeviceContext* p
     pDeviceContext->DispatchCompute(DispatchAttrs);
 }
 
+void EpipolarLightScattering::RenderTechnique::DispatchComputeIndirect(IDeviceContext* pDeviceContext, IBuffer* pAttribsBuffer)
+{
+    pDeviceContext->SetPipelineState(PSO);
+    pDeviceContext->CommitShaderResources(SRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pDeviceContext->DispatchComputeIndirect(DispatchComputeIndirectAttribs{pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE_TRANSITION});
+}
+
 void EpipolarLightScattering::RenderTechnique::CheckStaleFlags(Uint32 StalePSODependencies, Uint32 StaleSRBDependencies)
 {
     if ((PSODependencyFlags & StalePSODependencies) != 0)
@@ -279,11 +349,12 @@ void EpipolarLightScattering::RenderTechnique::CheckStaleFlags(Uint32 StalePSODe
     }
 }
 
-static RefCntAutoPtr<IShader> CreateShader(IRenderDevice*     pDevice,
-                                           const Char*        FileName,
-                                           const Char*        EntryPoint,
-                                           SHADER_TYPE        Type,
-                                           const ShaderMacro* Macros = nullptr)
+static RefCntAutoPtr<IShader> CreateShaderFromFile(IRenderDevice*     pDevice,
+                                                   const Char*        FileName,
+                                                   const Char*        EntryPoint,
+                                                   SHADER_TYPE        Type,
+                                                   const ShaderMacro* Macros   = nullptr,
+                                                   SHADER_COMPILER    Compiler = SHADER_COMPILER_DEFAULT)
 {
     ShaderCreateInfo ShaderCI;
     ShaderCI.EntryPoint                 = EntryPoint;
@@ -294,25 +365,46 @@ static RefCntAutoPtr<IShader> CreateShader(IRenderDevice*     pDevice,
     ShaderCI.Desc.Name                  = EntryPoint;
     ShaderCI.pShaderSourceStreamFactory = &DiligentFXShaderSourceStreamFactory::GetInstance();
     ShaderCI.UseCombinedTextureSamplers = true;
-    RefCntAutoPtr<IShader> pShader;
-    pDevice->CreateShader(ShaderCI, &pShader);
+    ShaderCI.ShaderCompiler             = Compiler;
+    return DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+}
+
+RefCntAutoPtr<IShader> EpipolarLightScattering::CreateShader(IRenderDevice*     pDevice,
+                                                             const Char*        FileName,
+                                                             const Char*        EntryPoint,
+                                                             SHADER_TYPE        Type,
+                                                             const ShaderMacro* Macros,
+                                                             SHADER_COMPILER    Compiler)
+{
+    std::stringstream KeySS;
+    KeySS << FileName << '|' << EntryPoint << '|' << Type << '|' << Compiler;
+    for (auto* Macro = Macros; Macro != nullptr && Macro->Name != nullptr; ++Macro)
+        KeySS << '|' << Macro->Name << '=' << (Macro->Definition != nullptr ? Macro->Definition : "");
+    auto Key = KeySS.str();
+
+    auto CachedShader = m_ShaderCache.find(Key);
+    if (CachedShader != m_ShaderCache.end())
+        return CachedShader->second;
+
+    auto pShader = CreateShaderFromFile(pDevice, FileName, EntryPoint, Type, Macros, Compiler);
+    if (pShader)
+        m_ShaderCache.emplace(std::move(Key), pShader);
     return pShader;
 }
 
-EpipolarLightScattering::EpipolarLightScattering(IRenderDevice*              pDevice,
-                                                 IDeviceContext*             pContext,
-                                                 TEXTURE_FORMAT              BackBufferFmt,
-                                                 TEXTURE_FORMAT              DepthBufferFmt,
-                                                 TEXTURE_FORMAT              OffscreenBackBufferFmt,
-                                                 const AirScatteringAttribs& ScatteringAttibs) :
-    m_BackBufferFmt(BackBufferFmt),
-    m_DepthBufferFmt(DepthBufferFmt),
-    m_bUseCombinedMinMaxTexture(false),
-    m_uiSampleRefinementCSThreadGroupSize(0),
-    // Using small group size is inefficient because a lot of SIMD lanes become idle
-    m_uiSampleRefinementCSMinimumThreadGroupSize(128), // Must be greater than 32
-    m_MediaParams(ScatteringAttibs),
-    m_uiUpToDateResourceFlags(0)
+RefCntAutoPtr<AtmosphereLUTs> AtmosphereLUTs::Create(IRenderDevice*              pDevice,
+                                                     IDeviceContext*             pContext,
+                                                     const AirScatteringAttribs& ScatteringAttibs)
+{
+    return RefCntAutoPtr<AtmosphereLUTs>{MakeNewRCObj<AtmosphereLUTs>()(pDevice, pContext, ScatteringAttibs)};
+}
+
+AtmosphereLUTs::AtmosphereLUTs(IReferenceCounters*         pRefCounters,
+                               IRenderDevice*              pDevice,
+                               IDeviceContext*             pContext,
+                               const AirScatteringAttribs& ScatteringAttibs) :
+    TBase{pRefCounters},
+    m_MediaParams{ScatteringAttibs}
 {
     VERIFY_EXPR(m_MediaParams.fAtmTopAltitude > m_MediaParams.fAtmBottomAltitude);
     m_MediaParams.fAtmTopRadius        = m_MediaParams.fEarthRadius + m_MediaParams.fAtmTopAltitude;
@@ -330,13 +422,11 @@ EpipolarLightScattering::EpipolarLightScattering(IRenderDevice*              pDe
         m_iPrecomputedSctrQDim /= 2;
     }
 
-    // clang-format off
-    CreateUniformBuffer(pDevice, sizeof(EpipolarLightScatteringAttribs), "Epipolar Light Scattering Attribs CB", &m_pcbPostProcessingAttribs);
-    CreateUniformBuffer(pDevice, sizeof(MiscDynamicParams),              "Misc Dynamic Params CB",               &m_pcbMiscParams);
-    // clang-format on
+    ComputeScatteringCoefficients();
 
     {
         BufferDesc CBDesc;
+        CBDesc.Name      = "Participating media scattering params CB";
         CBDesc.Usage     = USAGE_DEFAULT;
         CBDesc.BindFlags = BIND_UNIFORM_BUFFER;
         CBDesc.Size      = sizeof(AirScatteringAttribs);
@@ -344,24 +434,136 @@ EpipolarLightScattering::EpipolarLightScattering(IRenderDevice*              pDe
         BufferData InitData{&m_MediaParams, CBDesc.Size};
         pDevice->CreateBuffer(CBDesc, &InitData, &m_pcbMediaAttribs);
     }
+    m_pResMapping->AddResource("cbParticipatingMediaScatteringParams", m_pcbMediaAttribs, true);
+
+    pDevice->CreateSampler(Sam_LinearClamp, &m_pLinearClampSampler);
+    m_pFullScreenTriangleVS = CreateShaderFromFile(pDevice, "FullScreenTriangleVS.fx", "FullScreenTriangleVS", SHADER_TYPE_VERTEX);
+
+    PrecomputeOpticalDepthTexture(pDevice, pContext);
+
+    CreateAmbientSkyLightTexture(pDevice);
+}
+
+AtmosphereLUTs::~AtmosphereLUTs()
+{
+}
+
+void AtmosphereLUTs::DefineMacros(ShaderMacroHelper& Macros)
+{
+    std::stringstream ss;
+    ss << "float4(" << m_iPrecomputedSctrUDim << ".0,"
+       << m_iPrecomputedSctrVDim << ".0,"
+       << m_iPrecomputedSctrWDim << ".0,"
+       << m_iPrecomputedSctrQDim << ".0)";
+    Macros.AddShaderMacro("PRECOMPUTED_SCTR_LUT_DIM", ss.str());
+}
+
+void AtmosphereLUTs::UpdateScatteringCoefficients(const EpipolarLightScatteringAttribs& PPAttribs, IDeviceContext* pContext)
+{
+    // clang-format off
+    bool bRecomputeSctrCoeffs = m_SctrCoeffsAttribs.bUseCustomSctrCoeffs    != PPAttribs.bUseCustomSctrCoeffs    ||
+                                m_SctrCoeffsAttribs.bUseOzoneApproximation  != PPAttribs.bUseOzoneApproximation  ||
+                                m_SctrCoeffsAttribs.fAerosolDensityScale    != PPAttribs.fAerosolDensityScale    ||
+                                m_SctrCoeffsAttribs.fAerosolAbsorbtionScale != PPAttribs.fAerosolAbsorbtionScale ||
+                                (PPAttribs.bUseCustomSctrCoeffs && 
+                                    (m_SctrCoeffsAttribs.f4CustomRlghBeta        != PPAttribs.f4CustomRlghBeta ||
+                                     m_SctrCoeffsAttribs.f4CustomMieBeta         != PPAttribs.f4CustomMieBeta ||
+                                     m_SctrCoeffsAttribs.f4CustomOzoneAbsorption != PPAttribs.f4CustomOzoneAbsorption) );
+    // clang-format on
+    if (!bRecomputeSctrCoeffs)
+        return;
+
+    m_SctrCoeffsAttribs = PPAttribs;
+
+    m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::PrecomputedOpticalDepthTex;
+    m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::AmbientSkyLightTex;
+    m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::PrecomputedIntegralsTex;
+    ComputeScatteringCoefficients(pContext);
+}
+
+void AtmosphereLUTs::Update(IRenderDevice* pDevice, IDeviceContext* pContext, bool bScatteringLUTsRequired)
+{
+    if (!(m_uiUpToDateResourceFlags & UpToDateResourceFlags::PrecomputedOpticalDepthTex))
+    {
+        PrecomputeOpticalDepthTexture(pDevice, pContext);
+    }
+
+    if (bScatteringLUTsRequired && !(m_uiUpToDateResourceFlags & UpToDateResourceFlags::PrecomputedIntegralsTex))
+    {
+        PrecomputeScatteringLUT(pDevice, pContext);
+    }
+}
+
+EpipolarLightScattering::EpipolarLightScattering(IRenderDevice*              pDevice,
+                                                 IDeviceContext*             pContext,
+                                                 TEXTURE_FORMAT              BackBufferFmt,
+                                                 TEXTURE_FORMAT              DepthBufferFmt,
+                                                 TEXTURE_FORMAT              OffscreenBackBufferFmt,
+                                                 const AirScatteringAttribs& ScatteringAttibs) :
+    EpipolarLightScattering{pDevice, pContext, BackBufferFmt, DepthBufferFmt, OffscreenBackBufferFmt,
+                            AtmosphereLUTs::Create(pDevice, pContext, ScatteringAttibs)}
+{
+}
+
+EpipolarLightScattering::EpipolarLightScattering(IRenderDevice*  pDevice,
+                                                 IDeviceContext* pContext,
+                                                 TEXTURE_FORMAT  BackBufferFmt,
+                                                 TEXTURE_FORMAT  DepthBufferFmt,
+                                                 TEXTURE_FORMAT  OffscreenBackBufferFmt,
+                                                 AtmosphereLUTs* pAtmosphereLUTs) :
+    m_BackBufferFmt(BackBufferFmt),
+    m_DepthBufferFmt(DepthBufferFmt),
+    m_bUseCombinedMinMaxTexture(false),
+    m_bCompactRayMarchingSamples(false),
+    m_bBuildMinMaxTreeInCS(false),
+    m_bUseWaveOpsInSampleRefinement(false),
+    m_bUnwarpAndFixInscatteringInCS(false),
+    m_uiSampleRefinementCSThreadGroupSize(0),
+    // Using small group size is inefficient because a lot of SIMD lanes become idle
+    m_uiSampleRefinementCSMinimumThreadGroupSize(128), // Must be greater than 32
+    m_pAtmosphereLUTs(pAtmosphereLUTs)
+{
+    DEV_CHECK_ERR(m_pAtmosphereLUTs, "Atmosphere LUTs must not be null");
+
+    pDevice->CreateResourceMapping(ResourceMappingDesc(), &m_pResMapping);
+
+    {
+        // Wave intrinsics require shader model 6.0, which is only available through DXC.
+        // Refinement shader packs flags of 32 consecutive samples into one ballot, so waves
+        // must contain at least 32 lanes.
+        const auto& DeviceInfo = pDevice->GetDeviceInfo();
+        const auto& WaveOpInfo = pDevice->GetAdapterInfo().WaveOp;
+        // clang-format off
+        m_bUseWaveOpsInSampleRefinement =
+            (DeviceInfo.Type == RENDER_DEVICE_TYPE_D3D12 || DeviceInfo.Type == RENDER_DEVICE_TYPE_VULKAN) &&
+            DeviceInfo.Features.WaveOp != DEVICE_FEATURE_STATE_DISABLED                                   &&
+            (WaveOpInfo.SupportedStages & SHADER_TYPE_COMPUTE) != 0                                       &&
+            (WaveOpInfo.Features & (WAVE_FEATURE_BASIC | WAVE_FEATURE_BALLOT)) == (WAVE_FEATURE_BASIC | WAVE_FEATURE_BALLOT) &&
+            WaveOpInfo.MinSize >= 32;
+        // clang-format on
+    }
+
+    // clang-format off
+    CreateUniformBuffer(pDevice, sizeof(EpipolarLightScatteringAttribs), "Epipolar Light Scattering Attribs CB", &m_pcbPostProcessingAttribs);
+    CreateUniformBuffer(pDevice, sizeof(MiscDynamicParams),              "Misc Dynamic Params CB",               &m_pcbMiscParams);
+    CreateUniformBuffer(pDevice, sizeof(FroxelGridAttribs),              "Froxel Grid Attribs CB",               &m_pcbFroxelGridAttribs);
+    // clang-format on
 
     // clang-format off
     // Add uniform buffers to the shader resource mapping. These buffers will never change.
     // Note that only buffer objects will stay unchanged, while the buffer contents can be updated.
-    m_pResMapping->AddResource("cbPostProcessingAttribs",              m_pcbPostProcessingAttribs, true);
-    m_pResMapping->AddResource("cbParticipatingMediaScatteringParams", m_pcbMediaAttribs,          true);
-    m_pResMapping->AddResource("cbMiscDynamicParams",                  m_pcbMiscParams,            true);
+    m_pResMapping->AddResource("cbPostProcessingAttribs",              m_pcbPostProcessingAttribs,             true);
+    m_pResMapping->AddResource("cbParticipatingMediaScatteringParams", m_pAtmosphereLUTs->GetMediaAttribsCB(), true);
+    m_pResMapping->AddResource("cbMiscDynamicParams",                  m_pcbMiscParams,                        true);
+    m_pResMapping->AddResource("cbFroxelGridAttribs",                  m_pcbFroxelGridAttribs,                 true);
     // clang-format on
 
     pDevice->CreateSampler(Sam_LinearClamp, &m_pLinearClampSampler);
     pDevice->CreateSampler(Sam_PointClamp, &m_pPointClampSampler);
+    m_pTransientTexturePool.reset(new TransientTexturePool{pDevice});
     m_pFullScreenTriangleVS = CreateShader(pDevice, "FullScreenTriangleVS.fx", "FullScreenTriangleVS", SHADER_TYPE_VERTEX);
 
-    ComputeScatteringCoefficients(pContext);
-
-    PrecomputeOpticalDepthTexture(pDevice, pContext);
-
-    CreateAmbientSkyLightTexture(pDevice);
+    BindAtmosphereLUTs();
 }
 
 EpipolarLightScattering::~EpipolarLightScattering()
@@ -374,6 +576,8 @@ void EpipolarLightScattering::OnWindowResize(IRenderDevice* pDevice, Uint32 uiBa
     m_uiBackBufferWidth  = uiBackBufferWidth;
     m_uiBackBufferHeight = uiBackBufferHeight;
     m_ptex2DCamSpaceZRTV.Release();
+    m_ptex2DDownscaledInsctrRTV.Release();
+    m_ptex2DDownscaledCamSpaceZRTV.Release();
 }
 
 void EpipolarLightScattering::DefineMacros(ShaderMacroHelper& Macros)
@@ -387,20 +591,38 @@ void EpipolarLightScattering::DefineMacros(ShaderMacroHelper& Macros)
     Macros.AddShaderMacro("ENABLE_LIGHT_SHAFTS",          m_PostProcessingAttribs.bEnableLightShafts);
     Macros.AddShaderMacro("MULTIPLE_SCATTERING_MODE",     m_PostProcessingAttribs.iMultipleScatteringMode);
     Macros.AddShaderMacro("SINGLE_SCATTERING_MODE",       m_PostProcessingAttribs.iSingleScatteringMode);
+    Macros.AddShaderMacro("USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS", m_bUseSkyViewAndAerialPerspectiveLUTs);
     // clang-format on
 
     {
+        const auto LUTDim = m_pAtmosphereLUTs->GetPrecomputedSctrLUTDim();
         std::stringstream ss;
-        ss << "float4(" << m_iPrecomputedSctrUDim << ".0,"
-           << m_iPrecomputedSctrVDim << ".0,"
-           << m_iPrecomputedSctrWDim << ".0,"
-           << m_iPrecomputedSctrQDim << ".0)";
+        ss << "float4(" << LUTDim.x << ".0,"
+           << LUTDim.y << ".0,"
+           << LUTDim.z << ".0,"
+           << LUTDim.w << ".0)";
         Macros.AddShaderMacro("PRECOMPUTED_SCTR_LUT_DIM", ss.str());
     }
 }
 
-void EpipolarLightScattering::PrecomputeOpticalDepthTexture(IRenderDevice*  pDevice,
-                                                            IDeviceContext* pDeviceContext)
+void EpipolarLightScattering::BindAtmosphereLUTs()
+{
+    // Look-up tables are created on first use, so the resources are added to the mapping
+    // every time the tables are updated. The texture objects never change after they are created.
+    // clang-format off
+    if (auto* pSRV = m_pAtmosphereLUTs->GetPrecomputedNetDensitySRV())
+        m_pResMapping->AddResource("g_tex2DOccludedNetDensityToAtmTop", pSRV, false);
+    if (auto* pSRV = m_pAtmosphereLUTs->GetSingleScatteringSRV())
+        m_pResMapping->AddResource("g_tex3DSingleSctrLUT",              pSRV, true);
+    if (auto* pSRV = m_pAtmosphereLUTs->GetHighOrderScatteringSRV())
+        m_pResMapping->AddResource("g_tex3DHighOrderSctrLUT",           pSRV, false);
+    if (auto* pSRV = m_pAtmosphereLUTs->GetMultipleScatteringSRV())
+        m_pResMapping->AddResource("g_tex3DMultipleSctrLUT",            pSRV, true);
+    // clang-format on
+}
+
+void AtmosphereLUTs::PrecomputeOpticalDepthTexture(IRenderDevice*  pDevice,
+                                                   IDeviceContext* pDeviceContext)
 {
     if (!m_ptex2DOccludedNetDensityToAtmTopSRV)
     {
@@ -431,7 +653,7 @@ void EpipolarLightScattering::PrecomputeOpticalDepthTexture(IRenderDevice*  pDev
     if (!PrecomputeNetDensityToAtmTopTech.PSO)
     {
         RefCntAutoPtr<IShader> pPrecomputeNetDensityToAtmTopPS;
-        pPrecomputeNetDensityToAtmTopPS = CreateShader(pDevice, "PrecomputeNetDensityToAtmTop.fx", "PrecomputeNetDensityToAtmTopPS", SHADER_TYPE_PIXEL);
+        pPrecomputeNetDensityToAtmTopPS = CreateShaderFromFile(pDevice, "PrecomputeNetDensityToAtmTop.fx", "PrecomputeNetDensityToAtmTopPS", SHADER_TYPE_PIXEL);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
         PrecomputeNetDensityToAtmTopTech.InitializeFullScreenTriangleTechnique(pDevice, "PrecomputeNetDensityToAtmTopPSO", m_pFullScreenTriangleVS,
@@ -447,7 +669,7 @@ void EpipolarLightScattering::PrecomputeOpticalDepthTexture(IRenderDevice*  pDev
 
 
 
-void EpipolarLightScattering::CreateRandomSphereSamplingTexture(IRenderDevice* pDevice)
+void AtmosphereLUTs::CreateRandomSphereSamplingTexture(IRenderDevice* pDevice)
 {
     TextureDesc RandomSphereSamplingTexDesc;
     RandomSphereSamplingTexDesc.Type      = RESOURCE_DIM_TEX_2D;
@@ -494,27 +716,6 @@ void EpipolarLightScattering::CreateEpipolarTextures(IRenderDevice* pDevice)
     TexDesc.Width     = m_PostProcessingAttribs.uiMaxSamplesInSlice;
     TexDesc.Height    = m_PostProcessingAttribs.uiNumEpipolarSlices;
 
-    {
-        // MaxSamplesInSlice x NumSlices RG32F texture to store screen-space coordinates
-        // for every epipolar sample
-        TexDesc.Name                = "Coordinate Texture";
-        TexDesc.Format              = CoordinateTexFmt;
-        TexDesc.ClearValue.Format   = TexDesc.Format;
-        TexDesc.ClearValue.Color[0] = -1e+30f;
-        TexDesc.ClearValue.Color[1] = -1e+30f;
-        TexDesc.ClearValue.Color[2] = -1e+30f;
-        TexDesc.ClearValue.Color[3] = -1e+30f;
-
-        RefCntAutoPtr<ITexture> tex2DCoordinateTexture;
-        pDevice->CreateTexture(TexDesc, nullptr, &tex2DCoordinateTexture);
-        auto* tex2DCoordinateTextureSRV = tex2DCoordinateTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
-        m_ptex2DCoordinateTextureRTV    = tex2DCoordinateTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-        tex2DCoordinateTextureSRV->SetSampler(m_pLinearClampSampler);
-        m_pResMapping->AddResource("g_tex2DCoordinates", tex2DCoordinateTextureSRV, false);
-    }
-
-    TexDesc.ClearValue.Format = TEX_FORMAT_UNKNOWN;
-
     {
         TexDesc.Name = "Interpolation Source";
         // MaxSamplesInSlice x NumSlices RG16U texture to store two indices from which
@@ -535,25 +736,12 @@ void EpipolarLightScattering::CreateEpipolarTextures(IRenderDevice* pDevice)
         m_pResMapping->AddResource("g_rwtex2DInterpolationSource", tex2DInterpolationSourceUAV, false);
     }
 
-    {
-        // MaxSamplesInSlice x NumSlices R32F texture to store camera-space Z coordinate,
-        // for every epipolar sample
-        TexDesc.Name      = "Epipolar Cam Space Z";
-        TexDesc.Format    = EpipolarCamSpaceZFmt;
-        TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
-        RefCntAutoPtr<ITexture> tex2DEpipolarCamSpaceZ;
-        pDevice->CreateTexture(TexDesc, nullptr, &tex2DEpipolarCamSpaceZ);
-        auto* tex2DEpipolarCamSpaceZSRV = tex2DEpipolarCamSpaceZ->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
-        m_ptex2DEpipolarCamSpaceZRTV    = tex2DEpipolarCamSpaceZ->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-        tex2DEpipolarCamSpaceZSRV->SetSampler(m_pLinearClampSampler);
-        m_pResMapping->AddResource("g_tex2DEpipolarCamSpaceZ", tex2DEpipolarCamSpaceZSRV, false);
-    }
-
     {
         // MaxSamplesInSlice x NumSlices RGBA16F texture to store interpolated inscattered light,
         // for every epipolar sample
         TexDesc.Name                = "Epipolar Inscattering";
         TexDesc.Format              = EpipolarInsctrTexFmt;
+        TexDesc.BindFlags           = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
         constexpr float flt16max    = 65504.f;
         TexDesc.ClearValue.Format   = TexDesc.Format;
         TexDesc.ClearValue.Color[0] = -flt16max;
@@ -567,81 +755,61 @@ void EpipolarLightScattering::CreateEpipolarTextures(IRenderDevice* pDevice)
         tex2DEpipolarInscatteringSRV->SetSampler(m_pLinearClampSampler);
         m_pResMapping->AddResource("g_tex2DScatteredColor", tex2DEpipolarInscatteringSRV, false);
     }
+}
 
+void EpipolarLightScattering::CreateRayMarchingSampleListBuffers(IRenderDevice* pDevice)
+{
     {
-        // MaxSamplesInSlice x NumSlices RGBA16F texture to store initial inscattered light,
-        // for every epipolar sample
-        TexDesc.Name                = "Initial Scattered Light";
-        TexDesc.ClearValue.Format   = TexDesc.Format;
-        TexDesc.ClearValue.Color[0] = 0;
-        TexDesc.ClearValue.Color[1] = 0;
-        TexDesc.ClearValue.Color[2] = 0;
-        TexDesc.ClearValue.Color[3] = 0;
-        RefCntAutoPtr<ITexture> tex2DInitialScatteredLight;
-        pDevice->CreateTexture(TexDesc, nullptr, &tex2DInitialScatteredLight);
-        auto* tex2DInitialScatteredLightSRV = tex2DInitialScatteredLight->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
-        m_ptex2DInitialScatteredLightRTV    = tex2DInitialScatteredLight->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-        tex2DInitialScatteredLightSRV->SetSampler(m_pLinearClampSampler);
-        m_pResMapping->AddResource("g_tex2DInitialInsctrIrradiance", tex2DInitialScatteredLightSRV, false);
+        // Compacted list of ray marching samples. In the worst case, every epipolar sample is a ray marching sample
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Ray Marching Sample List";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS | BIND_SHADER_RESOURCE;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        BuffDesc.Size              = Uint64{BuffDesc.ElementByteStride} * m_PostProcessingAttribs.uiMaxSamplesInSlice * m_PostProcessingAttribs.uiNumEpipolarSlices;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pbufRayMarchingSampleList);
+        m_pResMapping->AddResource("g_RayMarchingSampleList", m_pbufRayMarchingSampleList->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE), false);
+        m_pResMapping->AddResource("g_rwRayMarchingSampleList", m_pbufRayMarchingSampleList->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS), false);
     }
 
-    TexDesc.ClearValue.Format = TEX_FORMAT_UNKNOWN;
-
     {
-        // MaxSamplesInSlice x NumSlices depth stencil texture to mark samples for processing,
-        // for every epipolar sample
-        TexDesc.Name   = "Epipolar Image Depth";
-        TexDesc.Format = TEX_FORMAT_UNKNOWN;
-        for (auto Fmt : {EpipolarImageDepthFmt0, EpipolarImageDepthFmt1})
-        {
-            const auto& FmtInfo = pDevice->GetTextureFormatInfoExt(Fmt);
-            if (FmtInfo.BindFlags & BIND_DEPTH_STENCIL)
-            {
-                TexDesc.Format = Fmt;
-                break;
-            }
-        }
-        if (TexDesc.Format == TEX_FORMAT_UNKNOWN)
-            LOG_ERROR_AND_THROW("Failed to find suitable depth-stencil format for epipolar image depth buffer");
-
-        TexDesc.BindFlags                       = BIND_DEPTH_STENCIL;
-        TexDesc.ClearValue.Format               = TexDesc.Format;
-        TexDesc.ClearValue.DepthStencil.Depth   = 1;
-        TexDesc.ClearValue.DepthStencil.Stencil = 0;
-        RefCntAutoPtr<ITexture> tex2DEpipolarImageDepth;
-        pDevice->CreateTexture(TexDesc, nullptr, &tex2DEpipolarImageDepth);
-        m_ptex2DEpipolarImageDSV = tex2DEpipolarImageDepth->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+        // The number of samples in the list. The counter is reset every frame before the sample refinement pass
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Ray Marching Sample Counter";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS | BIND_SHADER_RESOURCE;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        BuffDesc.Size              = sizeof(Uint32);
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pbufRayMarchingSampleCounter);
+        m_pResMapping->AddResource("g_RayMarchingSampleCounter", m_pbufRayMarchingSampleCounter->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE), false);
+        m_pResMapping->AddResource("g_rwRayMarchingSampleCounter", m_pbufRayMarchingSampleCounter->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS), false);
     }
-}
-
-void EpipolarLightScattering::CreateSliceEndPointsTexture(IRenderDevice* pDevice)
-{
-    // NumSlices x 1 RGBA32F texture to store end point coordinates for every epipolar slice
-    TextureDesc TexDesc;
-    TexDesc.Name      = "Slice Endpoints";
-    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
-    TexDesc.MipLevels = 1;
-    TexDesc.Usage     = USAGE_DEFAULT;
-    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
-    TexDesc.Width     = m_PostProcessingAttribs.uiNumEpipolarSlices;
-    TexDesc.Height    = 1;
-    TexDesc.Format    = SliceEndpointsFmt;
-
-    TexDesc.ClearValue.Format   = TexDesc.Format;
-    TexDesc.ClearValue.Color[0] = -1e+30f;
-    TexDesc.ClearValue.Color[1] = -1e+30f;
-    TexDesc.ClearValue.Color[2] = -1e+30f;
-    TexDesc.ClearValue.Color[3] = -1e+30f;
 
-    RefCntAutoPtr<ITexture> tex2DSliceEndpoints;
-    pDevice->CreateTexture(TexDesc, nullptr, &tex2DSliceEndpoints);
-    auto* tex2DSliceEndpointsSRV = tex2DSliceEndpoints->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
-    m_ptex2DSliceEndpointsRTV    = tex2DSliceEndpoints->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-    tex2DSliceEndpointsSRV->SetSampler(m_pLinearClampSampler);
-    m_pResMapping->AddResource("g_tex2DSliceEndPoints", tex2DSliceEndpointsSRV, false);
+    {
+        // Indirect dispatch arguments. Note that indirect argument buffers cannot be structured in D3D11,
+        // so we use formatted buffer
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Ray Marching Dispatch Args";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS | BIND_INDIRECT_DRAW_ARGS;
+        BuffDesc.Mode              = BUFFER_MODE_FORMATTED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        BuffDesc.Size              = sizeof(Uint32) * 3;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pbufRayMarchingDispatchArgs);
+
+        BufferViewDesc UAVDesc;
+        UAVDesc.ViewType             = BUFFER_VIEW_UNORDERED_ACCESS;
+        UAVDesc.Format.ValueType     = VT_UINT32;
+        UAVDesc.Format.NumComponents = 1;
+        RefCntAutoPtr<IBufferView> pDispatchArgsUAV;
+        m_pbufRayMarchingDispatchArgs->CreateView(UAVDesc, &pDispatchArgsUAV);
+        m_pResMapping->AddResource("g_rwRayMarchingDispatchArgs", pDispatchArgsUAV, false);
+    }
 }
 
-void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, IDeviceContext* pContext)
+void AtmosphereLUTs::PrecomputeScatteringLUT(IRenderDevice* pDevice, IDeviceContext* pContext)
 {
     const auto AdapterType              = pDevice->GetAdapterInfo().Type;
     const int  ThreadGroupSize          = AdapterType == ADAPTER_TYPE_INTEGRATED || AdapterType == ADAPTER_TYPE_SOFTWARE ? 8 : 16;
@@ -653,7 +821,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("THREAD_GROUP_SIZE", ThreadGroupSize);
         Macros.Finalize();
         auto pPrecomputeSingleSctrCS =
-            CreateShader(pDevice, "PrecomputeSingleScattering.fx", "PrecomputeSingleScatteringCS",
+            CreateShaderFromFile(pDevice, "PrecomputeSingleScattering.fx", "PrecomputeSingleScatteringCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -670,7 +838,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("NUM_RANDOM_SPHERE_SAMPLES", static_cast<Int32>(m_uiNumRandomSamplesOnSphere));
         Macros.Finalize();
         auto pComputeSctrRadianceCS =
-            CreateShader(pDevice, "ComputeSctrRadiance.fx", "ComputeSctrRadianceCS",
+            CreateShaderFromFile(pDevice, "ComputeSctrRadiance.fx", "ComputeSctrRadianceCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -686,7 +854,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("THREAD_GROUP_SIZE", ThreadGroupSize);
         Macros.Finalize();
         auto pComputeScatteringOrderCS =
-            CreateShader(pDevice, "ComputeScatteringOrder.fx", "ComputeScatteringOrderCS",
+            CreateShaderFromFile(pDevice, "ComputeScatteringOrder.fx", "ComputeScatteringOrderCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -702,7 +870,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("THREAD_GROUP_SIZE", ThreadGroupSize);
         Macros.Finalize();
         auto pInitHighOrderScatteringCS =
-            CreateShader(pDevice, "InitHighOrderScattering.fx", "InitHighOrderScatteringCS",
+            CreateShaderFromFile(pDevice, "InitHighOrderScattering.fx", "InitHighOrderScatteringCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -718,7 +886,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("THREAD_GROUP_SIZE", ThreadGroupSize);
         Macros.Finalize();
         auto pUpdateHighOrderScatteringCS =
-            CreateShader(pDevice, "UpdateHighOrderScattering.fx", "UpdateHighOrderScatteringCS",
+            CreateShaderFromFile(pDevice, "UpdateHighOrderScattering.fx", "UpdateHighOrderScatteringCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -734,7 +902,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         Macros.AddShaderMacro("THREAD_GROUP_SIZE", ThreadGroupSize);
         Macros.Finalize();
         auto pCombineScatteringOrdersCS =
-            CreateShader(pDevice, "CombineScatteringOrders.fx", "CombineScatteringOrdersCS",
+            CreateShaderFromFile(pDevice, "CombineScatteringOrders.fx", "CombineScatteringOrdersCS",
                          SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
@@ -765,10 +933,11 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
 
         // We have to bother with two texture, because HLSL only allows read-write operations on single
         // component textures
-        pDevice->CreateTexture(PrecomputedSctrTexDesc, nullptr, &m_ptex3DHighOrderSctr);
-        pDevice->CreateTexture(PrecomputedSctrTexDesc, nullptr, &m_ptex3DHighOrderSctr2);
-        m_ptex3DHighOrderSctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)->SetSampler(m_pLinearClampSampler);
-        m_ptex3DHighOrderSctr2->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)->SetSampler(m_pLinearClampSampler);
+        for (size_t i = 0; i < _countof(m_ptex3DHighOrderSctr); ++i)
+        {
+            pDevice->CreateTexture(PrecomputedSctrTexDesc, nullptr, &m_ptex3DHighOrderSctr[i]);
+            m_ptex3DHighOrderSctr[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)->SetSampler(m_pLinearClampSampler);
+        }
 
 
         pDevice->CreateTexture(PrecomputedSctrTexDesc, nullptr, &ptex3DMultipleSctr);
@@ -810,6 +979,12 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
     UpdateHighOrderScatteringTech.SRB->BindResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_UPDATE_ALL);
 
     const int iNumScatteringOrders = pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_GLES ? 3 : 4;
+    // High-order scattering textures are ping-ponged so that the last order is always written to
+    // m_ptex3DHighOrderSctr[0]. This keeps the look-up table the same object when the tables are
+    // recomputed, so that the shader resource bindings of the effects that share it remain valid.
+    auto GetHighOrderSctrDstIdx = [iNumScatteringOrders](int iSctrOrder) {
+        return (iNumScatteringOrders - 1 - iSctrOrder) % 2;
+    };
     for (int iSctrOrder = 1; iSctrOrder < iNumScatteringOrders; ++iSctrOrder)
     {
         // Step 1: compute differential in-scattering
@@ -826,7 +1001,9 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         ComputeScatteringOrderTech.SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DPointwiseSctrRadiance")->Set(ptex3DSctrRadianceSRV);
         ComputeScatteringOrderTech.DispatchCompute(pContext, DispatchAttrs);
 
-        RenderTechnique* pRenderTech = nullptr;
+        const int iDstIdx = GetHighOrderSctrDstIdx(iSctrOrder);
+
+        EpipolarLightScattering::RenderTechnique* pRenderTech = nullptr;
         // Step 3: accumulate high-order scattering scattering
         if (iSctrOrder == 1)
         {
@@ -835,10 +1012,9 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         else
         {
             pRenderTech = &m_RenderTech[RENDER_TECH_UPDATE_HIGH_ORDER_SCATTERING];
-            std::swap(m_ptex3DHighOrderSctr, m_ptex3DHighOrderSctr2);
-            pRenderTech->SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DHighOrderOrderScattering")->Set(m_ptex3DHighOrderSctr2->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+            pRenderTech->SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DHighOrderOrderScattering")->Set(m_ptex3DHighOrderSctr[1 - iDstIdx]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
         }
-        pRenderTech->SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_rwtex3DHighOrderSctr")->Set(m_ptex3DHighOrderSctr->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+        pRenderTech->SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_rwtex3DHighOrderSctr")->Set(m_ptex3DHighOrderSctr[iDstIdx]->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
         pRenderTech->SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DCurrentOrderScattering")->Set(ptex3DInsctrOrderSRV);
         pRenderTech->DispatchCompute(pContext, DispatchAttrs);
 
@@ -847,8 +1023,7 @@ void EpipolarLightScattering::PrecomputeScatteringLUT(IRenderDevice* pDevice, ID
         pContext->Flush();
     }
 
-    // Note that m_ptex3DHighOrderSctr and m_ptex3DHighOrderSctr2 are ping-ponged during pre-processing
-    m_ptex3DHighOrderScatteringSRV = m_ptex3DHighOrderSctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_ptex3DHighOrderScatteringSRV = m_ptex3DHighOrderSctr[0]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
     m_ptex3DHighOrderScatteringSRV->SetSampler(m_pLinearClampSampler);
     m_pResMapping->AddResource("g_tex3DHighOrderSctrLUT", m_ptex3DHighOrderScatteringSRV, false);
 
@@ -918,7 +1093,7 @@ void EpipolarLightScattering::CreateSliceUVDirAndOriginTexture(IRenderDevice* pD
     TexDesc.Type      = RESOURCE_DIM_TEX_2D;
     TexDesc.Width     = m_PostProcessingAttribs.uiNumEpipolarSlices;
     TexDesc.Height    = m_PostProcessingAttribs.iNumCascades;
-    TexDesc.Format    = SliceUVDirAndOriginTexFmt;
+    TexDesc.Format    = m_SliceUVDirAndOriginTexFmt;
     TexDesc.MipLevels = 1;
     TexDesc.Usage     = USAGE_DEFAULT;
     TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
@@ -953,6 +1128,169 @@ void EpipolarLightScattering::CreateCamSpaceZTexture(IRenderDevice* pDevice)
     m_pResMapping->AddResource("g_tex2DCamSpaceZ", tex2DCamSpaceZSRV, false);
 }
 
+void EpipolarLightScattering::CreateDownscaledInsctrTextures(IRenderDevice* pDevice)
+{
+    const auto DownscaleFactor = m_PostProcessingAttribs.uiBruteForceDownscaleFactor;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Downscaled Inscattering";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = (m_uiBackBufferWidth + DownscaleFactor - 1) / DownscaleFactor;
+    TexDesc.Height    = (m_uiBackBufferHeight + DownscaleFactor - 1) / DownscaleFactor;
+    TexDesc.Format    = DownscaledInsctrTexFmt;
+    TexDesc.MipLevels = 1;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> tex2DDownscaledInsctr;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex2DDownscaledInsctr);
+    m_ptex2DDownscaledInsctrRTV    = tex2DDownscaledInsctr->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    auto* tex2DDownscaledInsctrSRV = tex2DDownscaledInsctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex2DDownscaledInsctrSRV->SetSampler(m_pPointClampSampler);
+
+    TexDesc.Name   = "Downscaled Cam-space Z";
+    TexDesc.Format = DownscaledCamSpaceZFmt;
+
+    RefCntAutoPtr<ITexture> tex2DDownscaledCamSpaceZ;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex2DDownscaledCamSpaceZ);
+    m_ptex2DDownscaledCamSpaceZRTV    = tex2DDownscaledCamSpaceZ->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    auto* tex2DDownscaledCamSpaceZSRV = tex2DDownscaledCamSpaceZ->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex2DDownscaledCamSpaceZSRV->SetSampler(m_pPointClampSampler);
+
+    // clang-format off
+    m_pResMapping->AddResource("g_tex2DDownscaledInsctr",    tex2DDownscaledInsctrSRV,    false);
+    m_pResMapping->AddResource("g_tex2DDownscaledCamSpaceZ", tex2DDownscaledCamSpaceZSRV, false);
+    // clang-format on
+}
+
+void EpipolarLightScattering::CreateFroxelTextures(IRenderDevice* pDevice)
+{
+    TextureDesc TexDesc;
+    TexDesc.Type      = RESOURCE_DIM_TEX_3D;
+    TexDesc.Width     = m_PostProcessingAttribs.uiFroxelGridWidth;
+    TexDesc.Height    = m_PostProcessingAttribs.uiFroxelGridHeight;
+    TexDesc.Depth     = m_PostProcessingAttribs.uiFroxelGridDepth;
+    TexDesc.Format    = FroxelInsctrTexFmt;
+    TexDesc.MipLevels = 1;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_UNORDERED_ACCESS | BIND_SHADER_RESOURCE;
+
+    // Scattering of the current frame is written to one texture while the other one
+    // contains the history. The textures are swapped every frame.
+    for (Uint32 i = 0; i < _countof(m_ptex3DFroxelInsctrUAV); ++i)
+    {
+        TexDesc.Name = i == 0 ? "Froxel Inscattering 0" : "Froxel Inscattering 1";
+        RefCntAutoPtr<ITexture> tex3DFroxelInsctr;
+        pDevice->CreateTexture(TexDesc, nullptr, &tex3DFroxelInsctr);
+        m_ptex3DFroxelInsctrUAV[i] = tex3DFroxelInsctr->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+    }
+
+    TexDesc.Name = "Froxel Integrated Inscattering";
+    RefCntAutoPtr<ITexture> tex3DFroxelIntegratedInsctr;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex3DFroxelIntegratedInsctr);
+    m_ptex3DFroxelIntegratedInsctrUAV = tex3DFroxelIntegratedInsctr->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+
+    // clang-format off
+    m_pResMapping->AddResource("g_rwtex3DFroxelIntegratedInsctr", m_ptex3DFroxelIntegratedInsctrUAV,                                              false);
+    m_pResMapping->AddResource("g_tex3DFroxelIntegratedInsctr",   tex3DFroxelIntegratedInsctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), false);
+    // clang-format on
+
+    // New textures contain no valid history
+    m_bFroxelHistoryValid = false;
+}
+
+void EpipolarLightScattering::CreateSkyViewAndAerialPerspectiveTextures(IRenderDevice* pDevice)
+{
+    TextureDesc TexDesc;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = sm_uiSkyViewLUTWidth;
+    TexDesc.Height    = sm_uiSkyViewLUTHeight;
+    TexDesc.MipLevels = 1;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_UNORDERED_ACCESS | BIND_SHADER_RESOURCE;
+
+    TexDesc.Name   = "Sky View Inscattering";
+    TexDesc.Format = SkyViewInsctrTexFmt;
+    RefCntAutoPtr<ITexture> tex2DSkyViewInsctr;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex2DSkyViewInsctr);
+    m_ptex2DSkyViewInsctrUAV = tex2DSkyViewInsctr->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+    auto* tex2DSkyViewInsctrSRV = tex2DSkyViewInsctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex2DSkyViewInsctrSRV->SetSampler(m_pLinearClampSampler);
+
+    TexDesc.Name   = "Sky View Extinction";
+    TexDesc.Format = SkyViewExtinctionTexFmt;
+    RefCntAutoPtr<ITexture> tex2DSkyViewExtinction;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex2DSkyViewExtinction);
+    m_ptex2DSkyViewExtinctionUAV = tex2DSkyViewExtinction->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+    auto* tex2DSkyViewExtinctionSRV = tex2DSkyViewExtinction->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex2DSkyViewExtinctionSRV->SetSampler(m_pLinearClampSampler);
+
+    TexDesc.Type   = RESOURCE_DIM_TEX_3D;
+    TexDesc.Width  = m_PostProcessingAttribs.uiAerialPerspectiveLUTResolution;
+    TexDesc.Height = m_PostProcessingAttribs.uiAerialPerspectiveLUTResolution;
+    TexDesc.Depth  = m_PostProcessingAttribs.uiAerialPerspectiveLUTDepth;
+
+    TexDesc.Name   = "Aerial Perspective Inscattering";
+    TexDesc.Format = AerialPerspectiveInsctrTexFmt;
+    RefCntAutoPtr<ITexture> tex3DAerialPerspectiveInsctr;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex3DAerialPerspectiveInsctr);
+    m_ptex3DAerialPerspectiveInsctrUAV = tex3DAerialPerspectiveInsctr->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+    auto* tex3DAerialPerspectiveInsctrSRV = tex3DAerialPerspectiveInsctr->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex3DAerialPerspectiveInsctrSRV->SetSampler(m_pLinearClampSampler);
+
+    TexDesc.Name   = "Aerial Perspective Extinction";
+    TexDesc.Format = AerialPerspectiveExtinctionTexFmt;
+    RefCntAutoPtr<ITexture> tex3DAerialPerspectiveExtinction;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex3DAerialPerspectiveExtinction);
+    m_ptex3DAerialPerspectiveExtinctionUAV = tex3DAerialPerspectiveExtinction->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+    auto* tex3DAerialPerspectiveExtinctionSRV = tex3DAerialPerspectiveExtinction->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    tex3DAerialPerspectiveExtinctionSRV->SetSampler(m_pLinearClampSampler);
+
+    // clang-format off
+    m_pResMapping->AddResource("g_rwtex2DSkyViewInsctr",               m_ptex2DSkyViewInsctrUAV,               false);
+    m_pResMapping->AddResource("g_rwtex2DSkyViewExtinction",           m_ptex2DSkyViewExtinctionUAV,           false);
+    m_pResMapping->AddResource("g_rwtex3DAerialPerspectiveInsctr",     m_ptex3DAerialPerspectiveInsctrUAV,     false);
+    m_pResMapping->AddResource("g_rwtex3DAerialPerspectiveExtinction", m_ptex3DAerialPerspectiveExtinctionUAV, false);
+    m_pResMapping->AddResource("g_tex2DSkyViewInsctr",                 tex2DSkyViewInsctrSRV,                  false);
+    m_pResMapping->AddResource("g_tex2DSkyViewExtinction",             tex2DSkyViewExtinctionSRV,              false);
+    m_pResMapping->AddResource("g_tex3DAerialPerspectiveInsctr",       tex3DAerialPerspectiveInsctrSRV,        false);
+    m_pResMapping->AddResource("g_tex3DAerialPerspectiveExtinction",   tex3DAerialPerspectiveExtinctionSRV,    false);
+    // clang-format on
+}
+
+void EpipolarLightScattering::CreateSkyCubemap(IRenderDevice* pDevice)
+{
+    // Mip levels are required by the environment map filtering that samples
+    // coarser levels to reduce aliasing
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Sky Cubemap";
+    TexDesc.Type      = RESOURCE_DIM_TEX_CUBE;
+    TexDesc.Width     = sm_uiSkyCubemapDim;
+    TexDesc.Height    = sm_uiSkyCubemapDim;
+    TexDesc.ArraySize = 6;
+    TexDesc.MipLevels = 0;
+    TexDesc.Format    = SkyCubemapFmt;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_UNORDERED_ACCESS | BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+    TexDesc.MiscFlags = MISC_TEXTURE_FLAG_GENERATE_MIPS;
+    RefCntAutoPtr<ITexture> tex2DSkyCubemap;
+    pDevice->CreateTexture(TexDesc, nullptr, &tex2DSkyCubemap);
+
+    // The shader writes all faces of the most detailed mip level through a single array view
+    TextureViewDesc ViewDesc;
+    ViewDesc.Name            = "Sky Cubemap UAV";
+    ViewDesc.ViewType        = TEXTURE_VIEW_UNORDERED_ACCESS;
+    ViewDesc.TextureDim      = RESOURCE_DIM_TEX_2D_ARRAY;
+    ViewDesc.MostDetailedMip = 0;
+    ViewDesc.NumMipLevels    = 1;
+    ViewDesc.FirstArraySlice = 0;
+    ViewDesc.NumArraySlices  = 6;
+    ViewDesc.AccessFlags     = UAV_ACCESS_FLAG_WRITE;
+    tex2DSkyCubemap->CreateView(ViewDesc, &m_ptex2DSkyCubemapUAV);
+
+    m_pResMapping->AddResource("g_rwtex2DSkyCubemap", m_ptex2DSkyCubemapUAV, false);
+}
+
 void EpipolarLightScattering::ReconstructCameraSpaceZ()
 {
     // Depth buffer is non-linear and cannot be interpolated directly
@@ -1004,11 +1342,13 @@ void EpipolarLightScattering::RenderSliceEndpoints()
         ResourceLayout.Variables    = Vars;
         ResourceLayout.NumVariables = _countof(Vars);
         RendedSliceEndpointsTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "RenderSliceEndPoints", m_pFullScreenTriangleVS,
-                                                                       pRendedSliceEndpointsPS, ResourceLayout, SliceEndpointsFmt);
+                                                                       pRendedSliceEndpointsPS, ResourceLayout, m_SliceEndpointsFmt);
         // Bind static resources required by the shaders
         RendedSliceEndpointsTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
 
-        RendedSliceEndpointsTech.PSODependencyFlags = PSO_DEPENDENCY_OPTIMIZE_SAMPLE_LOCATIONS;
+        RendedSliceEndpointsTech.PSODependencyFlags =
+            PSO_DEPENDENCY_OPTIMIZE_SAMPLE_LOCATIONS |
+            PSO_DEPENDENCY_LOW_PRECISION_FORMATS;
         RendedSliceEndpointsTech.SRBDependencyFlags = 0;
     }
 
@@ -1038,13 +1378,13 @@ void EpipolarLightScattering::RenderCoordinateTexture()
         // clang-format on
         ResourceLayout.ImmutableSamplers     = ImtblSamplers;
         ResourceLayout.NumImmutableSamplers  = _countof(ImtblSamplers);
-        TEXTURE_FORMAT RTVFmts[]             = {CoordinateTexFmt, EpipolarCamSpaceZFmt};
+        TEXTURE_FORMAT RTVFmts[]             = {m_CoordinateTexFmt, EpipolarCamSpaceZFmt};
         auto           EpipolarImageDepthFmt = m_ptex2DEpipolarImageDSV->GetTexture()->GetDesc().Format;
         RendedCoordTexTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "RenderCoordinateTexture", m_pFullScreenTriangleVS,
                                                                  pRendedCoordTexPS, ResourceLayout, 2, RTVFmts, EpipolarImageDepthFmt, DSS_IncStencilAlways);
         RendedCoordTexTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
 
-        RendedCoordTexTech.PSODependencyFlags = 0;
+        RendedCoordTexTech.PSODependencyFlags = PSO_DEPENDENCY_LOW_PRECISION_FORMATS;
         RendedCoordTexTech.SRBDependencyFlags =
             SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
             SRB_DEPENDENCY_SLICE_END_POINTS_TEX;
@@ -1138,12 +1478,14 @@ void EpipolarLightScattering::RenderCoarseUnshadowedInctr()
         RenderCoarseUnshadowedInsctrTech.PSODependencyFlags =
             PSO_DEPENDENCY_EXTINCTION_EVAL_MODE |
             PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
-            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE;
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
         RenderCoarseUnshadowedInsctrTech.SRBDependencyFlags =
             SRB_DEPENDENCY_CAMERA_ATTRIBS |
             SRB_DEPENDENCY_LIGHT_ATTRIBS |
             SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
-            SRB_DEPENDENCY_COORDINATE_TEX;
+            SRB_DEPENDENCY_COORDINATE_TEX |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
     }
 
     if (m_PostProcessingAttribs.iExtinctionEvalMode == EXTINCTION_EVAL_MODE_EPIPOLAR &&
@@ -1181,18 +1523,36 @@ void EpipolarLightScattering::RefineSampleLocations()
         m_uiSampleRefinementCSThreadGroupSize = std::min(m_uiSampleRefinementCSThreadGroupSize, m_PostProcessingAttribs.uiMaxSamplesInSlice);
         // Using small group size is inefficient since a lot of SIMD lanes become idle
 
-        ShaderMacroHelper Macros;
-        DefineMacros(Macros);
-        // clang-format off
-        Macros.AddShaderMacro("INITIAL_SAMPLE_STEP",  static_cast<Int32>(m_PostProcessingAttribs.uiInitialSampleStepInSlice));
-        Macros.AddShaderMacro("THREAD_GROUP_SIZE",    static_cast<Int32>(m_uiSampleRefinementCSThreadGroupSize));
-        Macros.AddShaderMacro("REFINEMENT_CRITERION", m_PostProcessingAttribs.iRefinementCriterion);
-        Macros.AddShaderMacro("AUTO_EXPOSURE",        m_PostProcessingAttribs.ToneMapping.bAutoExposure);
-        // clang-format on
-        Macros.Finalize();
+        auto CreateRefineSampleLocationsCS = [&](bool bUseWaveOps) {
+            ShaderMacroHelper Macros;
+            DefineMacros(Macros);
+            // clang-format off
+            Macros.AddShaderMacro("INITIAL_SAMPLE_STEP",          static_cast<Int32>(m_PostProcessingAttribs.uiInitialSampleStepInSlice));
+            Macros.AddShaderMacro("THREAD_GROUP_SIZE",            static_cast<Int32>(m_uiSampleRefinementCSThreadGroupSize));
+            Macros.AddShaderMacro("REFINEMENT_CRITERION",         m_PostProcessingAttribs.iRefinementCriterion);
+            Macros.AddShaderMacro("AUTO_EXPOSURE",                m_PostProcessingAttribs.ToneMapping.bAutoExposure);
+            Macros.AddShaderMacro("COMPACT_RAY_MARCHING_SAMPLES", m_bCompactRayMarchingSamples);
+            Macros.AddShaderMacro("USE_WAVE_OPS",                 bUseWaveOps);
+            // clang-format on
+            Macros.Finalize();
+
+            return CreateShader(m_FrameAttribs.pDevice, "RefineSampleLocations.fx", "RefineSampleLocationsCS",
+                                SHADER_TYPE_COMPUTE, Macros, bUseWaveOps ? SHADER_COMPILER_DXC : SHADER_COMPILER_DEFAULT);
+        };
 
-        auto pRefineSampleLocationsCS = CreateShader(m_FrameAttribs.pDevice, "RefineSampleLocations.fx", "RefineSampleLocationsCS",
-                                                     SHADER_TYPE_COMPUTE, Macros);
+        RefCntAutoPtr<IShader> pRefineSampleLocationsCS;
+        if (m_bUseWaveOpsInSampleRefinement)
+        {
+            pRefineSampleLocationsCS = CreateRefineSampleLocationsCS(true);
+            if (!pRefineSampleLocationsCS)
+            {
+                // DXC may not be available at run time
+                LOG_WARNING_MESSAGE("Failed to create wave intrinsic variant of the sample refinement shader. Falling back to the default implementation.");
+                m_bUseWaveOpsInSampleRefinement = false;
+            }
+        }
+        if (!pRefineSampleLocationsCS)
+            pRefineSampleLocationsCS = CreateRefineSampleLocationsCS(false);
 
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
@@ -1211,13 +1571,22 @@ void EpipolarLightScattering::RefineSampleLocations()
         RefineSampleLocationsTech.PSODependencyFlags =
             PSO_DEPENDENCY_INITIAL_SAMPLE_STEP |
             PSO_DEPENDENCY_REFINEMENT_CRITERION |
-            PSO_DEPENDENCY_AUTO_EXPOSURE;
+            PSO_DEPENDENCY_AUTO_EXPOSURE |
+            PSO_DEPENDENCY_COMPACT_RAY_MARCHING;
         RefineSampleLocationsTech.SRBDependencyFlags =
             SRB_DEPENDENCY_INTERPOLATION_SOURCE_TEX |
             SRB_DEPENDENCY_COORDINATE_TEX |
             SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
             SRB_DEPENDENCY_EPIPOLAR_INSCTR_TEX |
-            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX;
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_RAY_MARCHING_SAMPLE_LIST;
+    }
+
+    if (m_bCompactRayMarchingSamples)
+    {
+        // Reset the number of samples in the compacted list
+        const Uint32 Zero = 0;
+        m_FrameAttribs.pDeviceContext->UpdateBuffer(m_pbufRayMarchingSampleCounter, 0, sizeof(Zero), &Zero, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
     }
 
     RefineSampleLocationsTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
@@ -1285,9 +1654,10 @@ void EpipolarLightScattering::RenderSliceUVDirAndOrig()
 
         RenderSliceUVDirInSMTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "RenderSliceUVDirAndOrigin",
                                                                        m_pFullScreenTriangleVS, pRenderSliceUVDirInSMPS,
-                                                                       ResourceLayout, SliceUVDirAndOriginTexFmt);
+                                                                       ResourceLayout, m_SliceUVDirAndOriginTexFmt);
         RenderSliceUVDirInSMTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
 
+        RenderSliceUVDirInSMTech.PSODependencyFlags = PSO_DEPENDENCY_LOW_PRECISION_FORMATS;
         RenderSliceUVDirInSMTech.SRBDependencyFlags =
             SRB_DEPENDENCY_CAMERA_ATTRIBS |
             SRB_DEPENDENCY_LIGHT_ATTRIBS |
@@ -1403,7 +1773,8 @@ void EpipolarLightScattering::Build1DMinMaxMipMap(int iCascadeIndex)
     auto tex2DMinMaxShadowMap0 = m_ptex2DMinMaxShadowMapRTV[0]->GetTexture();
     auto tex2DMinMaxShadowMap1 = m_ptex2DMinMaxShadowMapRTV[1]->GetTexture();
 
-    // Computing min/max mip map using compute shader is much slower because a lot of threads are idle
+    // Every level of the tree is rendered by a separate draw call. This path is used when the tree
+    // cannot be built by the compute shader (see Build1DMinMaxMipMapCS())
     Uint32 uiXOffset     = 0;
     Uint32 uiPrevXOffset = 0;
     Uint32 uiParity      = 0;
@@ -1473,62 +1844,138 @@ void EpipolarLightScattering::Build1DMinMaxMipMap(int iCascadeIndex)
     }
 }
 
-void EpipolarLightScattering::DoRayMarching(Uint32 uiMaxStepsAlongRay,
-                                            int    iCascadeIndex)
+void EpipolarLightScattering::Build1DMinMaxMipMapCS(int iCascadeIndex)
 {
-    auto& DoRayMarchTech = m_RenderTech[m_PostProcessingAttribs.bUse1DMinMaxTree ? RENDER_TECH_RAY_MARCH_MIN_MAX_OPT : RENDER_TECH_RAY_MARCH_NO_MIN_MAX_OPT];
-    if (!DoRayMarchTech.PSO)
+    auto& BuildMinMaxShadowMapTech = m_RenderTech[RENDER_TECH_BUILD_MIN_MAX_SHADOW_MAP];
+    if (!BuildMinMaxShadowMapTech.PSO)
     {
         ShaderMacroHelper Macros;
         DefineMacros(Macros);
-        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", m_PostProcessingAttribs.iCascadeProcessingMode);
-        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE", m_PostProcessingAttribs.bUse1DMinMaxTree);
+        // clang-format off
+        Macros.AddShaderMacro("IS_32BIT_MIN_MAX_MAP",          m_PostProcessingAttribs.bIs32BitMinMaxMipMap);
+        Macros.AddShaderMacro("MIN_MAX_SHADOW_MAP_RESOLUTION", static_cast<Int32>(m_PostProcessingAttribs.uiMinMaxShadowMapResolution));
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE",             static_cast<Int32>(sm_uiMinMaxTreeCSThreadGroupSize));
+        // clang-format on
         Macros.Finalize();
 
-        auto pDoRayMarchPS =
-            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "RayMarchPS", SHADER_TYPE_PIXEL, Macros);
+        auto pBuildMinMaxShadowMapCS = CreateShader(m_FrameAttribs.pDevice, "BuildMinMaxShadowMap.fx", "BuildMinMaxShadowMapCS",
+                                                    SHADER_TYPE_COMPUTE, Macros);
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
-        std::vector<ShaderResourceVariableDesc> Vars;
-        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
-
-        std::unordered_set<std::string> ResourceNames;
-
-        const auto ResCount = pDoRayMarchPS->GetResourceCount();
-        for (Uint32 r = 0; r < ResCount; ++r)
+        // clang-format off
+        ShaderResourceVariableDesc Vars[] =
         {
-            ShaderResourceDesc ResourceDesc;
-            pDoRayMarchPS->GetResourceDesc(r, ResourceDesc);
-            ResourceNames.emplace(ResourceDesc.Name);
-        }
+            {SHADER_TYPE_COMPUTE, "cbPostProcessingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_COMPUTE, "cbMiscDynamicParams",     SHADER_RESOURCE_VARIABLE_TYPE_STATIC}
+        };
 
-        // clang-format off
-        const std::array<std::string, 4> StaticLinearTextures =
+        ImmutableSamplerDesc ImtblSamplers[] =
         {
-            "g_tex3DSingleSctrLUT",
-            "g_tex3DHighOrderSctrLUT",
-            "g_tex3DMultipleSctrLUT",
-            "g_tex2DOccludedNetDensityToAtmTop"
+            {SHADER_TYPE_COMPUTE, "g_tex2DLightSpaceDepthMap", Sam_LinearClamp} // Linear, not comparison
         };
         // clang-format on
-        for (const auto& Tex : StaticLinearTextures)
+
+        ResourceLayout.Variables            = Vars;
+        ResourceLayout.NumVariables         = m_bUseCombinedMinMaxTexture ? 1 : _countof(Vars);
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+        ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
+
+        BuildMinMaxShadowMapTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "BuildMinMaxShadowMap", pBuildMinMaxShadowMapCS, ResourceLayout);
+        BuildMinMaxShadowMapTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        BuildMinMaxShadowMapTech.PSODependencyFlags =
+            PSO_DEPENDENCY_USE_1D_MIN_MAX_TREE |
+            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
+            PSO_DEPENDENCY_IS_32_BIT_MIN_MAX_TREE |
+            PSO_DEPENDENCY_MIN_MAX_SHADOW_MAP_RES;
+        BuildMinMaxShadowMapTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_SLICE_UV_DIR_TEX |
+            SRB_DEPENDENCY_SHADOW_MAP |
+            SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP;
+    }
+
+    if (!m_bUseCombinedMinMaxTexture)
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fCascadeInd = static_cast<float>(iCascadeIndex);
+    }
+
+    auto iMinMaxTexHeight = m_PostProcessingAttribs.uiNumEpipolarSlices;
+    if (m_bUseCombinedMinMaxTexture)
+        iMinMaxTexHeight *= (m_PostProcessingAttribs.iNumCascades - m_PostProcessingAttribs.iFirstCascadeToRayMarch);
+
+    // Every thread group builds all levels of the tree for one row of the min/max shadow map
+    BuildMinMaxShadowMapTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
+    DispatchComputeAttribs DispatchAttrs{1, iMinMaxTexHeight};
+    BuildMinMaxShadowMapTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchAttrs);
+}
+
+// Ray marching shaders use different sets of resources depending on the scattering
+// modes, so the layout is built from the resources the shader actually uses
+static void InitRayMarchingResourceLayout(IShader*                                 pRayMarchShader,
+                                          SHADER_TYPE                              ShaderType,
+                                          std::vector<ShaderResourceVariableDesc>& Vars,
+                                          std::vector<ImmutableSamplerDesc>&       ImtblSamplers)
+{
+    std::unordered_set<std::string> ResourceNames;
+
+    const auto ResCount = pRayMarchShader->GetResourceCount();
+    for (Uint32 r = 0; r < ResCount; ++r)
+    {
+        ShaderResourceDesc ResourceDesc;
+        pRayMarchShader->GetResourceDesc(r, ResourceDesc);
+        ResourceNames.emplace(ResourceDesc.Name);
+    }
+
+    // clang-format off
+    const std::array<std::string, 4> StaticLinearTextures =
+    {
+        "g_tex3DSingleSctrLUT",
+        "g_tex3DHighOrderSctrLUT",
+        "g_tex3DMultipleSctrLUT",
+        "g_tex2DOccludedNetDensityToAtmTop"
+    };
+    // clang-format on
+    for (const auto& Tex : StaticLinearTextures)
+    {
+        if (ResourceNames.find(Tex) != ResourceNames.end())
         {
-            if (ResourceNames.find(Tex) != ResourceNames.end())
-            {
-                Vars.emplace_back(SHADER_TYPE_PIXEL, Tex.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-                ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, Tex.c_str(), Sam_LinearClamp);
-            }
+            Vars.emplace_back(ShaderType, Tex.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+            ImtblSamplers.emplace_back(ShaderType, Tex.c_str(), Sam_LinearClamp);
         }
+    }
 
-        if (ResourceNames.find("cbParticipatingMediaScatteringParams") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbParticipatingMediaScatteringParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-        if (ResourceNames.find("cbPostProcessingAttribs") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbPostProcessingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-        if (ResourceNames.find("cbMiscDynamicParams") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbMiscDynamicParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    if (ResourceNames.find("cbParticipatingMediaScatteringParams") != ResourceNames.end())
+        Vars.emplace_back(ShaderType, "cbParticipatingMediaScatteringParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    if (ResourceNames.find("cbPostProcessingAttribs") != ResourceNames.end())
+        Vars.emplace_back(ShaderType, "cbPostProcessingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    if (ResourceNames.find("cbMiscDynamicParams") != ResourceNames.end())
+        Vars.emplace_back(ShaderType, "cbMiscDynamicParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
 
-        if (ResourceNames.find("g_tex2DCamSpaceZ") != ResourceNames.end())
-            ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_tex2DCamSpaceZ", Sam_LinearClamp);
+    if (ResourceNames.find("g_tex2DCamSpaceZ") != ResourceNames.end())
+        ImtblSamplers.emplace_back(ShaderType, "g_tex2DCamSpaceZ", Sam_LinearClamp);
+}
+
+void EpipolarLightScattering::DoRayMarching(Uint32 uiMaxStepsAlongRay,
+                                            int    iCascadeIndex)
+{
+    auto& DoRayMarchTech = m_RenderTech[m_PostProcessingAttribs.bUse1DMinMaxTree ? RENDER_TECH_RAY_MARCH_MIN_MAX_OPT : RENDER_TECH_RAY_MARCH_NO_MIN_MAX_OPT];
+    if (!DoRayMarchTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", m_PostProcessingAttribs.iCascadeProcessingMode);
+        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE", m_PostProcessingAttribs.bUse1DMinMaxTree);
+        Macros.Finalize();
+
+        auto pDoRayMarchPS =
+            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "RayMarchPS", SHADER_TYPE_PIXEL, Macros);
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+
+        InitRayMarchingResourceLayout(pDoRayMarchPS, SHADER_TYPE_PIXEL, Vars, ImtblSamplers);
 
         ResourceLayout.Variables            = Vars.data();
         ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
@@ -1547,7 +1994,8 @@ void EpipolarLightScattering::DoRayMarching(Uint32 uiMaxStepsAlongRay,
             PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
             PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
             PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
-            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE;
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
 
         DoRayMarchTech.SRBDependencyFlags =
             SRB_DEPENDENCY_CAMERA_ATTRIBS |
@@ -1559,7 +2007,8 @@ void EpipolarLightScattering::DoRayMarching(Uint32 uiMaxStepsAlongRay,
             SRB_DEPENDENCY_COORDINATE_TEX |
             SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
             SRB_DEPENDENCY_SRC_COLOR_BUFFER |
-            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX;
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
     }
 
     {
@@ -1596,6 +2045,94 @@ void EpipolarLightScattering::DoRayMarching(Uint32 uiMaxStepsAlongRay,
     DoRayMarchTech.Render(m_FrameAttribs.pDeviceContext, 2, iNumInst);
 }
 
+void EpipolarLightScattering::RayMarchCompactedSamples(Uint32 uiMaxStepsAlongRay,
+                                                       int    iCascadeIndex)
+{
+    auto& DispatchArgsTech = m_RenderTech[RENDER_TECH_COMPUTE_RAY_MARCHING_DISPATCH_ARGS];
+    if (!DispatchArgsTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("RAY_MARCH_THREAD_GROUP_SIZE", static_cast<Int32>(sm_uiRayMarchCSThreadGroupSize));
+        Macros.Finalize();
+
+        auto pDispatchArgsCS = CreateShader(m_FrameAttribs.pDevice, "ComputeRayMarchingDispatchArgs.fx", "ComputeRayMarchingDispatchArgsCS",
+                                            SHADER_TYPE_COMPUTE, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        DispatchArgsTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "ComputeRayMarchingDispatchArgs", pDispatchArgsCS, ResourceLayout);
+
+        DispatchArgsTech.SRBDependencyFlags = SRB_DEPENDENCY_RAY_MARCHING_SAMPLE_LIST;
+    }
+
+    auto& RayMarchTech = m_RenderTech[m_PostProcessingAttribs.bUse1DMinMaxTree ? RENDER_TECH_RAY_MARCH_COMPACTED_MIN_MAX_OPT : RENDER_TECH_RAY_MARCH_COMPACTED_NO_MIN_MAX_OPT];
+    if (!RayMarchTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", m_PostProcessingAttribs.iCascadeProcessingMode);
+        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE", m_PostProcessingAttribs.bUse1DMinMaxTree);
+        Macros.AddShaderMacro("COMPACT_RAY_MARCHING_SAMPLES", true);
+        Macros.AddShaderMacro("RAY_MARCH_THREAD_GROUP_SIZE", static_cast<Int32>(sm_uiRayMarchCSThreadGroupSize));
+        Macros.Finalize();
+
+        auto pRayMarchCS =
+            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "RayMarchCompactedSamplesCS", SHADER_TYPE_COMPUTE, Macros);
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+
+        InitRayMarchingResourceLayout(pRayMarchCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        RayMarchTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "RayMarchCompactedSamples", pRayMarchCS, ResourceLayout);
+        RayMarchTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        RayMarchTech.PSODependencyFlags =
+            PSO_DEPENDENCY_USE_1D_MIN_MAX_TREE |
+            PSO_DEPENDENCY_CASCADE_PROCESSING_MODE |
+            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
+            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+
+        RayMarchTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_SLICE_UV_DIR_TEX |
+            SRB_DEPENDENCY_SHADOW_MAP |
+            SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP |
+            SRB_DEPENDENCY_COORDINATE_TEX |
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_SRC_COLOR_BUFFER |
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_INITIAL_SCTR_LIGHT_TEX |
+            SRB_DEPENDENCY_RAY_MARCHING_SAMPLE_LIST |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+    }
+
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fMaxStepsAlongRay = static_cast<float>(uiMaxStepsAlongRay);
+        pMiscDynamicParams->fCascadeInd       = static_cast<float>(iCascadeIndex);
+    }
+
+    // Compute the number of thread groups required to process all samples in the list
+    DispatchArgsTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
+    DispatchArgsTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchComputeAttribs{1, 1});
+
+    // Ray march only the samples selected by the refinement pass
+    RayMarchTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
+    RayMarchTech.DispatchComputeIndirect(m_FrameAttribs.pDeviceContext, m_pbufRayMarchingDispatchArgs);
+}
+
 void EpipolarLightScattering::InterpolateInsctrIrradiance()
 {
     auto& InterpolateIrradianceTech = m_RenderTech[RENDER_TECH_INTERPOLATE_IRRADIANCE];
@@ -1641,7 +2178,9 @@ void EpipolarLightScattering::UnwarpEpipolarScattering(bool bRenderLuminance)
         SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP |
         SRB_DEPENDENCY_SHADOW_MAP |
         SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
-        SRB_DEPENDENCY_EPIPOLAR_EXTINCTION_TEX;
+        SRB_DEPENDENCY_TONE_MAPPING_LUT |
+        SRB_DEPENDENCY_EPIPOLAR_EXTINCTION_TEX |
+        SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
 
     auto& UnwarpEpipolarSctrImgTech = m_RenderTech[RENDER_TECH_UNWARP_EPIPOLAR_SCATTERING];
     if (!UnwarpEpipolarSctrImgTech.PSO)
@@ -1652,6 +2191,7 @@ void EpipolarLightScattering::UnwarpEpipolarScattering(bool bRenderLuminance)
         Macros.AddShaderMacro("PERFORM_TONE_MAPPING",                 true);
         Macros.AddShaderMacro("AUTO_EXPOSURE",                        m_PostProcessingAttribs.ToneMapping.bAutoExposure);
         Macros.AddShaderMacro("TONE_MAPPING_MODE",                    m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
+        Macros.AddShaderMacro("USE_TONE_MAPPING_LUT",                 m_bUseToneMappingLUT);
         Macros.AddShaderMacro("CORRECT_INSCATTERING_AT_DEPTH_BREAKS", m_PostProcessingAttribs.bCorrectScatteringAtDepthBreaks);
         // clang-format on
         Macros.Finalize();
@@ -1693,8 +2233,10 @@ void EpipolarLightScattering::UnwarpEpipolarScattering(bool bRenderLuminance)
         UnwarpEpipolarSctrImgTech.PSODependencyFlags =
             PSO_DEPENDENCY_AUTO_EXPOSURE |
             PSO_DEPENDENCY_TONE_MAPPING_MODE |
+            PSO_DEPENDENCY_TONE_MAPPING_LUT |
             PSO_DEPENDENCY_CORRECT_SCATTERING |
-            PSO_DEPENDENCY_EXTINCTION_EVAL_MODE;
+            PSO_DEPENDENCY_EXTINCTION_EVAL_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
 
         UnwarpEpipolarSctrImgTech.SRBDependencyFlags = SRBDependencies;
     }
@@ -1745,213 +2287,778 @@ void EpipolarLightScattering::UnwarpEpipolarScattering(bool bRenderLuminance)
                                                                            ResourceLayout, WeightedLogLumTexFmt);
         UnwarpAndRenderLuminanceTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_UPDATE_ALL);
 
-        UnwarpAndRenderLuminanceTech.PSODependencyFlags = PSO_DEPENDENCY_EXTINCTION_EVAL_MODE;
+        UnwarpAndRenderLuminanceTech.PSODependencyFlags = PSO_DEPENDENCY_EXTINCTION_EVAL_MODE | PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
         UnwarpAndRenderLuminanceTech.SRBDependencyFlags = SRBDependencies;
     }
 
-    // Unwarp inscattering image and apply it to attenuated background
-    if (bRenderLuminance)
-    {
-        UnwarpAndRenderLuminanceTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    // Unwarp inscattering image and apply it to attenuated background
+    if (bRenderLuminance)
+    {
+        UnwarpAndRenderLuminanceTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+
+        // Disable depth testing - we need to render the entire image in low resolution
+        UnwarpAndRenderLuminanceTech.Render(m_FrameAttribs.pDeviceContext);
+    }
+    else
+    {
+        UnwarpEpipolarSctrImgTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+
+        // Enable depth testing to write 0.0 to the depth buffer. All pixel that require
+        // inscattering correction (if enabled) will be discarded, so that 1.0 will be retained
+        // This 1.0 will then be used to perform inscattering correction
+        UnwarpEpipolarSctrImgTech.Render(m_FrameAttribs.pDeviceContext);
+    }
+}
+
+void EpipolarLightScattering::UpdateAverageLuminance()
+{
+    auto& UpdateAverageLuminanceTech = m_RenderTech[RENDER_TECH_UPDATE_AVERAGE_LUMINANCE];
+    if (!UpdateAverageLuminanceTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("LIGHT_ADAPTATION", m_PostProcessingAttribs.ToneMapping.bLightAdaptation);
+        // static_cast<int>() is required because Run() gets its arguments by reference
+        // and gcc will try to find reference to sm_iLowResLuminanceMips, which does not exist
+        Macros.AddShaderMacro("LOW_RES_LUMINANCE_MIPS", static_cast<int>(sm_iLowResLuminanceMips));
+        Macros.Finalize();
+
+        auto pUpdateAverageLuminancePS = CreateShader(m_FrameAttribs.pDevice, "UpdateAverageLuminance.fx", "UpdateAverageLuminancePS",
+                                                      SHADER_TYPE_PIXEL, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        // clang-format off
+        ShaderResourceVariableDesc Vars[] =
+        {
+            {SHADER_TYPE_PIXEL, "cbMiscDynamicParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC}
+        };
+        // clang-format on
+
+        if (m_PostProcessingAttribs.ToneMapping.bLightAdaptation)
+        {
+            ResourceLayout.Variables    = Vars;
+            ResourceLayout.NumVariables = _countof(Vars);
+        }
+        UpdateAverageLuminanceTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "UpdateAverageLuminance",
+                                                                         m_pFullScreenTriangleVS, pUpdateAverageLuminancePS,
+                                                                         ResourceLayout, AverageLuminanceTexFmt, TEX_FORMAT_UNKNOWN,
+                                                                         DSS_DisableDepth, BS_AlphaBlend);
+        UpdateAverageLuminanceTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        UpdateAverageLuminanceTech.PSODependencyFlags = PSO_DEPENDENCY_LIGHT_ADAPTATION;
+    }
+
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fElapsedTime = (float)m_FrameAttribs.dElapsedTime;
+    }
+
+    UpdateAverageLuminanceTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
+
+    ITextureView* ppRTVs[] = {m_ptex2DAverageLuminanceRTV};
+    m_FrameAttribs.pDeviceContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    UpdateAverageLuminanceTech.Render(m_FrameAttribs.pDeviceContext);
+}
+
+
+void EpipolarLightScattering::FixInscatteringAtDepthBreaks(Uint32               uiMaxStepsAlongRay,
+                                                           EFixInscatteringMode Mode)
+{
+    auto& FixInsctrAtDepthBreaksTech = m_RenderTech[RENDER_TECH_FIX_INSCATTERING_LUM_ONLY + static_cast<int>(Mode)];
+    if (!FixInsctrAtDepthBreaksTech.PSO)
+    {
+        bool              bRenderLuminance = Mode == EFixInscatteringMode::LuminanceOnly;
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        // clang-format off
+        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", CASCADE_PROCESSING_MODE_SINGLE_PASS);
+        Macros.AddShaderMacro("PERFORM_TONE_MAPPING",    !bRenderLuminance);
+        Macros.AddShaderMacro("AUTO_EXPOSURE",           m_PostProcessingAttribs.ToneMapping.bAutoExposure);
+        Macros.AddShaderMacro("TONE_MAPPING_MODE",       m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
+        Macros.AddShaderMacro("USE_TONE_MAPPING_LUT",    m_bUseToneMappingLUT);
+        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE",     false);
+        // clang-format on
+        Macros.Finalize();
+
+        auto pFixInsctrAtDepthBreaksPS =
+            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "FixAndApplyInscatteredRadiancePS",
+                         SHADER_TYPE_PIXEL, Macros);
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pFixInsctrAtDepthBreaksPS, SHADER_TYPE_PIXEL, Vars, ImtblSamplers);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        if (Mode == EFixInscatteringMode::LuminanceOnly)
+        {
+            // Luminance Only
+            // Disable depth and stencil tests to render all pixels
+            // Use default blend state to overwrite old luminance values
+            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaksLumOnly",
+                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
+                                                                             ResourceLayout, WeightedLogLumTexFmt);
+        }
+        else if (Mode == EFixInscatteringMode::FixInscattering)
+        {
+            // Fix Inscattering
+            // Depth breaks are marked with 1.0 in depth, so we enable depth test
+            // to render only pixels that require correction
+            // Use default blend state - the rendering is always done in single pass
+            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaks",
+                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
+                                                                             ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_Default);
+        }
+        else if (Mode == EFixInscatteringMode::FullScreenRayMarching)
+        {
+            // Full Screen Ray Marching
+            // Disable depth and stencil tests since we are performing
+            // full screen ray marching
+            // Use default blend state - the rendering is always done in single pass
+            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaks",
+                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
+                                                                             ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_DisableDepth);
+        }
+        FixInsctrAtDepthBreaksTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+
+        FixInsctrAtDepthBreaksTech.PSODependencyFlags =
+            PSO_DEPENDENCY_CASCADE_PROCESSING_MODE |
+            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
+            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_AUTO_EXPOSURE |
+            PSO_DEPENDENCY_TONE_MAPPING_MODE |
+            PSO_DEPENDENCY_TONE_MAPPING_LUT |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+
+        FixInsctrAtDepthBreaksTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_SLICE_UV_DIR_TEX |
+            SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP |
+            SRB_DEPENDENCY_COORDINATE_TEX |
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_SRC_COLOR_BUFFER |
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_TONE_MAPPING_LUT |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+    }
+
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fMaxStepsAlongRay = static_cast<float>(uiMaxStepsAlongRay);
+        pMiscDynamicParams->fCascadeInd       = static_cast<float>(m_PostProcessingAttribs.iFirstCascadeToRayMarch);
+    }
+
+    FixInsctrAtDepthBreaksTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+
+    FixInsctrAtDepthBreaksTech.Render(m_FrameAttribs.pDeviceContext);
+}
+
+void EpipolarLightScattering::UnwarpAndFixInscatteringCS()
+{
+    auto& UnwarpAndFixInsctrTech = m_RenderTech[RENDER_TECH_UNWARP_AND_FIX_INSCATTERING];
+    if (!UnwarpAndFixInsctrTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        // clang-format off
+        Macros.AddShaderMacro("UNWARP_AND_FIX_INSCATTERING",          true);
+        Macros.AddShaderMacro("UNWARP_THREAD_GROUP_SIZE",             static_cast<int>(sm_uiUnwarpCSThreadGroupSize));
+        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE",              CASCADE_PROCESSING_MODE_SINGLE_PASS);
+        Macros.AddShaderMacro("PERFORM_TONE_MAPPING",                 true);
+        Macros.AddShaderMacro("AUTO_EXPOSURE",                        m_PostProcessingAttribs.ToneMapping.bAutoExposure);
+        Macros.AddShaderMacro("TONE_MAPPING_MODE",                    m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
+        Macros.AddShaderMacro("USE_TONE_MAPPING_LUT",                 m_bUseToneMappingLUT);
+        Macros.AddShaderMacro("CORRECT_INSCATTERING_AT_DEPTH_BREAKS", m_PostProcessingAttribs.bCorrectScatteringAtDepthBreaks);
+        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE",                  false);
+        // clang-format on
+        Macros.Finalize();
+
+        auto pUnwarpAndFixInsctrCS = CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "UnwarpAndFixInscatteringCS",
+                                                  SHADER_TYPE_COMPUTE, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pUnwarpAndFixInsctrCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
+        // clang-format off
+        ImtblSamplers.emplace_back(SHADER_TYPE_COMPUTE, "g_tex2DSliceEndPoints",    Sam_LinearClamp);
+        ImtblSamplers.emplace_back(SHADER_TYPE_COMPUTE, "g_tex2DEpipolarCamSpaceZ", Sam_LinearClamp);
+        ImtblSamplers.emplace_back(SHADER_TYPE_COMPUTE, "g_tex2DScatteredColor",    Sam_LinearClamp);
+        // clang-format on
+        if (m_PostProcessingAttribs.iExtinctionEvalMode == EXTINCTION_EVAL_MODE_EPIPOLAR)
+            ImtblSamplers.emplace_back(SHADER_TYPE_COMPUTE, "g_tex2DEpipolarExtinction", Sam_LinearClamp);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        UnwarpAndFixInsctrTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "UnwarpAndFixInscattering", pUnwarpAndFixInsctrCS, ResourceLayout);
+        UnwarpAndFixInsctrTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        UnwarpAndFixInsctrTech.PSODependencyFlags =
+            PSO_DEPENDENCY_CASCADE_PROCESSING_MODE |
+            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
+            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_AUTO_EXPOSURE |
+            PSO_DEPENDENCY_TONE_MAPPING_MODE |
+            PSO_DEPENDENCY_TONE_MAPPING_LUT |
+            PSO_DEPENDENCY_CORRECT_SCATTERING |
+            PSO_DEPENDENCY_EXTINCTION_EVAL_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+
+        UnwarpAndFixInsctrTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_SRC_COLOR_BUFFER |
+            SRB_DEPENDENCY_DST_COLOR_BUFFER |
+            SRB_DEPENDENCY_SLICE_END_POINTS_TEX |
+            SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_EPIPOLAR_INSCTR_TEX |
+            SRB_DEPENDENCY_EPIPOLAR_EXTINCTION_TEX |
+            SRB_DEPENDENCY_SLICE_UV_DIR_TEX |
+            SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP |
+            SRB_DEPENDENCY_SHADOW_MAP |
+            SRB_DEPENDENCY_COORDINATE_TEX |
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_TONE_MAPPING_LUT |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+    }
+
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fMaxStepsAlongRay = static_cast<float>(m_PostProcessingAttribs.uiNumSamplesOnTheRayAtDepthBreak);
+        pMiscDynamicParams->fCascadeInd       = static_cast<float>(m_PostProcessingAttribs.iFirstCascadeToRayMarch);
+    }
+
+    UnwarpAndFixInsctrTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    DispatchComputeAttribs DispatchAttrs{
+        (m_uiBackBufferWidth + sm_uiUnwarpCSThreadGroupSize - 1) / sm_uiUnwarpCSThreadGroupSize,
+        (m_uiBackBufferHeight + sm_uiUnwarpCSThreadGroupSize - 1) / sm_uiUnwarpCSThreadGroupSize};
+    UnwarpAndFixInsctrTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchAttrs);
+}
+
+void EpipolarLightScattering::RayMarchDownscaled(Uint32 uiMaxStepsAlongRay)
+{
+    auto& RayMarchDownscaledTech = m_RenderTech[RENDER_TECH_RAY_MARCH_DOWNSCALED];
+    if (!RayMarchDownscaledTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        // clang-format off
+        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", CASCADE_PROCESSING_MODE_SINGLE_PASS);
+        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE",     false);
+        // clang-format on
+        Macros.Finalize();
+
+        auto pRayMarchDownscaledPS =
+            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "RayMarchDownscaledPS",
+                         SHADER_TYPE_PIXEL, Macros);
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pRayMarchDownscaledPS, SHADER_TYPE_PIXEL, Vars, ImtblSamplers);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        // Disable depth and stencil tests since every downscaled pixel is ray marched
+        TEXTURE_FORMAT RTVFmts[] = {DownscaledInsctrTexFmt, DownscaledCamSpaceZFmt};
+        RayMarchDownscaledTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "RayMarchDownscaled", m_pFullScreenTriangleVS,
+                                                                     pRayMarchDownscaledPS, ResourceLayout, 2, RTVFmts, TEX_FORMAT_UNKNOWN,
+                                                                     DSS_DisableDepth, BS_Default);
+        RayMarchDownscaledTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        RayMarchDownscaledTech.PSODependencyFlags =
+            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
+            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+
+        RayMarchDownscaledTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_SHADOW_MAP |
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+    }
+
+    {
+        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
+        pMiscDynamicParams->fMaxStepsAlongRay = static_cast<float>(uiMaxStepsAlongRay);
+        pMiscDynamicParams->fCascadeInd       = static_cast<float>(m_PostProcessingAttribs.iFirstCascadeToRayMarch);
+    }
+
+    RayMarchDownscaledTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+
+    ITextureView* ppRTVs[] = {m_ptex2DDownscaledInsctrRTV, m_ptex2DDownscaledCamSpaceZRTV};
+    m_FrameAttribs.pDeviceContext->SetRenderTargets(_countof(ppRTVs), ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    RayMarchDownscaledTech.Render(m_FrameAttribs.pDeviceContext);
+}
+
+void EpipolarLightScattering::UpsampleInscattering(bool bRenderLuminance)
+{
+    auto& UpsampleInsctrTech = m_RenderTech[bRenderLuminance ? RENDER_TECH_UPSAMPLE_AND_RENDER_LUMINANCE : RENDER_TECH_UPSAMPLE_INSCATTERING];
+    if (!UpsampleInsctrTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        // clang-format off
+        Macros.AddShaderMacro("PERFORM_TONE_MAPPING", !bRenderLuminance);
+        if (!bRenderLuminance)
+        {
+            Macros.AddShaderMacro("AUTO_EXPOSURE",        m_PostProcessingAttribs.ToneMapping.bAutoExposure);
+            Macros.AddShaderMacro("TONE_MAPPING_MODE",    m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
+            Macros.AddShaderMacro("USE_TONE_MAPPING_LUT", m_bUseToneMappingLUT);
+        }
+        // Pixels that can't be upsampled are discarded and later ray marched at full resolution.
+        // Luminance is rendered in low resolution and must cover the entire image.
+        Macros.AddShaderMacro("CORRECT_INSCATTERING_AT_DEPTH_BREAKS", !bRenderLuminance);
+        // clang-format on
+        Macros.Finalize();
+
+        auto pUpsampleInsctrPS = CreateShader(m_FrameAttribs.pDevice, "UpsampleInscattering.fx", "UpsampleAndApplyInscatteringPS",
+                                              SHADER_TYPE_PIXEL, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        // clang-format off
+        ShaderResourceVariableDesc Vars[] =
+        {
+            {SHADER_TYPE_PIXEL, "cbParticipatingMediaScatteringParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_PIXEL, "cbPostProcessingAttribs",              SHADER_RESOURCE_VARIABLE_TYPE_STATIC}
+        };
+        // clang-format on
+        ResourceLayout.Variables    = Vars;
+        ResourceLayout.NumVariables = _countof(Vars);
+
+        if (bRenderLuminance)
+        {
+            // Disable depth testing - we need to render the entire image in low resolution
+            UpsampleInsctrTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "UpsampleAndRenderLuminance",
+                                                                     m_pFullScreenTriangleVS, pUpsampleInsctrPS,
+                                                                     ResourceLayout, WeightedLogLumTexFmt);
+        }
+        else
+        {
+            // Enable depth testing to write 0.0 to the depth buffer. All pixels that
+            // can't be upsampled will be discarded and will retain 1.0
+            UpsampleInsctrTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "UpsampleInscattering",
+                                                                     m_pFullScreenTriangleVS, pUpsampleInsctrPS,
+                                                                     ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_Default);
+        }
+        UpsampleInsctrTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        UpsampleInsctrTech.PSODependencyFlags = PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS |
+            (bRenderLuminance ? 0 : (PSO_DEPENDENCY_AUTO_EXPOSURE | PSO_DEPENDENCY_TONE_MAPPING_MODE | PSO_DEPENDENCY_TONE_MAPPING_LUT));
+
+        UpsampleInsctrTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_SRC_COLOR_BUFFER |
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_TONE_MAPPING_LUT |
+            SRB_DEPENDENCY_DOWNSCALED_INSCTR_TEX |
+            SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+    }
+
+    UpsampleInsctrTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    UpsampleInsctrTech.Render(m_FrameAttribs.pDeviceContext);
+}
+
+// Returns the element of the base-2 Halton sequence
+static float GetHalton2(Uint32 Index)
+{
+    float Result = 0;
+    float Weight = 1;
+    while (Index > 0)
+    {
+        Weight *= 0.5f;
+        Result += Weight * static_cast<float>(Index & 0x01);
+        Index >>= 1;
+    }
+    return Result;
+}
+
+void EpipolarLightScattering::UpdateFroxelGridAttribs()
+{
+    const auto& CamAttribs    = *m_FrameAttribs.pCameraAttribs;
+    const auto& ShadowAttribs = m_FrameAttribs.pLightAttribs->ShadowAttribs;
+
+    // Light shafts are only rendered within the shadow cascades, so the grid ends at the far
+    // boundary of the last cascade. Scattering beyond the grid is taken from the look-up tables.
+    const float fNearZ = CamAttribs.fNearPlaneZ;
+    float       fFarZ  = ShadowAttribs.Cascades[m_PostProcessingAttribs.iNumCascades - 1].f4StartEndZ.y;
+    fFarZ              = std::max(std::min(fFarZ, CamAttribs.fFarPlaneZ), fNearZ * 2.f);
+
+    const bool bUseHistory = m_bFroxelHistoryValid && m_PostProcessingAttribs.fFroxelTemporalBlendFactor > 0;
+    // Without temporal accumulation, every froxel is sampled in its center. Otherwise, the sample
+    // location is jittered along the slice depth so that the history integrates the entire froxel.
+    const float fDepthJitter = m_PostProcessingAttribs.fFroxelTemporalBlendFactor > 0 ?
+        GetHalton2(m_uiFroxelFrameIndex % 16 + 1) :
+        0.5f;
+
+    const float4 f4GridDepthParams{fNearZ, fFarZ, std::log(fFarZ / fNearZ), fDepthJitter};
+    {
+        MapHelper<FroxelGridAttribs> pFroxelAttribs(m_FrameAttribs.pDeviceContext, m_pcbFroxelGridAttribs, MAP_WRITE, MAP_FLAG_DISCARD);
+        pFroxelAttribs->mPrevViewProjT        = bUseHistory ? m_mPrevViewProjT : CamAttribs.mViewProjT;
+        pFroxelAttribs->f4GridDim             = float4{
+            static_cast<float>(m_PostProcessingAttribs.uiFroxelGridWidth),
+            static_cast<float>(m_PostProcessingAttribs.uiFroxelGridHeight),
+            static_cast<float>(m_PostProcessingAttribs.uiFroxelGridDepth),
+            0};
+        pFroxelAttribs->f4GridDepthParams     = f4GridDepthParams;
+        pFroxelAttribs->f4PrevGridDepthParams = bUseHistory ? m_f4PrevFroxelGridDepthParams : f4GridDepthParams;
+        pFroxelAttribs->f4PrevCameraPos       = bUseHistory ? m_f4PrevCameraPos : CamAttribs.f4Position;
+        pFroxelAttribs->f4PrevCameraPos.w     = bUseHistory ? m_PostProcessingAttribs.fFroxelTemporalBlendFactor : 0;
+    }
+
+    m_mPrevViewProjT              = CamAttribs.mViewProjT;
+    m_f4PrevCameraPos             = CamAttribs.f4Position;
+    m_f4PrevFroxelGridDepthParams = f4GridDepthParams;
+}
+
+void EpipolarLightScattering::InjectFroxelInscattering()
+{
+    auto& InjectTech = m_RenderTech[RENDER_TECH_INJECT_FROXEL_INSCATTERING];
+    if (!InjectTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("FROXEL_THREAD_GROUP_SIZE", static_cast<int>(sm_uiFroxelCSThreadGroupSize));
+        Macros.Finalize();
+
+        auto pInjectCS = CreateShader(m_FrameAttribs.pDevice, "FroxelInscattering.fx", "InjectFroxelInscatteringCS",
+                                      SHADER_TYPE_COMPUTE, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pInjectCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
+        // clang-format off
+        Vars.emplace_back(SHADER_TYPE_COMPUTE, "cbFroxelGridAttribs",        SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+        // Current and history textures are swapped every frame
+        Vars.emplace_back(SHADER_TYPE_COMPUTE, "g_rwtex3DFroxelInsctr",      SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+        Vars.emplace_back(SHADER_TYPE_COMPUTE, "g_tex3DFroxelInsctrHistory", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+        // clang-format on
+        ImtblSamplers.emplace_back(SHADER_TYPE_COMPUTE, "g_tex3DFroxelInsctrHistory", Sam_LinearClamp);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        InjectTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "InjectFroxelInscattering", pInjectCS, ResourceLayout);
+        InjectTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        InjectTech.PSODependencyFlags =
+            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE;
+
+        InjectTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_SHADOW_MAP;
+    }
+
+    InjectTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
 
-        // Disable depth testing - we need to render the entire image in low resolution
-        UnwarpAndRenderLuminanceTech.Render(m_FrameAttribs.pDeviceContext);
-    }
-    else
-    {
-        UnwarpEpipolarSctrImgTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    const auto CurrIdx           = m_uiFroxelFrameIndex & 0x01;
+    auto*      pFroxelInsctrUAV  = m_ptex3DFroxelInsctrUAV[CurrIdx].RawPtr();
+    auto*      pFroxelHistorySRV = m_ptex3DFroxelInsctrUAV[1 - CurrIdx]->GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    InjectTech.SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_rwtex3DFroxelInsctr")->Set(pFroxelInsctrUAV);
+    InjectTech.SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DFroxelInsctrHistory")->Set(pFroxelHistorySRV);
 
-        // Enable depth testing to write 0.0 to the depth buffer. All pixel that require
-        // inscattering correction (if enabled) will be discarded, so that 1.0 will be retained
-        // This 1.0 will then be used to perform inscattering correction
-        UnwarpEpipolarSctrImgTech.Render(m_FrameAttribs.pDeviceContext);
-    }
+    DispatchComputeAttribs DispatchAttrs{
+        (m_PostProcessingAttribs.uiFroxelGridWidth + sm_uiFroxelCSThreadGroupSize - 1) / sm_uiFroxelCSThreadGroupSize,
+        (m_PostProcessingAttribs.uiFroxelGridHeight + sm_uiFroxelCSThreadGroupSize - 1) / sm_uiFroxelCSThreadGroupSize,
+        m_PostProcessingAttribs.uiFroxelGridDepth //
+    };
+    InjectTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchAttrs);
 }
 
-void EpipolarLightScattering::UpdateAverageLuminance()
+void EpipolarLightScattering::IntegrateFroxelInscattering()
 {
-    auto& UpdateAverageLuminanceTech = m_RenderTech[RENDER_TECH_UPDATE_AVERAGE_LUMINANCE];
-    if (!UpdateAverageLuminanceTech.PSO)
+    auto& IntegrateTech = m_RenderTech[RENDER_TECH_INTEGRATE_FROXEL_INSCATTERING];
+    if (!IntegrateTech.PSO)
     {
         ShaderMacroHelper Macros;
         DefineMacros(Macros);
-        Macros.AddShaderMacro("LIGHT_ADAPTATION", m_PostProcessingAttribs.ToneMapping.bLightAdaptation);
-        // static_cast<int>() is required because Run() gets its arguments by reference
-        // and gcc will try to find reference to sm_iLowResLuminanceMips, which does not exist
-        Macros.AddShaderMacro("LOW_RES_LUMINANCE_MIPS", static_cast<int>(sm_iLowResLuminanceMips));
+        Macros.AddShaderMacro("FROXEL_THREAD_GROUP_SIZE", static_cast<int>(sm_uiFroxelCSThreadGroupSize));
         Macros.Finalize();
 
-        auto pUpdateAverageLuminancePS = CreateShader(m_FrameAttribs.pDevice, "UpdateAverageLuminance.fx", "UpdateAverageLuminancePS",
-                                                      SHADER_TYPE_PIXEL, Macros);
+        auto pIntegrateCS = CreateShader(m_FrameAttribs.pDevice, "FroxelInscattering.fx", "IntegrateFroxelInscatteringCS",
+                                         SHADER_TYPE_COMPUTE, Macros);
 
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pIntegrateCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
         // clang-format off
-        ShaderResourceVariableDesc Vars[] =
-        {
-            {SHADER_TYPE_PIXEL, "cbMiscDynamicParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC}
-        };
+        Vars.emplace_back(SHADER_TYPE_COMPUTE, "cbFroxelGridAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+        Vars.emplace_back(SHADER_TYPE_COMPUTE, "g_tex3DFroxelInsctr", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
         // clang-format on
 
-        if (m_PostProcessingAttribs.ToneMapping.bLightAdaptation)
-        {
-            ResourceLayout.Variables    = Vars;
-            ResourceLayout.NumVariables = _countof(Vars);
-        }
-        UpdateAverageLuminanceTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "UpdateAverageLuminance",
-                                                                         m_pFullScreenTriangleVS, pUpdateAverageLuminancePS,
-                                                                         ResourceLayout, AverageLuminanceTexFmt, TEX_FORMAT_UNKNOWN,
-                                                                         DSS_DisableDepth, BS_AlphaBlend);
-        UpdateAverageLuminanceTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
 
-        UpdateAverageLuminanceTech.PSODependencyFlags = PSO_DEPENDENCY_LIGHT_ADAPTATION;
-    }
+        IntegrateTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "IntegrateFroxelInscattering", pIntegrateCS, ResourceLayout);
+        IntegrateTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
 
-    {
-        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
-        pMiscDynamicParams->fElapsedTime = (float)m_FrameAttribs.dElapsedTime;
+        IntegrateTech.PSODependencyFlags = PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE;
+
+        IntegrateTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS |
+            SRB_DEPENDENCY_FROXEL_INSCTR_TEX;
     }
 
-    UpdateAverageLuminanceTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping);
+    IntegrateTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
 
-    ITextureView* ppRTVs[] = {m_ptex2DAverageLuminanceRTV};
-    m_FrameAttribs.pDeviceContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-    UpdateAverageLuminanceTech.Render(m_FrameAttribs.pDeviceContext);
-}
+    auto* pFroxelInsctrSRV = m_ptex3DFroxelInsctrUAV[m_uiFroxelFrameIndex & 0x01]->GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    IntegrateTech.SRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_tex3DFroxelInsctr")->Set(pFroxelInsctrSRV);
 
+    DispatchComputeAttribs DispatchAttrs{
+        (m_PostProcessingAttribs.uiFroxelGridWidth + sm_uiFroxelCSThreadGroupSize - 1) / sm_uiFroxelCSThreadGroupSize,
+        (m_PostProcessingAttribs.uiFroxelGridHeight + sm_uiFroxelCSThreadGroupSize - 1) / sm_uiFroxelCSThreadGroupSize,
+        1 //
+    };
+    IntegrateTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchAttrs);
+}
 
-void EpipolarLightScattering::FixInscatteringAtDepthBreaks(Uint32               uiMaxStepsAlongRay,
-                                                           EFixInscatteringMode Mode)
+void EpipolarLightScattering::ApplyFroxelInscattering(bool bRenderLuminance)
 {
-    auto& FixInsctrAtDepthBreaksTech = m_RenderTech[RENDER_TECH_FIX_INSCATTERING_LUM_ONLY + static_cast<int>(Mode)];
-    if (!FixInsctrAtDepthBreaksTech.PSO)
+    auto& ApplyInsctrTech = m_RenderTech[bRenderLuminance ? RENDER_TECH_APPLY_FROXEL_INSCTR_AND_RENDER_LUMINANCE : RENDER_TECH_APPLY_FROXEL_INSCATTERING];
+    if (!ApplyInsctrTech.PSO)
     {
-        bool              bRenderLuminance = Mode == EFixInscatteringMode::LuminanceOnly;
         ShaderMacroHelper Macros;
         DefineMacros(Macros);
         // clang-format off
-        Macros.AddShaderMacro("CASCADE_PROCESSING_MODE", CASCADE_PROCESSING_MODE_SINGLE_PASS);
-        Macros.AddShaderMacro("PERFORM_TONE_MAPPING",    !bRenderLuminance);
-        Macros.AddShaderMacro("AUTO_EXPOSURE",           m_PostProcessingAttribs.ToneMapping.bAutoExposure);
-        Macros.AddShaderMacro("TONE_MAPPING_MODE",       m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
-        Macros.AddShaderMacro("USE_1D_MIN_MAX_TREE",     false);
+        Macros.AddShaderMacro("PERFORM_TONE_MAPPING", !bRenderLuminance);
+        if (!bRenderLuminance)
+        {
+            Macros.AddShaderMacro("AUTO_EXPOSURE",        m_PostProcessingAttribs.ToneMapping.bAutoExposure);
+            Macros.AddShaderMacro("TONE_MAPPING_MODE",    m_PostProcessingAttribs.ToneMapping.iToneMappingMode);
+            Macros.AddShaderMacro("USE_TONE_MAPPING_LUT", m_bUseToneMappingLUT);
+        }
         // clang-format on
         Macros.Finalize();
 
-        auto pFixInsctrAtDepthBreaksPS =
-            CreateShader(m_FrameAttribs.pDevice, "RayMarch.fx", "FixAndApplyInscatteredRadiancePS",
-                         SHADER_TYPE_PIXEL, Macros);
+        auto pApplyInsctrPS = CreateShader(m_FrameAttribs.pDevice, "FroxelInscattering.fx", "ApplyFroxelInscatteringPS",
+                                           SHADER_TYPE_PIXEL, Macros);
+
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
 
         std::vector<ShaderResourceVariableDesc> Vars;
         std::vector<ImmutableSamplerDesc>       ImtblSamplers;
-
-        std::unordered_set<std::string> ResourceNames;
-
-        const auto ResCount = pFixInsctrAtDepthBreaksPS->GetResourceCount();
-        for (Uint32 r = 0; r < ResCount; ++r)
-        {
-            ShaderResourceDesc ResourceDesc;
-            pFixInsctrAtDepthBreaksPS->GetResourceDesc(r, ResourceDesc);
-            ResourceNames.emplace(ResourceDesc.Name);
-        }
-
-        // clang-format off
-        const std::array<std::string, 4> StaticLinearTextures =
-        {
-            "g_tex3DSingleSctrLUT",
-            "g_tex3DHighOrderSctrLUT",
-            "g_tex3DMultipleSctrLUT",
-            "g_tex2DOccludedNetDensityToAtmTop"
-        };
-        // clang-format on
-        for (const auto& Tex : StaticLinearTextures)
-        {
-            if (ResourceNames.find(Tex) != ResourceNames.end())
-            {
-                Vars.emplace_back(SHADER_TYPE_PIXEL, Tex.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-                ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, Tex.c_str(), Sam_LinearClamp);
-            }
-        }
-
-        if (ResourceNames.find("cbParticipatingMediaScatteringParams") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbParticipatingMediaScatteringParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-        if (ResourceNames.find("cbPostProcessingAttribs") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbPostProcessingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-        if (ResourceNames.find("cbMiscDynamicParams") != ResourceNames.end())
-            Vars.emplace_back(SHADER_TYPE_PIXEL, "cbMiscDynamicParams", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
-
-        if (ResourceNames.find("g_tex2DCamSpaceZ") != ResourceNames.end())
-            ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_tex2DCamSpaceZ", Sam_LinearClamp);
+        InitRayMarchingResourceLayout(pApplyInsctrPS, SHADER_TYPE_PIXEL, Vars, ImtblSamplers);
+        Vars.emplace_back(SHADER_TYPE_PIXEL, "cbFroxelGridAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+        ImtblSamplers.emplace_back(SHADER_TYPE_PIXEL, "g_tex3DFroxelIntegratedInsctr", Sam_LinearClamp);
 
         ResourceLayout.Variables            = Vars.data();
         ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
         ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
         ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
 
-        if (Mode == EFixInscatteringMode::LuminanceOnly)
-        {
-            // Luminance Only
-            // Disable depth and stencil tests to render all pixels
-            // Use default blend state to overwrite old luminance values
-            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaksLumOnly",
-                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
-                                                                             ResourceLayout, WeightedLogLumTexFmt);
-        }
-        else if (Mode == EFixInscatteringMode::FixInscattering)
+        if (bRenderLuminance)
         {
-            // Fix Inscattering
-            // Depth breaks are marked with 1.0 in depth, so we enable depth test
-            // to render only pixels that require correction
-            // Use default blend state - the rendering is always done in single pass
-            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaks",
-                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
-                                                                             ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_Default);
+            ApplyInsctrTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "ApplyFroxelInsctrAndRenderLuminance",
+                                                                  m_pFullScreenTriangleVS, pApplyInsctrPS,
+                                                                  ResourceLayout, WeightedLogLumTexFmt);
         }
-        else if (Mode == EFixInscatteringMode::FullScreenRayMarching)
+        else
         {
-            // Full Screen Ray Marching
-            // Disable depth and stencil tests since we are performing
-            // full screen ray marching
-            // Use default blend state - the rendering is always done in single pass
-            FixInsctrAtDepthBreaksTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "FixInsctrAtDepthBreaks",
-                                                                             m_pFullScreenTriangleVS, pFixInsctrAtDepthBreaksPS,
-                                                                             ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_DisableDepth);
+            // Every pixel is processed, so depth testing is not needed
+            ApplyInsctrTech.InitializeFullScreenTriangleTechnique(m_FrameAttribs.pDevice, "ApplyFroxelInscattering",
+                                                                  m_pFullScreenTriangleVS, pApplyInsctrPS,
+                                                                  ResourceLayout, m_BackBufferFmt, m_DepthBufferFmt, DSS_DisableDepth);
         }
-        FixInsctrAtDepthBreaksTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+        ApplyInsctrTech.PSO->BindStaticResources(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
 
-
-        FixInsctrAtDepthBreaksTech.PSODependencyFlags =
-            PSO_DEPENDENCY_CASCADE_PROCESSING_MODE |
-            PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX |
-            PSO_DEPENDENCY_ENABLE_LIGHT_SHAFTS |
+        ApplyInsctrTech.PSODependencyFlags =
             PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
             PSO_DEPENDENCY_SINGLE_SCATTERING_MODE |
-            PSO_DEPENDENCY_AUTO_EXPOSURE |
-            PSO_DEPENDENCY_TONE_MAPPING_MODE;
+            (bRenderLuminance ? 0 : (PSO_DEPENDENCY_AUTO_EXPOSURE | PSO_DEPENDENCY_TONE_MAPPING_MODE | PSO_DEPENDENCY_TONE_MAPPING_LUT));
 
-        FixInsctrAtDepthBreaksTech.SRBDependencyFlags =
+        ApplyInsctrTech.SRBDependencyFlags =
             SRB_DEPENDENCY_CAMERA_ATTRIBS |
             SRB_DEPENDENCY_LIGHT_ATTRIBS |
-            SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX |
-            SRB_DEPENDENCY_SLICE_UV_DIR_TEX |
-            SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP |
-            SRB_DEPENDENCY_COORDINATE_TEX |
-            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
             SRB_DEPENDENCY_SRC_COLOR_BUFFER |
-            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX;
+            SRB_DEPENDENCY_CAM_SPACE_Z_TEX |
+            SRB_DEPENDENCY_AVERAGE_LUMINANCE_TEX |
+            SRB_DEPENDENCY_TONE_MAPPING_LUT |
+            SRB_DEPENDENCY_FROXEL_INSCTR_TEX;
     }
 
+    ApplyInsctrTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    ApplyInsctrTech.Render(m_FrameAttribs.pDeviceContext);
+}
+
+void EpipolarLightScattering::ComputeSkyViewAndAerialPerspectiveLUTs()
+{
+    // Both tables only depend on the camera position and the light direction, so they are
+    // recomputed every frame. This is much cheaper than evaluating unshadowed scattering per sample.
+    auto& SkyViewTech = m_RenderTech[RENDER_TECH_COMPUTE_SKY_VIEW_LUT];
+    auto& APTech      = m_RenderTech[RENDER_TECH_COMPUTE_AERIAL_PERSPECTIVE_LUT];
+    if (!SkyViewTech.PSO || !APTech.PSO)
     {
-        MapHelper<MiscDynamicParams> pMiscDynamicParams(m_FrameAttribs.pDeviceContext, m_pcbMiscParams, MAP_WRITE, MAP_FLAG_DISCARD);
-        pMiscDynamicParams->fMaxStepsAlongRay = static_cast<float>(uiMaxStepsAlongRay);
-        pMiscDynamicParams->fCascadeInd       = static_cast<float>(m_PostProcessingAttribs.iFirstCascadeToRayMarch);
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<int>(sm_uiSkyViewAndAPCSThreadGroupSize));
+        {
+            std::stringstream ss;
+            ss << "float2(" << sm_uiSkyViewLUTWidth << ".0," << sm_uiSkyViewLUTHeight << ".0)";
+            Macros.AddShaderMacro("SKY_VIEW_LUT_DIM", ss.str());
+        }
+        Macros.Finalize();
+
+        auto InitTechnique = [&](RenderTechnique& Tech, const char* EntryPoint) //
+        {
+            auto pCS = CreateShader(m_FrameAttribs.pDevice, "SkyViewAndAerialPerspective.fx", EntryPoint, SHADER_TYPE_COMPUTE, Macros);
+
+            PipelineResourceLayoutDesc ResourceLayout;
+            ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+            std::vector<ShaderResourceVariableDesc> Vars;
+            std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+            InitRayMarchingResourceLayout(pCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
+
+            ResourceLayout.Variables            = Vars.data();
+            ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+            ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+            ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+            Tech.InitializeComputeTechnique(m_FrameAttribs.pDevice, EntryPoint, pCS, ResourceLayout);
+            Tech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+            Tech.PSODependencyFlags =
+                PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+                PSO_DEPENDENCY_SINGLE_SCATTERING_MODE;
+
+            Tech.SRBDependencyFlags =
+                SRB_DEPENDENCY_CAMERA_ATTRIBS |
+                SRB_DEPENDENCY_LIGHT_ATTRIBS |
+                SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS;
+        };
+        if (!SkyViewTech.PSO)
+            InitTechnique(SkyViewTech, "ComputeSkyViewLUTCS");
+        if (!APTech.PSO)
+            InitTechnique(APTech, "ComputeAerialPerspectiveLUTCS");
     }
 
-    FixInsctrAtDepthBreaksTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    SkyViewTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    DispatchComputeAttribs SkyViewDispatchAttrs{
+        (sm_uiSkyViewLUTWidth + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize,
+        (sm_uiSkyViewLUTHeight + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize //
+    };
+    SkyViewTech.DispatchCompute(m_FrameAttribs.pDeviceContext, SkyViewDispatchAttrs);
+
+    APTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    DispatchComputeAttribs APDispatchAttrs{
+        (m_PostProcessingAttribs.uiAerialPerspectiveLUTResolution + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize,
+        (m_PostProcessingAttribs.uiAerialPerspectiveLUTResolution + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize,
+        m_PostProcessingAttribs.uiAerialPerspectiveLUTDepth //
+    };
+    APTech.DispatchCompute(m_FrameAttribs.pDeviceContext, APDispatchAttrs);
+}
 
-    FixInsctrAtDepthBreaksTech.Render(m_FrameAttribs.pDeviceContext);
+ITextureView* EpipolarLightScattering::RenderSkyCubemap()
+{
+    if (m_FrameAttribs.pDevice == nullptr || m_FrameAttribs.pDeviceContext == nullptr)
+    {
+        LOG_ERROR_MESSAGE("RenderSkyCubemap() must be called after PrepareForNewFrame()");
+        return nullptr;
+    }
+    if (m_FrameAttribs.pDevice->GetDeviceInfo().Features.ComputeShaders == DEVICE_FEATURE_STATE_DISABLED)
+    {
+        LOG_ERROR_MESSAGE("Rendering the sky cube map requires compute shaders");
+        return nullptr;
+    }
+
+    UpdateAtmosphereLUTs();
+
+    if (!m_ptex2DSkyCubemapUAV)
+    {
+        CreateSkyCubemap(m_FrameAttribs.pDevice);
+    }
+
+    auto& RenderSkyCubemapTech = m_RenderTech[RENDER_TECH_RENDER_SKY_CUBEMAP];
+    if (!RenderSkyCubemapTech.PSO)
+    {
+        ShaderMacroHelper Macros;
+        DefineMacros(Macros);
+        Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<int>(sm_uiSkyViewAndAPCSThreadGroupSize));
+        Macros.AddShaderMacro("SKY_CUBEMAP_DIM", static_cast<int>(sm_uiSkyCubemapDim));
+        Macros.Finalize();
+
+        auto pCS = CreateShader(m_FrameAttribs.pDevice, "SkyViewAndAerialPerspective.fx", "RenderSkyCubemapCS", SHADER_TYPE_COMPUTE, Macros);
+
+        PipelineResourceLayoutDesc ResourceLayout;
+        ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+        std::vector<ShaderResourceVariableDesc> Vars;
+        std::vector<ImmutableSamplerDesc>       ImtblSamplers;
+        InitRayMarchingResourceLayout(pCS, SHADER_TYPE_COMPUTE, Vars, ImtblSamplers);
+
+        ResourceLayout.Variables            = Vars.data();
+        ResourceLayout.NumVariables         = static_cast<Uint32>(Vars.size());
+        ResourceLayout.ImmutableSamplers    = ImtblSamplers.data();
+        ResourceLayout.NumImmutableSamplers = static_cast<Uint32>(ImtblSamplers.size());
+
+        RenderSkyCubemapTech.InitializeComputeTechnique(m_FrameAttribs.pDevice, "RenderSkyCubemapCS", pCS, ResourceLayout);
+        RenderSkyCubemapTech.PSO->BindStaticResources(SHADER_TYPE_COMPUTE, m_pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+
+        RenderSkyCubemapTech.PSODependencyFlags =
+            PSO_DEPENDENCY_MULTIPLE_SCATTERING_MODE |
+            PSO_DEPENDENCY_SINGLE_SCATTERING_MODE;
+
+        // The cube map is created once, so only the user-provided buffers can make the SRB stale
+        RenderSkyCubemapTech.SRBDependencyFlags =
+            SRB_DEPENDENCY_CAMERA_ATTRIBS |
+            SRB_DEPENDENCY_LIGHT_ATTRIBS;
+    }
+
+    RenderSkyCubemapTech.PrepareSRB(m_FrameAttribs.pDevice, m_pResMapping, BIND_SHADER_RESOURCES_KEEP_EXISTING);
+    DispatchComputeAttribs DispatchAttrs{
+        (sm_uiSkyCubemapDim + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize,
+        (sm_uiSkyCubemapDim + sm_uiSkyViewAndAPCSThreadGroupSize - 1) / sm_uiSkyViewAndAPCSThreadGroupSize,
+        6 //
+    };
+    RenderSkyCubemapTech.DispatchCompute(m_FrameAttribs.pDeviceContext, DispatchAttrs);
+
+    auto* pSkyCubemapSRV = m_ptex2DSkyCubemapUAV->GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_FrameAttribs.pDeviceContext->GenerateMips(pSkyCubemapSRV);
+
+    return pSkyCubemapSRV;
 }
 
 void EpipolarLightScattering::RenderSampleLocations()
@@ -2047,7 +3154,7 @@ void EpipolarLightScattering::CreateExtinctionTexture(IRenderDevice* pDevice)
     m_ptex2DEpipolarExtinctionRTV = tex2DEpipolarExtinction->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
 }
 
-void EpipolarLightScattering::CreateAmbientSkyLightTexture(IRenderDevice* pDevice)
+void AtmosphereLUTs::CreateAmbientSkyLightTexture(IRenderDevice* pDevice)
 {
     TextureDesc TexDesc;
     TexDesc.Name      = "Ambient Sky Light";
@@ -2091,7 +3198,8 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     DEV_CHECK_ERR(PPAttribs.fMaxShadowMapStep != 0, "Max shadow map step must not be 0");
     // clang-format off
     DEV_CHECK_ERR(PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_EPIPOLAR_SAMPLING ||
-                  PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE,
+                  PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE ||
+                  PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_FROXEL,
                   "Incorrect light scattering technique (", PPAttribs.iLightSctrTechnique, ")");
     DEV_CHECK_ERR(PPAttribs.iCascadeProcessingMode == CASCADE_PROCESSING_MODE_SINGLE_PASS ||
                   PPAttribs.iCascadeProcessingMode == CASCADE_PROCESSING_MODE_MULTI_PASS ||
@@ -2111,6 +3219,15 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     DEV_CHECK_ERR(PPAttribs.iExtinctionEvalMode == EXTINCTION_EVAL_MODE_PER_PIXEL ||
                   PPAttribs.iExtinctionEvalMode == EXTINCTION_EVAL_MODE_EPIPOLAR,
                   "Incorrect extinction evaluation mode (", PPAttribs.iExtinctionEvalMode, ")");
+    DEV_CHECK_ERR(PPAttribs.uiBruteForceDownscaleFactor == 1 ||
+                  PPAttribs.uiBruteForceDownscaleFactor == 2 ||
+                  PPAttribs.uiBruteForceDownscaleFactor == 4,
+                  "Brute force downscale factor (", PPAttribs.uiBruteForceDownscaleFactor, ") must be 1, 2 or 4");
+    DEV_CHECK_ERR(PPAttribs.fBruteForceUpsampleDepthThreshold > 0, "Brute force upsample depth threshold must be positive");
+    DEV_CHECK_ERR(PPAttribs.uiFroxelGridWidth > 0 && PPAttribs.uiFroxelGridHeight > 0 && PPAttribs.uiFroxelGridDepth > 0, "Froxel grid dimensions must not be 0");
+    DEV_CHECK_ERR(PPAttribs.fFroxelTemporalBlendFactor >= 0 && PPAttribs.fFroxelTemporalBlendFactor < 1, "Froxel temporal blend factor (", PPAttribs.fFroxelTemporalBlendFactor, ") must be in [0, 1) range");
+    DEV_CHECK_ERR(PPAttribs.fAerialPerspectiveLUTMaxDist > 0, "Aerial perspective LUT max distance must be positive");
+    DEV_CHECK_ERR(PPAttribs.uiAerialPerspectiveLUTResolution > 0 && PPAttribs.uiAerialPerspectiveLUTDepth > 0, "Aerial perspective LUT dimensions must not be 0");
     
     Uint32 StalePSODependencyFlags = 0;
 #define CHECK_PSO_DEPENDENCY(Flag, Member)StalePSODependencyFlags |= (PPAttribs.Member != m_PostProcessingAttribs.Member) ? Flag : 0
@@ -2130,6 +3247,8 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     CHECK_PSO_DEPENDENCY(PSO_DEPENDENCY_TONE_MAPPING_MODE,          ToneMapping.iToneMappingMode);
     CHECK_PSO_DEPENDENCY(PSO_DEPENDENCY_LIGHT_ADAPTATION,           ToneMapping.bLightAdaptation);
     CHECK_PSO_DEPENDENCY(PSO_DEPENDENCY_EXTINCTION_EVAL_MODE,       iExtinctionEvalMode);
+    CHECK_PSO_DEPENDENCY(PSO_DEPENDENCY_MIN_MAX_SHADOW_MAP_RES,     uiMinMaxShadowMapResolution);
+    CHECK_PSO_DEPENDENCY(PSO_DEPENDENCY_LOW_PRECISION_FORMATS,      bUseLowPrecisionIntermediates);
 #undef CHECK_PSO_DEPENDENCY
 
     bool bUseCombinedMinMaxTexture = PPAttribs.iCascadeProcessingMode == CASCADE_PROCESSING_MODE_SINGLE_PASS     ||
@@ -2138,6 +3257,56 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
                                      PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE;
     StalePSODependencyFlags |= (m_bUseCombinedMinMaxTexture != bUseCombinedMinMaxTexture) ? PSO_DEPENDENCY_USE_COMBINED_MIN_MAX_TEX : 0;
 
+    // Compacted ray marching samples are processed by a single indirect dispatch, which is
+    // not compatible with multi-pass cascade processing
+    const auto& DeviceFeatures = frameAttribs.pDevice->GetDeviceInfo().Features;
+    bool bCompactRayMarchingSamples = PPAttribs.bCompactRayMarchingSamples                                     &&
+                                      PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_EPIPOLAR_SAMPLING   &&
+                                      DeviceFeatures.ComputeShaders    != DEVICE_FEATURE_STATE_DISABLED        &&
+                                      DeviceFeatures.IndirectRendering != DEVICE_FEATURE_STATE_DISABLED        &&
+                                      (!PPAttribs.bEnableLightShafts || PPAttribs.iCascadeProcessingMode == CASCADE_PROCESSING_MODE_SINGLE_PASS);
+    StalePSODependencyFlags |= (m_bCompactRayMarchingSamples != bCompactRayMarchingSamples) ? PSO_DEPENDENCY_COMPACT_RAY_MARCHING : 0;
+
+    // Sky-view and aerial perspective tables are computed by compute shaders
+    bool bUseSkyViewAndAerialPerspectiveLUTs = PPAttribs.bUseSkyViewAndAerialPerspectiveLUTs &&
+                                               PPAttribs.iLightSctrTechnique != LIGHT_SCTR_TECHNIQUE_FROXEL &&
+                                               DeviceFeatures.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED;
+    StalePSODependencyFlags |= (m_bUseSkyViewAndAerialPerspectiveLUTs != bUseSkyViewAndAerialPerspectiveLUTs) ? PSO_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS : 0;
+
+    // Tone mapping is performed with a single fetch from the lookup table if the application provides one
+    bool bUseToneMappingLUT = frameAttribs.ptex3DToneMappingLUTSRV != nullptr;
+    StalePSODependencyFlags |= (m_bUseToneMappingLUT != bUseToneMappingLUT) ? PSO_DEPENDENCY_TONE_MAPPING_LUT : 0;
+
+    // Build all levels of the min/max tree in a single compute pass if the min/max shadow map
+    // format can be written by the compute shader and the tree fits into group shared memory
+    bool bBuildMinMaxTreeInCS = false;
+    if (DeviceFeatures.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED &&
+        PPAttribs.uiMinMaxShadowMapResolution <= sm_uiMaxMinMaxTreeCSResolution)
+    {
+        const auto& FmtInfo  = frameAttribs.pDevice->GetTextureFormatInfoExt(PPAttribs.bIs32BitMinMaxMipMap ? MinMaxShadowMap32BitFmt : MinMaxShadowMap16BitFmt);
+        bBuildMinMaxTreeInCS = (FmtInfo.BindFlags & BIND_UNORDERED_ACCESS) != 0;
+    }
+
+    auto NewCoordinateTexFmt          = CoordinateTexFmt;
+    auto NewSliceEndpointsFmt         = SliceEndpointsFmt;
+    auto NewSliceUVDirAndOriginTexFmt = SliceUVDirAndOriginTexFmt;
+    if (PPAttribs.bUseLowPrecisionIntermediates)
+    {
+        NewCoordinateTexFmt          = CoordinateTexLowPrecFmt;
+        NewSliceEndpointsFmt         = SliceEndpointsLowPrecFmt;
+        NewSliceUVDirAndOriginTexFmt = SliceUVDirAndOriginLowPrecFmt;
+    }
+    // Invalid samples are marked with -1e+30, which must remain outside of the [-1,1] screen range.
+    // Normalized formats would clamp it to a valid screen corner.
+    VERIFY(GetTextureFormatAttribs(NewCoordinateTexFmt).ComponentType == COMPONENT_TYPE_FLOAT &&
+               GetTextureFormatAttribs(NewSliceEndpointsFmt).ComponentType == COMPONENT_TYPE_FLOAT,
+           "Epipolar coordinates and slice end points must use float formats to represent invalid samples");
+
+    // Unwarp epipolar image, correct inscattering at depth breaks and apply tone mapping in
+    // a single compute pass if the application provides UAV of the destination color buffer
+    bool bUnwarpAndFixInscatteringInCS = frameAttribs.ptex2DDstColorBufferUAV != nullptr &&
+                                         DeviceFeatures.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED;
+
     auto* pcbCameraAttribs = frameAttribs.pcbCameraAttribs != nullptr ? frameAttribs.pcbCameraAttribs : m_pcbCameraAttribs;
     auto* pcbLightAttribs  = frameAttribs.pcbLightAttribs  != nullptr ? frameAttribs.pcbLightAttribs  : m_pcbLightAttribs;
 
@@ -2147,6 +3316,8 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     NewUserResourceIds.SrcColorBufferSRV = frameAttribs.ptex2DSrcColorBufferSRV->GetUniqueID();
     NewUserResourceIds.SrcDepthBufferSRV = frameAttribs.ptex2DSrcDepthBufferSRV->GetUniqueID();
     NewUserResourceIds.ShadowMapSRV      = frameAttribs.ptex2DShadowMapSRV->GetUniqueID();
+    NewUserResourceIds.DstColorBufferUAV = frameAttribs.ptex2DDstColorBufferUAV != nullptr ? frameAttribs.ptex2DDstColorBufferUAV->GetUniqueID() : -1;
+    NewUserResourceIds.ToneMappingLUTSRV = frameAttribs.ptex3DToneMappingLUTSRV != nullptr ? frameAttribs.ptex3DToneMappingLUTSRV->GetUniqueID() : -1;
     // clang-format on
 
     Uint32 StaleSRBDependencyFlags = 0;
@@ -2154,13 +3325,18 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_SRC_COLOR_BUFFER, SrcColorBufferSRV);
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_SRC_DEPTH_BUFFER, SrcDepthBufferSRV);
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_SHADOW_MAP, ShadowMapSRV);
+    CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_DST_COLOR_BUFFER, DstColorBufferUAV);
+    CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_TONE_MAPPING_LUT, ToneMappingLUTSRV);
 #undef CHECK_SRB_DEPENDENCY
 
     StaleSRBDependencyFlags |= (!pcbCameraAttribs || m_UserResourceIds.CameraAttribs != NewUserResourceIds.CameraAttribs) ? SRB_DEPENDENCY_CAMERA_ATTRIBS : 0;
     StaleSRBDependencyFlags |= (!pcbLightAttribs || m_UserResourceIds.LightAttribs != NewUserResourceIds.LightAttribs) ? SRB_DEPENDENCY_LIGHT_ATTRIBS : 0;
 
+    bool bPurgeTransientTextures = false;
     if (PPAttribs.uiNumEpipolarSlices != m_PostProcessingAttribs.uiNumEpipolarSlices ||
-        PPAttribs.uiMaxSamplesInSlice != m_PostProcessingAttribs.uiMaxSamplesInSlice)
+        PPAttribs.uiMaxSamplesInSlice != m_PostProcessingAttribs.uiMaxSamplesInSlice ||
+        bCompactRayMarchingSamples != m_bCompactRayMarchingSamples ||
+        NewCoordinateTexFmt != m_CoordinateTexFmt)
     {
         m_ptex2DCoordinateTextureRTV.Release();     // Max Samples X Num Slices   RG32F
         m_ptex2DEpipolarCamSpaceZRTV.Release();     // Max Samples X Num Slices   R32F
@@ -2169,15 +3345,58 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
         m_ptex2DEpipolarImageDSV.Release();         // Max Samples X Num Slices   D24S8
         m_ptex2DInitialScatteredLightRTV.Release(); // Max Samples X Num Slices   RGBA16F
         StaleSRBDependencyFlags |= SRB_DEPENDENCY_INTERPOLATION_SOURCE_TEX;
+        bPurgeTransientTextures = true;
     }
 
-    if (PPAttribs.uiNumEpipolarSlices != m_PostProcessingAttribs.uiNumEpipolarSlices)
+    if (PPAttribs.uiNumEpipolarSlices != m_PostProcessingAttribs.uiNumEpipolarSlices ||
+        NewSliceEndpointsFmt != m_SliceEndpointsFmt)
     {
         m_ptex2DSliceEndpointsRTV.Release(); // Num Slices  X 1            RGBA32F
+        bPurgeTransientTextures = true;
+    }
+
+    if (m_pbufRayMarchingSampleList &&
+        (PPAttribs.uiNumEpipolarSlices != m_PostProcessingAttribs.uiNumEpipolarSlices ||
+         PPAttribs.uiMaxSamplesInSlice != m_PostProcessingAttribs.uiMaxSamplesInSlice ||
+         !bCompactRayMarchingSamples))
+    {
+        m_pbufRayMarchingSampleList.Release();    // Max Samples * Num Slices   uint
+        m_pbufRayMarchingSampleCounter.Release(); // 1                          uint
+        m_pbufRayMarchingDispatchArgs.Release();  // 3                          uint
+        StaleSRBDependencyFlags |= SRB_DEPENDENCY_RAY_MARCHING_SAMPLE_LIST;
+    }
+
+    if (PPAttribs.uiBruteForceDownscaleFactor != m_PostProcessingAttribs.uiBruteForceDownscaleFactor)
+    {
+        m_ptex2DDownscaledInsctrRTV.Release();    // BckBfrWdth/DownscaleFactor x BckBfrHght/DownscaleFactor  RGBA16F
+        m_ptex2DDownscaledCamSpaceZRTV.Release(); // BckBfrWdth/DownscaleFactor x BckBfrHght/DownscaleFactor  R32F
+    }
+
+    if (PPAttribs.uiFroxelGridWidth != m_PostProcessingAttribs.uiFroxelGridWidth ||
+        PPAttribs.uiFroxelGridHeight != m_PostProcessingAttribs.uiFroxelGridHeight ||
+        PPAttribs.uiFroxelGridDepth != m_PostProcessingAttribs.uiFroxelGridDepth)
+    {
+        for (size_t i = 0; i < _countof(m_ptex3DFroxelInsctrUAV); ++i)
+            m_ptex3DFroxelInsctrUAV[i].Release();  // GridWidth x GridHeight x GridDepth  RGBA16F
+        m_ptex3DFroxelIntegratedInsctrUAV.Release(); // GridWidth x GridHeight x GridDepth  RGBA16F
+    }
+
+    if (PPAttribs.uiAerialPerspectiveLUTResolution != m_PostProcessingAttribs.uiAerialPerspectiveLUTResolution ||
+        PPAttribs.uiAerialPerspectiveLUTDepth != m_PostProcessingAttribs.uiAerialPerspectiveLUTDepth)
+    {
+        m_ptex3DAerialPerspectiveInsctrUAV.Release();     // APLUTResolution x APLUTResolution x APLUTDepth  RGBA16F
+        m_ptex3DAerialPerspectiveExtinctionUAV.Release(); // APLUTResolution x APLUTResolution x APLUTDepth  RGBA8_UNORM
+    }
+
+    if (PPAttribs.iLightSctrTechnique != m_PostProcessingAttribs.iLightSctrTechnique)
+    {
+        // The history is stale when the froxel technique is re-enabled
+        m_bFroxelHistoryValid = false;
     }
 
     if (PPAttribs.uiNumEpipolarSlices != m_PostProcessingAttribs.uiNumEpipolarSlices ||
-        PPAttribs.iNumCascades != m_PostProcessingAttribs.iNumCascades)
+        PPAttribs.iNumCascades != m_PostProcessingAttribs.iNumCascades ||
+        NewSliceUVDirAndOriginTexFmt != m_SliceUVDirAndOriginTexFmt)
     {
         m_ptex2DSliceUVDirAndOriginRTV.Release(); // Num Slices  X Num Cascaes  RGBA32F
     }
@@ -2188,6 +3407,7 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
         PPAttribs.bUse1DMinMaxTree            != m_PostProcessingAttribs.bUse1DMinMaxTree            ||
         PPAttribs.bIs32BitMinMaxMipMap        != m_PostProcessingAttribs.bIs32BitMinMaxMipMap        ||
         bUseCombinedMinMaxTexture             != m_bUseCombinedMinMaxTexture                         ||
+        bBuildMinMaxTreeInCS                  != m_bBuildMinMaxTreeInCS                              ||
         (bUseCombinedMinMaxTexture && 
             (PPAttribs.iFirstCascadeToRayMarch != m_PostProcessingAttribs.iFirstCascadeToRayMarch || 
              PPAttribs.iNumCascades            != m_PostProcessingAttribs.iNumCascades)))
@@ -2196,6 +3416,14 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
             m_ptex2DMinMaxShadowMapSRV[i].Release();
         for (size_t i = 0; i < _countof(m_ptex2DMinMaxShadowMapRTV); ++i)
             m_ptex2DMinMaxShadowMapRTV[i].Release();
+        bPurgeTransientTextures = true;
+    }
+
+    if (bPurgeTransientTextures)
+    {
+        // Textures in the effect's own pool that match the old settings will never be used again.
+        // A shared pool is managed by the application.
+        m_pTransientTexturePool->Purge();
     }
 
 #define CHECK_SRB_DEPENDENCY(Flag, Res)StaleSRBDependencyFlags |= !Res ? Flag : 0
@@ -2210,8 +3438,12 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_SLICE_UV_DIR_TEX,         m_ptex2DSliceUVDirAndOriginRTV);
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_CAM_SPACE_Z_TEX,          m_ptex2DCamSpaceZRTV);
     CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP,       m_ptex2DMinMaxShadowMapRTV[0]);
+    CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_DOWNSCALED_INSCTR_TEX,    m_ptex2DDownscaledInsctrRTV);
+    CHECK_SRB_DEPENDENCY(SRB_DEPENDENCY_FROXEL_INSCTR_TEX,        m_ptex3DFroxelIntegratedInsctrUAV);
 #undef CHECK_SRB_DEPENDENCY
     // clang-format on
+    // The tables are not created when they are not used, which must not invalidate the SRBs every frame
+    StaleSRBDependencyFlags |= (bUseSkyViewAndAerialPerspectiveLUTs && !m_ptex3DAerialPerspectiveInsctrUAV) ? SRB_DEPENDENCY_SKY_AND_AERIAL_PERSPECTIVE_LUTS : 0;
 
     for (int i = 0; i < RENDER_TECH_TOTAL_TECHNIQUES; ++i)
         m_RenderTech[i].CheckStaleFlags(StalePSODependencyFlags, StaleSRBDependencyFlags);
@@ -2219,6 +3451,12 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     if (StaleSRBDependencyFlags & SRB_DEPENDENCY_SRC_COLOR_BUFFER)
         m_pResMapping->AddResource("g_tex2DColorBuffer", frameAttribs.ptex2DSrcColorBufferSRV, false);
 
+    if ((StaleSRBDependencyFlags & SRB_DEPENDENCY_DST_COLOR_BUFFER) && frameAttribs.ptex2DDstColorBufferUAV != nullptr)
+        m_pResMapping->AddResource("g_rwtex2DDstColor", frameAttribs.ptex2DDstColorBufferUAV, false);
+
+    if ((StaleSRBDependencyFlags & SRB_DEPENDENCY_TONE_MAPPING_LUT) && frameAttribs.ptex3DToneMappingLUTSRV != nullptr)
+        m_pResMapping->AddResource("g_tex3DToneMappingLUT", frameAttribs.ptex3DToneMappingLUTSRV, false);
+
     if (StaleSRBDependencyFlags & SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP)
     {
         m_pComputeMinMaxSMLevelSRB[0].Release();
@@ -2230,17 +3468,6 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     //    m_ptex2DEpipolarExtinctionRTV.Release();
     //}
 
-    // clang-format off
-    bool bRecomputeSctrCoeffs = m_PostProcessingAttribs.bUseCustomSctrCoeffs    != PPAttribs.bUseCustomSctrCoeffs    ||
-                                m_PostProcessingAttribs.bUseOzoneApproximation  != PPAttribs.bUseOzoneApproximation  ||
-                                m_PostProcessingAttribs.fAerosolDensityScale    != PPAttribs.fAerosolDensityScale    ||
-                                m_PostProcessingAttribs.fAerosolAbsorbtionScale != PPAttribs.fAerosolAbsorbtionScale ||
-                                (PPAttribs.bUseCustomSctrCoeffs && 
-                                    (m_PostProcessingAttribs.f4CustomRlghBeta        != PPAttribs.f4CustomRlghBeta ||
-                                     m_PostProcessingAttribs.f4CustomMieBeta         != PPAttribs.f4CustomMieBeta ||
-                                     m_PostProcessingAttribs.f4CustomOzoneAbsorption != PPAttribs.f4CustomOzoneAbsorption) );
-    // clang-format on
-
     m_PostProcessingAttribs = PPAttribs;
 
     m_PostProcessingAttribs.f4ScreenResolution = float4(
@@ -2273,13 +3500,27 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     m_PostProcessingAttribs.fFirstCascadeToRayMarch = static_cast<float>(m_PostProcessingAttribs.iFirstCascadeToRayMarch);
     m_PostProcessingAttribs.fNumCascades            = static_cast<float>(m_PostProcessingAttribs.iNumCascades);
 
-    m_bUseCombinedMinMaxTexture = bUseCombinedMinMaxTexture;
+    m_bUseCombinedMinMaxTexture  = bUseCombinedMinMaxTexture;
+    m_bCompactRayMarchingSamples = bCompactRayMarchingSamples;
+    m_bBuildMinMaxTreeInCS       = bBuildMinMaxTreeInCS;
+
+    m_bUseSkyViewAndAerialPerspectiveLUTs = bUseSkyViewAndAerialPerspectiveLUTs;
+
+    m_CoordinateTexFmt          = NewCoordinateTexFmt;
+    m_SliceEndpointsFmt         = NewSliceEndpointsFmt;
+    m_SliceUVDirAndOriginTexFmt = NewSliceUVDirAndOriginTexFmt;
+
+    m_bUnwarpAndFixInscatteringInCS = bUnwarpAndFixInscatteringInCS;
+    m_bUseToneMappingLUT            = bUseToneMappingLUT;
 
     m_FrameAttribs                  = frameAttribs;
     m_FrameAttribs.pcbCameraAttribs = pcbCameraAttribs;
     m_FrameAttribs.pcbLightAttribs  = pcbLightAttribs;
     m_UserResourceIds               = NewUserResourceIds;
 
+    if (m_FrameAttribs.pTransientTexturePool == nullptr)
+        m_FrameAttribs.pTransientTexturePool = m_pTransientTexturePool.get();
+
     if (frameAttribs.pcbCameraAttribs == nullptr)
     {
         if (!m_pcbCameraAttribs)
@@ -2306,22 +3547,18 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
         m_FrameAttribs.pcbLightAttribs = m_pcbLightAttribs;
     }
 
-    if (bRecomputeSctrCoeffs)
-    {
-        m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::PrecomputedOpticalDepthTex;
-        m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::AmbientSkyLightTex;
-        m_uiUpToDateResourceFlags &= ~UpToDateResourceFlags::PrecomputedIntegralsTex;
-        ComputeScatteringCoefficients(m_FrameAttribs.pDeviceContext);
-    }
+    // Scattering coefficients are shared with other effects that use the same look-up tables.
+    // The tables are only recomputed if the coefficient settings change.
+    m_pAtmosphereLUTs->UpdateScatteringCoefficients(m_PostProcessingAttribs, m_FrameAttribs.pDeviceContext);
 
-    if (!m_ptex2DCoordinateTextureRTV)
+    if (!m_ptex2DEpipolarInscatteringRTV)
     {
         CreateEpipolarTextures(m_FrameAttribs.pDevice);
     }
 
-    if (!m_ptex2DSliceEndpointsRTV)
+    if (m_bCompactRayMarchingSamples && !m_pbufRayMarchingSampleList)
     {
-        CreateSliceEndPointsTexture(m_FrameAttribs.pDevice);
+        CreateRayMarchingSampleListBuffers(m_FrameAttribs.pDevice);
     }
 
     if (!m_ptex2DCamSpaceZRTV)
@@ -2329,9 +3566,20 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
         CreateCamSpaceZTexture(m_FrameAttribs.pDevice);
     }
 
-    if (m_PostProcessingAttribs.bEnableLightShafts && m_PostProcessingAttribs.bUse1DMinMaxTree && !m_ptex2DMinMaxShadowMapSRV[0])
+    if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE &&
+        m_PostProcessingAttribs.uiBruteForceDownscaleFactor > 1 && !m_ptex2DDownscaledInsctrRTV)
+    {
+        CreateDownscaledInsctrTextures(m_FrameAttribs.pDevice);
+    }
+
+    if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_FROXEL && !m_ptex3DFroxelIntegratedInsctrUAV)
     {
-        CreateMinMaxShadowMap(m_FrameAttribs.pDevice);
+        CreateFroxelTextures(m_FrameAttribs.pDevice);
+    }
+
+    if (m_bUseSkyViewAndAerialPerspectiveLUTs && !m_ptex3DAerialPerspectiveInsctrUAV)
+    {
+        CreateSkyViewAndAerialPerspectiveTextures(m_FrameAttribs.pDevice);
     }
 
     {
@@ -2346,22 +3594,27 @@ void EpipolarLightScattering::PrepareForNewFrame(FrameAttribs&
     // clang-format on
 }
 
+void EpipolarLightScattering::UpdateAtmosphereLUTs()
+{
+    // The froxel technique uses the tables for scattering beyond the grid
+    const bool bScatteringLUTsRequired = m_PostProcessingAttribs.iMultipleScatteringMode > MULTIPLE_SCTR_MODE_NONE ||
+        m_PostProcessingAttribs.iSingleScatteringMode == SINGLE_SCTR_MODE_LUT ||
+        m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_FROXEL;
+    m_pAtmosphereLUTs->Update(m_FrameAttribs.pDevice, m_FrameAttribs.pDeviceContext, bScatteringLUTsRequired);
+    BindAtmosphereLUTs();
+}
+
 void EpipolarLightScattering::PerformPostProcessing()
 {
     // Note that pecomputation methods change render targets and pipelines
     // (CreateLowResLuminanceTexture changes render targets). If they are moved to
     // PrepareForNewFrame, an application must be required to restore states afterwards
 
-    if (!(m_uiUpToDateResourceFlags & UpToDateResourceFlags::PrecomputedOpticalDepthTex))
-    {
-        PrecomputeOpticalDepthTexture(m_FrameAttribs.pDevice, m_FrameAttribs.pDeviceContext);
-    }
+    UpdateAtmosphereLUTs();
 
-    if ((m_PostProcessingAttribs.iMultipleScatteringMode > MULTIPLE_SCTR_MODE_NONE ||
-         m_PostProcessingAttribs.iSingleScatteringMode == SINGLE_SCTR_MODE_LUT) &&
-        !(m_uiUpToDateResourceFlags & UpToDateResourceFlags::PrecomputedIntegralsTex))
+    if (m_bUseSkyViewAndAerialPerspectiveLUTs)
     {
-        PrecomputeScatteringLUT(m_FrameAttribs.pDevice, m_FrameAttribs.pDeviceContext);
+        ComputeSkyViewAndAerialPerspectiveLUTs();
     }
 
     if (/*m_PostProcessingAttribs.ToneMapping.bAutoExposure &&*/ !m_ptex2DLowResLuminanceRTV)
@@ -2374,6 +3627,11 @@ void EpipolarLightScattering::PerformPostProcessing()
 
     if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_EPIPOLAR_SAMPLING)
     {
+        // Slice end points, coordinates, camera-space z and the epipolar depth-stencil buffer
+        // are alive from here until the epipolar image is unwarped
+        AcquireSliceEndPointsTexture();
+        AcquireCoordinateTextures();
+
         RenderSliceEndpoints();
 
         // Render coordinate texture and camera space z for epipolar location
@@ -2388,14 +3646,24 @@ void EpipolarLightScattering::PerformPostProcessing()
         // Refine initial ray marching samples
         RefineSampleLocations();
 
-        // Mark all ray marching samples in stencil
-        MarkRayMarchingSamples();
+        if (!m_bCompactRayMarchingSamples)
+        {
+            // Mark all ray marching samples in stencil. When samples are compacted,
+            // they are appended to the list by the refinement pass instead
+            MarkRayMarchingSamples();
+        }
 
         if (m_PostProcessingAttribs.bEnableLightShafts && m_PostProcessingAttribs.bUse1DMinMaxTree)
         {
             RenderSliceUVDirAndOrig();
         }
 
+        // Transient textures are only alive from here until the ray marching results are interpolated
+        AcquireInitialScatteredLightTexture();
+        const bool bUse1DMinMaxTree = m_PostProcessingAttribs.bEnableLightShafts && m_PostProcessingAttribs.bUse1DMinMaxTree;
+        if (bUse1DMinMaxTree)
+            AcquireMinMaxShadowMap();
+
         ITextureView* ppRTVs[] = {m_ptex2DInitialScatteredLightRTV};
         m_FrameAttribs.pDeviceContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
         const float Zero[] = {0, 0, 0, 0};
@@ -2405,16 +3673,30 @@ void EpipolarLightScattering::PerformPostProcessing()
         for (int iCascadeInd = m_PostProcessingAttribs.iFirstCascadeToRayMarch; iCascadeInd <= iLastCascade; ++iCascadeInd)
         {
             // Build min/max mip map
-            if (m_PostProcessingAttribs.bEnableLightShafts && m_PostProcessingAttribs.bUse1DMinMaxTree)
+            if (bUse1DMinMaxTree)
             {
-                Build1DMinMaxMipMap(iCascadeInd);
+                if (m_bBuildMinMaxTreeInCS)
+                    Build1DMinMaxMipMapCS(iCascadeInd);
+                else
+                    Build1DMinMaxMipMap(iCascadeInd);
             }
             // Perform ray marching for selected samples
-            DoRayMarching(m_PostProcessingAttribs.uiMaxSamplesOnTheRay, iCascadeInd);
+            if (m_bCompactRayMarchingSamples)
+                RayMarchCompactedSamples(m_PostProcessingAttribs.uiMaxSamplesOnTheRay, iCascadeInd);
+            else
+                DoRayMarching(m_PostProcessingAttribs.uiMaxSamplesOnTheRay, iCascadeInd);
         }
 
+        // Min/max shadow map is not needed after ray marching. Note that depth breaks are
+        // ray marched without the 1D min/max tree.
+        if (bUse1DMinMaxTree)
+            ReleaseMinMaxShadowMap();
+        // Ray marching is the last pass that uses the stencil to select samples
+        m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DEpipolarImageDSV->GetTexture());
+
         // Interpolate ray marching samples onto the rest of samples
         InterpolateInsctrIrradiance();
+        m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DInitialScatteredLightRTV->GetTexture());
 
         if (m_PostProcessingAttribs.ToneMapping.bAutoExposure)
         {
@@ -2426,26 +3708,105 @@ void EpipolarLightScattering::PerformPostProcessing()
 
             UpdateAverageLuminance();
         }
+        if (m_bUnwarpAndFixInscatteringInCS)
+        {
+            // Unwarp inscattering, ray march pixels at depth breaks and write tone mapped
+            // color in a single pass. Depth buffer is not used to mark depth breaks.
+            // The destination buffer must not be bound as render target while it is written by the shader
+            m_FrameAttribs.pDeviceContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+            UnwarpAndFixInscatteringCS();
+
+            if (m_PostProcessingAttribs.bShowSampling)
+            {
+                m_FrameAttribs.pDeviceContext->SetRenderTargets(1, &m_FrameAttribs.ptex2DDstColorBufferRTV, m_FrameAttribs.ptex2DDstDepthBufferDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                RenderSampleLocations();
+            }
+        }
+        else
+        {
+            // Set the main back & depth buffers
+            m_FrameAttribs.pDeviceContext->SetRenderTargets(1, &m_FrameAttribs.ptex2DDstColorBufferRTV, m_FrameAttribs.ptex2DDstDepthBufferDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+            // Clear depth to 1.0.
+            m_FrameAttribs.pDeviceContext->ClearDepthStencil(m_FrameAttribs.ptex2DDstDepthBufferDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            // Transform inscattering irradiance from epipolar coordinates back to rectangular
+            // The shader will write 0.0 to the depth buffer, but all pixel that require inscattering
+            // correction will be discarded and will keep 1.0
+            UnwarpEpipolarScattering(false);
+
+            // Correct inscattering for pixels, for which no suitable interpolation sources were found
+            if (m_PostProcessingAttribs.bCorrectScatteringAtDepthBreaks)
+            {
+                FixInscatteringAtDepthBreaks(m_PostProcessingAttribs.uiNumSamplesOnTheRayAtDepthBreak, EFixInscatteringMode::FixInscattering);
+            }
+
+            if (m_PostProcessingAttribs.bShowSampling)
+            {
+                RenderSampleLocations();
+            }
+        }
+
+        m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DCoordinateTextureRTV->GetTexture());
+        m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DEpipolarCamSpaceZRTV->GetTexture());
+        m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DSliceEndpointsRTV->GetTexture());
+    }
+    else if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE &&
+             m_PostProcessingAttribs.uiBruteForceDownscaleFactor > 1)
+    {
+        // Ray march inscattering at reduced resolution
+        RayMarchDownscaled(m_PostProcessingAttribs.uiMaxSamplesOnTheRay);
+
+        if (m_PostProcessingAttribs.ToneMapping.bAutoExposure)
+        {
+            // Render scene luminance to low-resolution texture
+            ITextureView* pRTVs[] = {m_ptex2DLowResLuminanceRTV};
+            m_FrameAttribs.pDeviceContext->SetRenderTargets(_countof(pRTVs), pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            UpsampleInscattering(true);
+            m_FrameAttribs.pDeviceContext->GenerateMips(m_ptex2DLowResLuminanceSRV);
+
+            UpdateAverageLuminance();
+        }
+
         // Set the main back & depth buffers
         m_FrameAttribs.pDeviceContext->SetRenderTargets(1, &m_FrameAttribs.ptex2DDstColorBufferRTV, m_FrameAttribs.ptex2DDstDepthBufferDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
 
         // Clear depth to 1.0.
         m_FrameAttribs.pDeviceContext->ClearDepthStencil(m_FrameAttribs.ptex2DDstDepthBufferDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-        // Transform inscattering irradiance from epipolar coordinates back to rectangular
-        // The shader will write 0.0 to the depth buffer, but all pixel that require inscattering
-        // correction will be discarded and will keep 1.0
-        UnwarpEpipolarScattering(false);
+        // Upsample inscattering using bilateral filter. The shader will write 0.0 to the depth buffer,
+        // but all pixels for which no suitable low-resolution samples were found will be discarded
+        // and will keep 1.0
+        UpsampleInscattering(false);
 
-        // Correct inscattering for pixels, for which no suitable interpolation sources were found
-        if (m_PostProcessingAttribs.bCorrectScatteringAtDepthBreaks)
-        {
-            FixInscatteringAtDepthBreaks(m_PostProcessingAttribs.uiNumSamplesOnTheRayAtDepthBreak, EFixInscatteringMode::FixInscattering);
-        }
+        // Ray march rejected pixels at full resolution
+        FixInscatteringAtDepthBreaks(m_PostProcessingAttribs.uiMaxSamplesOnTheRay, EFixInscatteringMode::FixInscattering);
+    }
+    else if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_FROXEL)
+    {
+        UpdateFroxelGridAttribs();
+
+        // Evaluate scattering in every froxel and blend it with the reprojected history
+        InjectFroxelInscattering();
+        // Accumulate scattering and extinction along every column of the grid
+        IntegrateFroxelInscattering();
 
-        if (m_PostProcessingAttribs.bShowSampling)
+        if (m_PostProcessingAttribs.ToneMapping.bAutoExposure)
         {
-            RenderSampleLocations();
+            // Render scene luminance to low-resolution texture
+            ITextureView* pRTVs[] = {m_ptex2DLowResLuminanceRTV};
+            m_FrameAttribs.pDeviceContext->SetRenderTargets(_countof(pRTVs), pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ApplyFroxelInscattering(true);
+            m_FrameAttribs.pDeviceContext->GenerateMips(m_ptex2DLowResLuminanceSRV);
+
+            UpdateAverageLuminance();
         }
+
+        // Set the main back & depth buffers
+        m_FrameAttribs.pDeviceContext->SetRenderTargets(1, &m_FrameAttribs.ptex2DDstColorBufferRTV, m_FrameAttribs.ptex2DDstDepthBufferDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        ApplyFroxelInscattering(false);
+
+        // Scattering of this frame becomes the history of the next one
+        m_bFroxelHistoryValid = true;
+        ++m_uiFroxelFrameIndex;
     }
     else if (m_PostProcessingAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE)
     {
@@ -2468,37 +3829,441 @@ void EpipolarLightScattering::PerformPostProcessing()
     }
 }
 
+void EpipolarLightScattering::AddToRenderGraph(RenderGraph&                          Graph,
+                                               const FrameAttribs&                   frameAttribs,
+                                               const EpipolarLightScatteringAttribs& PPAttribs)
+{
+    FrameAttribs PassFrameAttribs = frameAttribs;
+    if (PassFrameAttribs.pTransientTexturePool == nullptr)
+        PassFrameAttribs.pTransientTexturePool = Graph.GetTransientTexturePool();
+
+    // When the destination UAV is provided, epipolar sampling writes the final color in a compute pass
+    // and only uses the render target and depth buffer to visualize samples
+    const auto& DeviceFeatures = frameAttribs.pDevice->GetDeviceInfo().Features;
+    // clang-format off
+    const bool bWriteDstColorInCS = frameAttribs.ptex2DDstColorBufferUAV != nullptr                  &&
+                                    DeviceFeatures.ComputeShaders != DEVICE_FEATURE_STATE_DISABLED  &&
+                                    PPAttribs.iLightSctrTechnique == LIGHT_SCTR_TECHNIQUE_EPIPOLAR_SAMPLING &&
+                                    !PPAttribs.bShowSampling;
+    // clang-format on
+
+    Graph.AddPass(
+        "Epipolar light scattering",
+        [&](RenderGraph::PassBuilder& Builder) {
+            Builder.Read(Graph.ImportTexture(frameAttribs.ptex2DSrcColorBufferSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+            Builder.Read(Graph.ImportTexture(frameAttribs.ptex2DSrcDepthBufferSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+            Builder.Read(Graph.ImportTexture(frameAttribs.ptex2DShadowMapSRV->GetTexture()), RESOURCE_STATE_SHADER_RESOURCE);
+            if (frameAttribs.pcbCameraAttribs != nullptr)
+                Builder.Read(Graph.ImportBuffer(frameAttribs.pcbCameraAttribs), RESOURCE_STATE_CONSTANT_BUFFER);
+            if (frameAttribs.pcbLightAttribs != nullptr)
+                Builder.Read(Graph.ImportBuffer(frameAttribs.pcbLightAttribs), RESOURCE_STATE_CONSTANT_BUFFER);
+
+            if (bWriteDstColorInCS)
+            {
+                Builder.Write(Graph.ImportTexture(frameAttribs.ptex2DDstColorBufferUAV->GetTexture()), RESOURCE_STATE_UNORDERED_ACCESS);
+            }
+            else
+            {
+                Builder.Write(Graph.ImportTexture(frameAttribs.ptex2DDstColorBufferRTV->GetTexture()), RESOURCE_STATE_RENDER_TARGET);
+                Builder.Write(Graph.ImportTexture(frameAttribs.ptex2DDstDepthBufferDSV->GetTexture()), RESOURCE_STATE_DEPTH_WRITE);
+            }
+        },
+        [this, PassFrameAttribs, PassPPAttribs = PPAttribs](IDeviceContext* pContext) mutable {
+            PassFrameAttribs.pDeviceContext = pContext;
+            PrepareForNewFrame(PassFrameAttribs, PassPPAttribs);
+            PerformPostProcessing();
+        });
+}
+
+void EpipolarLightScattering::WarmUp(FrameAttribs&                         frameAttribs,
+                                     const EpipolarLightScatteringAttribs* pAttribs,
+                                     Uint32                                NumAttribs)
+{
+    DEV_CHECK_ERR(pAttribs != nullptr || NumAttribs == 0, "pAttribs must not be null");
+    // Shaders and pipeline states are created on first use and are kept in the caches
+    // after the attributes change, so rendering a frame with every set of attributes
+    // builds all required variants
+    for (Uint32 i = 0; i < NumAttribs; ++i)
+    {
+        auto PPAttribs = pAttribs[i];
+        PrepareForNewFrame(frameAttribs, PPAttribs);
+        PerformPostProcessing();
+    }
+}
+
+bool EpipolarLightScattering::MeasureLowPrecisionError(FrameAttribs&                         frameAttribs,
+                                                       const EpipolarLightScatteringAttribs& PPAttribs,
+                                                       LowPrecisionErrorStats&               Stats)
+{
+    Stats = LowPrecisionErrorStats{};
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(m_BackBufferFmt);
+    // clang-format off
+    const bool Is8BitNormFmt  = FmtAttribs.ComponentSize == 1 &&
+                                (FmtAttribs.ComponentType == COMPONENT_TYPE_UNORM || FmtAttribs.ComponentType == COMPONENT_TYPE_UNORM_SRGB);
+    const bool Is32BitFloatFmt = FmtAttribs.ComponentSize == 4 && FmtAttribs.ComponentType == COMPONENT_TYPE_FLOAT;
+    // clang-format on
+    if (!Is8BitNormFmt && !Is32BitFloatFmt)
+    {
+        LOG_WARNING_MESSAGE("Low precision error can't be measured for ", FmtAttribs.Name, " back buffer format");
+        return false;
+    }
+
+    auto* pDevice  = frameAttribs.pDevice;
+    auto* pContext = frameAttribs.pDeviceContext;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Low precision error measurement depth";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = m_uiBackBufferWidth;
+    TexDesc.Height    = m_uiBackBufferHeight;
+    TexDesc.MipLevels = 1;
+    TexDesc.Format    = m_DepthBufferFmt;
+    TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+    RefCntAutoPtr<ITexture> ptex2DDepth;
+    pDevice->CreateTexture(TexDesc, nullptr, &ptex2DDepth);
+
+    RefCntAutoPtr<ITexture> ptex2DStaging[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        TexDesc.Name      = "Low precision error measurement target";
+        TexDesc.Format    = m_BackBufferFmt;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        TexDesc.BindFlags = BIND_RENDER_TARGET;
+        RefCntAutoPtr<ITexture> ptex2DColor;
+        pDevice->CreateTexture(TexDesc, nullptr, &ptex2DColor);
+
+        TexDesc.Name           = "Low precision error measurement staging texture";
+        TexDesc.Usage          = USAGE_STAGING;
+        TexDesc.BindFlags      = BIND_NONE;
+        TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateTexture(TexDesc, nullptr, &ptex2DStaging[i]);
+        TexDesc.CPUAccessFlags = CPU_ACCESS_NONE;
+
+        if (!ptex2DDepth || !ptex2DColor || !ptex2DStaging[i])
+        {
+            LOG_ERROR_MESSAGE("Failed to create textures for low precision error measurement");
+            return false;
+        }
+
+        auto MeasureFrameAttribs                    = frameAttribs;
+        MeasureFrameAttribs.ptex2DDstColorBufferRTV = ptex2DColor->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        MeasureFrameAttribs.ptex2DDstDepthBufferDSV = ptex2DDepth->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+        MeasureFrameAttribs.ptex2DDstColorBufferUAV = nullptr;
+        // Do not let light adaptation change the average luminance between the two frames
+        MeasureFrameAttribs.dElapsedTime = 0;
+
+        auto MeasurePPAttribs                          = PPAttribs;
+        MeasurePPAttribs.bUseLowPrecisionIntermediates = i == 0 ? FALSE : TRUE;
+
+        PrepareForNewFrame(MeasureFrameAttribs, MeasurePPAttribs);
+        PerformPostProcessing();
+
+        CopyTextureAttribs CopyAttribs(ptex2DColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, ptex2DStaging[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyTexture(CopyAttribs);
+    }
+
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData[2];
+    for (int i = 0; i < 2; ++i)
+        pContext->MapTextureSubresource(ptex2DStaging[i], 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData[i]);
+
+    // Alpha channel is not compared
+    const Uint32 NumComponents = std::min(Uint32{FmtAttribs.NumComponents}, Uint32{3});
+    const Uint32 PixelSize     = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+
+    double TotalAbsError      = 0;
+    double TotalSqrError      = 0;
+    Uint64 NumDifferentPixels = 0;
+    for (Uint32 y = 0; y < m_uiBackBufferHeight; ++y)
+    {
+        const auto* pRow0 = reinterpret_cast<const Uint8*>(MappedData[0].pData) + y * MappedData[0].Stride;
+        const auto* pRow1 = reinterpret_cast<const Uint8*>(MappedData[1].pData) + y * MappedData[1].Stride;
+        for (Uint32 x = 0; x < m_uiBackBufferWidth; ++x)
+        {
+            bool bPixelDiffers = false;
+            for (Uint32 c = 0; c < NumComponents; ++c)
+            {
+                float Val0, Val1;
+                if (Is8BitNormFmt)
+                {
+                    Val0 = static_cast<float>(pRow0[x * PixelSize + c]) / 255.f;
+                    Val1 = static_cast<float>(pRow1[x * PixelSize + c]) / 255.f;
+                }
+                else
+                {
+                    Val0 = reinterpret_cast<const float*>(pRow0 + x * PixelSize)[c];
+                    Val1 = reinterpret_cast<const float*>(pRow1 + x * PixelSize)[c];
+                }
+
+                const auto AbsError = std::abs(Val1 - Val0);
+                Stats.MaxError      = std::max(Stats.MaxError, AbsError);
+                TotalAbsError += AbsError;
+                TotalSqrError += AbsError * AbsError;
+                bPixelDiffers = bPixelDiffers || AbsError > 0;
+            }
+            if (bPixelDiffers)
+                ++NumDifferentPixels;
+        }
+    }
+
+    for (int i = 0; i < 2; ++i)
+        pContext->UnmapTextureSubresource(ptex2DStaging[i], 0, 0);
+
+    const double NumPixels        = static_cast<double>(m_uiBackBufferWidth) * static_cast<double>(m_uiBackBufferHeight);
+    const double MeanSqrError     = TotalSqrError / (NumPixels * NumComponents);
+    Stats.MeanError               = static_cast<float>(TotalAbsError / (NumPixels * NumComponents));
+    Stats.DifferentPixelsFraction = static_cast<float>(NumDifferentPixels / NumPixels);
+    // Peak value is 1, since the output is tone mapped
+    Stats.PSNR = MeanSqrError > 0 ? static_cast<float>(10.0 * log10(1.0 / MeanSqrError)) : std::numeric_limits<float>::infinity();
+
+    return true;
+}
+
+
+void EpipolarLightScattering::AcquireSliceEndPointsTexture()
+{
+    // NumSlices x 1 RGBA32F texture to store end point coordinates for every epipolar slice.
+    // The texture is only used until the epipolar image is unwarped, so it is taken from
+    // the transient texture pool.
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Slice Endpoints";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.MipLevels = 1;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.Width     = m_PostProcessingAttribs.uiNumEpipolarSlices;
+    TexDesc.Height    = 1;
+    TexDesc.Format    = m_SliceEndpointsFmt;
+
+    TexDesc.ClearValue.Format   = TexDesc.Format;
+    TexDesc.ClearValue.Color[0] = -1e+30f;
+    TexDesc.ClearValue.Color[1] = -1e+30f;
+    TexDesc.ClearValue.Color[2] = -1e+30f;
+    TexDesc.ClearValue.Color[3] = -1e+30f;
+
+    ITexture* pPrevTexture = m_ptex2DSliceEndpointsRTV ? m_ptex2DSliceEndpointsRTV->GetTexture() : nullptr;
+
+    auto tex2DSliceEndpoints = m_FrameAttribs.pTransientTexturePool->Acquire(TexDesc, pPrevTexture);
+    if (tex2DSliceEndpoints == pPrevTexture)
+        return;
+
+    auto* tex2DSliceEndpointsSRV = tex2DSliceEndpoints->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_ptex2DSliceEndpointsRTV    = tex2DSliceEndpoints->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    tex2DSliceEndpointsSRV->SetSampler(m_pLinearClampSampler);
+    m_pResMapping->AddResource("g_tex2DSliceEndPoints", tex2DSliceEndpointsSRV, false);
+
+    for (int i = 0; i < RENDER_TECH_TOTAL_TECHNIQUES; ++i)
+        m_RenderTech[i].CheckStaleFlags(0, SRB_DEPENDENCY_SLICE_END_POINTS_TEX);
+}
+
+void EpipolarLightScattering::AcquireCoordinateTextures()
+{
+    // The coordinate texture, camera-space z and the depth-stencil buffer are only used
+    // until the epipolar image is unwarped, so they are taken from the transient texture pool.
+    TextureDesc TexDesc;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.MipLevels = 1;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.Width     = m_PostProcessingAttribs.uiMaxSamplesInSlice;
+    TexDesc.Height    = m_PostProcessingAttribs.uiNumEpipolarSlices;
+
+    Uint32 StaleSRBDependencies = 0;
+    {
+        // MaxSamplesInSlice x NumSlices RG32F texture to store screen-space coordinates
+        // for every epipolar sample
+        TexDesc.Name                = "Coordinate Texture";
+        TexDesc.Format              = m_CoordinateTexFmt;
+        TexDesc.ClearValue.Format   = TexDesc.Format;
+        TexDesc.ClearValue.Color[0] = -1e+30f;
+        TexDesc.ClearValue.Color[1] = -1e+30f;
+        TexDesc.ClearValue.Color[2] = -1e+30f;
+        TexDesc.ClearValue.Color[3] = -1e+30f;
+
+        ITexture* pPrevTexture = m_ptex2DCoordinateTextureRTV ? m_ptex2DCoordinateTextureRTV->GetTexture() : nullptr;
+
+        auto tex2DCoordinateTexture = m_FrameAttribs.pTransientTexturePool->Acquire(TexDesc, pPrevTexture);
+        if (tex2DCoordinateTexture != pPrevTexture)
+        {
+            auto* tex2DCoordinateTextureSRV = tex2DCoordinateTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+            m_ptex2DCoordinateTextureRTV    = tex2DCoordinateTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+            tex2DCoordinateTextureSRV->SetSampler(m_pLinearClampSampler);
+            m_pResMapping->AddResource("g_tex2DCoordinates", tex2DCoordinateTextureSRV, false);
+            StaleSRBDependencies |= SRB_DEPENDENCY_COORDINATE_TEX;
+        }
+    }
+
+    {
+        // MaxSamplesInSlice x NumSlices R32F texture to store camera-space Z coordinate,
+        // for every epipolar sample
+        TexDesc.Name              = "Epipolar Cam Space Z";
+        TexDesc.Format            = EpipolarCamSpaceZFmt;
+        TexDesc.ClearValue.Format = TexDesc.Format;
+
+        ITexture* pPrevTexture = m_ptex2DEpipolarCamSpaceZRTV ? m_ptex2DEpipolarCamSpaceZRTV->GetTexture() : nullptr;
+
+        auto tex2DEpipolarCamSpaceZ = m_FrameAttribs.pTransientTexturePool->Acquire(TexDesc, pPrevTexture);
+        if (tex2DEpipolarCamSpaceZ != pPrevTexture)
+        {
+            auto* tex2DEpipolarCamSpaceZSRV = tex2DEpipolarCamSpaceZ->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+            m_ptex2DEpipolarCamSpaceZRTV    = tex2DEpipolarCamSpaceZ->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+            tex2DEpipolarCamSpaceZSRV->SetSampler(m_pLinearClampSampler);
+            m_pResMapping->AddResource("g_tex2DEpipolarCamSpaceZ", tex2DEpipolarCamSpaceZSRV, false);
+            StaleSRBDependencies |= SRB_DEPENDENCY_EPIPOLAR_CAM_SPACE_Z_TEX;
+        }
+    }
+
+    {
+        // MaxSamplesInSlice x NumSlices depth stencil texture to mark samples for processing,
+        // for every epipolar sample
+        TexDesc.Name   = "Epipolar Image Depth";
+        TexDesc.Format = TEX_FORMAT_UNKNOWN;
+        for (auto Fmt : {EpipolarImageDepthFmt0, EpipolarImageDepthFmt1})
+        {
+            const auto& FmtInfo = m_FrameAttribs.pDevice->GetTextureFormatInfoExt(Fmt);
+            if (FmtInfo.BindFlags & BIND_DEPTH_STENCIL)
+            {
+                TexDesc.Format = Fmt;
+                break;
+            }
+        }
+        if (TexDesc.Format == TEX_FORMAT_UNKNOWN)
+            LOG_ERROR_AND_THROW("Failed to find suitable depth-stencil format for epipolar image depth buffer");
+
+        TexDesc.BindFlags                       = BIND_DEPTH_STENCIL;
+        TexDesc.ClearValue.Format               = TexDesc.Format;
+        TexDesc.ClearValue.DepthStencil.Depth   = 1;
+        TexDesc.ClearValue.DepthStencil.Stencil = 0;
+
+        ITexture* pPrevTexture = m_ptex2DEpipolarImageDSV ? m_ptex2DEpipolarImageDSV->GetTexture() : nullptr;
+
+        auto tex2DEpipolarImageDepth = m_FrameAttribs.pTransientTexturePool->Acquire(TexDesc, pPrevTexture);
+        if (tex2DEpipolarImageDepth != pPrevTexture)
+        {
+            m_ptex2DEpipolarImageDSV = tex2DEpipolarImageDepth->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+            StaleSRBDependencies |= SRB_DEPENDENCY_EPIPOLAR_IMAGE_DEPTH;
+        }
+    }
+
+    if (StaleSRBDependencies != 0)
+    {
+        for (int i = 0; i < RENDER_TECH_TOTAL_TECHNIQUES; ++i)
+            m_RenderTech[i].CheckStaleFlags(0, StaleSRBDependencies);
+    }
+}
+
+void EpipolarLightScattering::AcquireInitialScatteredLightTexture()
+{
+    // MaxSamplesInSlice x NumSlices RGBA16F texture to store initial inscattered light,
+    // for every epipolar sample. The texture is only used between ray marching and
+    // interpolation, so it is taken from the transient texture pool.
+    TextureDesc TexDesc;
+    TexDesc.Name                = "Initial Scattered Light";
+    TexDesc.Type                = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width               = m_PostProcessingAttribs.uiMaxSamplesInSlice;
+    TexDesc.Height              = m_PostProcessingAttribs.uiNumEpipolarSlices;
+    TexDesc.MipLevels           = 1;
+    TexDesc.Format              = EpipolarInsctrTexFmt;
+    TexDesc.Usage               = USAGE_DEFAULT;
+    TexDesc.BindFlags           = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.ClearValue.Format   = TexDesc.Format;
+    TexDesc.ClearValue.Color[0] = 0;
+    TexDesc.ClearValue.Color[1] = 0;
+    TexDesc.ClearValue.Color[2] = 0;
+    TexDesc.ClearValue.Color[3] = 0;
+    if (m_bCompactRayMarchingSamples)
+    {
+        // Compacted ray marching samples are processed by the compute shader
+        TexDesc.BindFlags |= BIND_UNORDERED_ACCESS;
+    }
+
+    ITexture* pPrevTexture = m_ptex2DInitialScatteredLightRTV ? m_ptex2DInitialScatteredLightRTV->GetTexture() : nullptr;
+
+    auto tex2DInitialScatteredLight = m_FrameAttribs.pTransientTexturePool->Acquire(TexDesc, pPrevTexture);
+    if (tex2DInitialScatteredLight == pPrevTexture)
+        return;
+
+    auto* tex2DInitialScatteredLightSRV = tex2DInitialScatteredLight->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_ptex2DInitialScatteredLightRTV    = tex2DInitialScatteredLight->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    tex2DInitialScatteredLightSRV->SetSampler(m_pLinearClampSampler);
+    m_pResMapping->AddResource("g_tex2DInitialInsctrIrradiance", tex2DInitialScatteredLightSRV, false);
+    if (m_bCompactRayMarchingSamples)
+    {
+        auto* tex2DInitialScatteredLightUAV = tex2DInitialScatteredLight->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+        m_pResMapping->AddResource("g_rwtex2DInitialScatteredLight", tex2DInitialScatteredLightUAV, false);
+    }
+
+    for (int i = 0; i < RENDER_TECH_TOTAL_TECHNIQUES; ++i)
+        m_RenderTech[i].CheckStaleFlags(0, SRB_DEPENDENCY_INITIAL_SCTR_LIGHT_TEX);
+}
 
-void EpipolarLightScattering::CreateMinMaxShadowMap(IRenderDevice* pDevice)
+void EpipolarLightScattering::AcquireMinMaxShadowMap()
 {
     TextureDesc MinMaxShadowMapTexDesc;
     MinMaxShadowMapTexDesc.Type      = RESOURCE_DIM_TEX_2D;
     MinMaxShadowMapTexDesc.Width     = m_PostProcessingAttribs.uiMinMaxShadowMapResolution;
     MinMaxShadowMapTexDesc.Height    = m_PostProcessingAttribs.uiNumEpipolarSlices;
     MinMaxShadowMapTexDesc.MipLevels = 1;
-    MinMaxShadowMapTexDesc.Format    = m_PostProcessingAttribs.bIs32BitMinMaxMipMap ? TEX_FORMAT_RG32_FLOAT : TEX_FORMAT_RG16_UNORM;
+    MinMaxShadowMapTexDesc.Format    = m_PostProcessingAttribs.bIs32BitMinMaxMipMap ? MinMaxShadowMap32BitFmt : MinMaxShadowMap16BitFmt;
     MinMaxShadowMapTexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+    if (m_bBuildMinMaxTreeInCS)
+    {
+        // All levels are written by the compute shader directly
+        MinMaxShadowMapTexDesc.BindFlags |= BIND_UNORDERED_ACCESS;
+    }
 
     if (m_bUseCombinedMinMaxTexture)
     {
         MinMaxShadowMapTexDesc.Height *= (m_PostProcessingAttribs.iNumCascades - m_PostProcessingAttribs.iFirstCascadeToRayMarch);
     }
 
+    bool bTexturesChanged = false;
     for (int i = 0; i < 2; ++i)
     {
+        // The compute shader builds the tree in a single texture, so the second one is not needed
+        if (m_bBuildMinMaxTreeInCS && i > 0)
+            break;
+
         std::string name = "MinMaxShadowMap";
         name.push_back('0' + char(i));
         MinMaxShadowMapTexDesc.Name = name.c_str();
-        m_ptex2DMinMaxShadowMapSRV[i].Release();
-        m_ptex2DMinMaxShadowMapRTV[i].Release();
-        RefCntAutoPtr<ITexture> ptex2DMinMaxShadowMap;
-        // Create 2-D texture, shader resource and target view buffers on the device
-        pDevice->CreateTexture(MinMaxShadowMapTexDesc, nullptr, &ptex2DMinMaxShadowMap);
+
+        ITexture* pPrevTexture = m_ptex2DMinMaxShadowMapRTV[i] ? m_ptex2DMinMaxShadowMapRTV[i]->GetTexture() : nullptr;
+
+        auto ptex2DMinMaxShadowMap = m_FrameAttribs.pTransientTexturePool->Acquire(MinMaxShadowMapTexDesc, pPrevTexture);
+        if (ptex2DMinMaxShadowMap == pPrevTexture)
+            continue;
+
         m_ptex2DMinMaxShadowMapSRV[i] = ptex2DMinMaxShadowMap->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
         m_ptex2DMinMaxShadowMapSRV[i]->SetSampler(m_pLinearClampSampler);
         m_ptex2DMinMaxShadowMapRTV[i] = ptex2DMinMaxShadowMap->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
 
-        m_pResMapping->AddResource("g_tex2DMinMaxLightSpaceDepth", m_ptex2DMinMaxShadowMapSRV[0], false);
+        if (i == 0)
+        {
+            m_pResMapping->AddResource("g_tex2DMinMaxLightSpaceDepth", m_ptex2DMinMaxShadowMapSRV[0], false);
+            if (m_bBuildMinMaxTreeInCS)
+                m_pResMapping->AddResource("g_rwtex2DMinMaxLightSpaceDepth", ptex2DMinMaxShadowMap->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS), false);
+        }
+        bTexturesChanged = true;
+    }
+
+    if (bTexturesChanged)
+    {
+        m_pComputeMinMaxSMLevelSRB[0].Release();
+        m_pComputeMinMaxSMLevelSRB[1].Release();
+        for (int i = 0; i < RENDER_TECH_TOTAL_TECHNIQUES; ++i)
+            m_RenderTech[i].CheckStaleFlags(0, SRB_DEPENDENCY_MIN_MAX_SHADOW_MAP);
+    }
+}
+
+void EpipolarLightScattering::ReleaseMinMaxShadowMap()
+{
+    for (size_t i = 0; i < _countof(m_ptex2DMinMaxShadowMapRTV); ++i)
+    {
+        if (m_ptex2DMinMaxShadowMapRTV[i] && !(m_bBuildMinMaxTreeInCS && i > 0))
+            m_FrameAttribs.pTransientTexturePool->Release(m_ptex2DMinMaxShadowMapRTV[i]->GetTexture());
     }
 }
 
@@ -2564,19 +4329,21 @@ void EpipolarLightScattering::ComputeSunColor(const float3& vDirectionOnSun,
     f4AmbientLight.z   = std::max(0.005f, zenithFactor * 0.25f);
     f4AmbientLight.w   = 0.0f;
 
-    float2 f2NetParticleDensityToAtmTop = GetDensityIntegralFromChapmanFunc(0, float3(0, 1, 0), vDirectionOnSun, m_MediaParams);
+    const auto& MediaParams = m_pAtmosphereLUTs->GetMediaParams();
+
+    float2 f2NetParticleDensityToAtmTop = GetDensityIntegralFromChapmanFunc(0, float3(0, 1, 0), vDirectionOnSun, MediaParams);
 
 
-    float3      f3RlghExtCoeff     = std::max((float3&)m_MediaParams.f4RayleighExtinctionCoeff, float3(1e-8f, 1e-8f, 1e-8f));
+    float3      f3RlghExtCoeff     = std::max((float3&)MediaParams.f4RayleighExtinctionCoeff, float3(1e-8f, 1e-8f, 1e-8f));
     float3      f3RlghOpticalDepth = f3RlghExtCoeff * f2NetParticleDensityToAtmTop.x;
-    float3      f3MieExtCoeff      = std::max((float3&)m_MediaParams.f4MieExtinctionCoeff, float3(1e-8f, 1e-8f, 1e-8f));
+    float3      f3MieExtCoeff      = std::max((float3&)MediaParams.f4MieExtinctionCoeff, float3(1e-8f, 1e-8f, 1e-8f));
     float3      f3MieOpticalDepth  = f3MieExtCoeff * f2NetParticleDensityToAtmTop.y;
     float3      f3TotalExtinction  = exp(-(f3RlghOpticalDepth + f3MieOpticalDepth));
     const float fEarthReflectance  = 0.1f; // See [BN08]
     (float3&)f4SunColorAtGround    = ((float3&)f4ExtraterrestrialSunColor) * f3TotalExtinction * fEarthReflectance;
 }
 
-void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDeviceCtx)
+void AtmosphereLUTs::ComputeScatteringCoefficients(IDeviceContext* pDeviceCtx)
 {
     // For details, see "A practical Analytic Model for Daylight" by Preetham & Hoffman, p.23
 
@@ -2605,8 +4372,8 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
         for (int WaveNum = 0; WaveNum < 3; WaveNum++)
         {
             double dSctrCoeff;
-            if (m_PostProcessingAttribs.bUseCustomSctrCoeffs)
-                dSctrCoeff = f4TotalRayleighSctrCoeff[WaveNum] = m_PostProcessingAttribs.f4CustomRlghBeta[WaveNum];
+            if (m_SctrCoeffsAttribs.bUseCustomSctrCoeffs)
+                dSctrCoeff = f4TotalRayleighSctrCoeff[WaveNum] = m_SctrCoeffsAttribs.f4CustomRlghBeta[WaveNum];
             else
             {
                 double Lambda2 = dWaveLengths[WaveNum] * dWaveLengths[WaveNum];
@@ -2626,7 +4393,7 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
         f4RayleighExtinctionCoeff = f4TotalRayleighSctrCoeff;
     }
 
-    if (m_PostProcessingAttribs.bUseOzoneApproximation)
+    if (m_SctrCoeffsAttribs.bUseOzoneApproximation)
     {
         // As noted in [1], taking into account ozone particle absorption is essential to reproduce
         // the blue of the zenith sky. Without ozone, the sky can appear too yellow overall, especially
@@ -2637,9 +4404,9 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
         // 1. Physically Based Sky, Atmosphere and Cloud Rendering in Frostbite, Sebastien Hillaire
         //    (Physically-Based Shading in Theory and Practice, Siggraph 2016)
 
-        if (m_PostProcessingAttribs.bUseCustomSctrCoeffs)
+        if (m_SctrCoeffsAttribs.bUseCustomSctrCoeffs)
         {
-            m_MediaParams.f4RayleighExtinctionCoeff += m_PostProcessingAttribs.f4CustomOzoneAbsorption;
+            m_MediaParams.f4RayleighExtinctionCoeff += m_SctrCoeffsAttribs.f4CustomOzoneAbsorption;
         }
         else
         {
@@ -2659,9 +4426,9 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
         float4& f4TotalMieSctrCoeff   = m_MediaParams.f4TotalMieSctrCoeff;
         float4& f4MieExtinctionCoeff  = m_MediaParams.f4MieExtinctionCoeff;
 
-        if (m_PostProcessingAttribs.bUseCustomSctrCoeffs)
+        if (m_SctrCoeffsAttribs.bUseCustomSctrCoeffs)
         {
-            f4TotalMieSctrCoeff = m_PostProcessingAttribs.f4CustomMieBeta * m_PostProcessingAttribs.fAerosolDensityScale;
+            f4TotalMieSctrCoeff = m_SctrCoeffsAttribs.f4CustomMieBeta * m_SctrCoeffsAttribs.fAerosolDensityScale;
         }
         else
         {
@@ -2702,7 +4469,7 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
                 // [BN08] uses the following value (independent of wavelength) for Mie scattering coefficient: 2e-5
                 // For g=0.76 and MieBetha=2e-5 [BN08] was able to reproduce the same luminance as given by the
                 // reference CIE sky light model
-                const float fMieBethaBN08         = 2e-5f * m_PostProcessingAttribs.fAerosolDensityScale;
+                const float fMieBethaBN08         = 2e-5f * m_SctrCoeffsAttribs.fAerosolDensityScale;
                 m_MediaParams.f4TotalMieSctrCoeff = float4(fMieBethaBN08, fMieBethaBN08, fMieBethaBN08, 0);
             }
         }
@@ -2715,7 +4482,7 @@ void EpipolarLightScattering::ComputeScatteringCoefficients(IDeviceContext* pDev
             // function. 1/(4*PI) is baked into the f4AngularMieSctrCoeff, the other terms are baked into f4CS_g
             f4AngularMieSctrCoeff[WaveNum] = f4TotalMieSctrCoeff[WaveNum] / (4.f * PI_F);
             // [BN08] also uses slight absorption factor which is 10% of scattering
-            f4MieExtinctionCoeff[WaveNum] = f4TotalMieSctrCoeff[WaveNum] * (1.f + m_PostProcessingAttribs.fAerosolAbsorbtionScale);
+            f4MieExtinctionCoeff[WaveNum] = f4TotalMieSctrCoeff[WaveNum] * (1.f + m_SctrCoeffsAttribs.fAerosolAbsorbtionScale);
         }
     }
 
@@ -2812,7 +4579,7 @@ void EpipolarLightScattering::RenderSun(TEXTURE_FORMAT RTVFormat,
     m_FrameAttribs.pDeviceContext->Draw(DrawAttrs);
 }
 
-void EpipolarLightScattering::ComputeAmbientSkyLightTexture(IRenderDevice* pDevice, IDeviceContext* pContext)
+void AtmosphereLUTs::ComputeAmbientSkyLightTexture(IRenderDevice* pDevice, IDeviceContext* pContext)
 {
     if (!(m_uiUpToDateResourceFlags & UpToDateResourceFlags::PrecomputedOpticalDepthTex))
     {
@@ -2830,8 +4597,8 @@ void EpipolarLightScattering::ComputeAmbientSkyLightTexture(IRenderDevice* pDevi
         ShaderMacroHelper Macros;
         Macros.AddShaderMacro("NUM_RANDOM_SPHERE_SAMPLES", static_cast<Int32>(m_uiNumRandomSamplesOnSphere));
         Macros.Finalize();
-        auto pPrecomputeAmbientSkyLightPS = CreateShader(pDevice, "PrecomputeAmbientSkyLight.fx", "PrecomputeAmbientSkyLightPS",
-                                                         SHADER_TYPE_PIXEL, Macros);
+        auto pPrecomputeAmbientSkyLightPS = CreateShaderFromFile(pDevice, "PrecomputeAmbientSkyLight.fx", "PrecomputeAmbientSkyLightPS",
+                                                                 SHADER_TYPE_PIXEL, Macros);
 
         PipelineResourceLayoutDesc ResourceLayout;
         ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
@@ -2852,6 +4619,31 @@ void EpipolarLightScattering::ComputeAmbientSkyLightTexture(IRenderDevice* pDevi
 
 
 ITextureView* EpipolarLightScattering::GetAmbientSkyLightSRV(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    return m_pAtmosphereLUTs->GetAmbientSkyLightSRV(pDevice, pContext);
+}
+
+IBuffer* EpipolarLightScattering::GetMediaAttribsCB()
+{
+    return m_pAtmosphereLUTs->GetMediaAttribsCB();
+}
+
+ITextureView* EpipolarLightScattering::GetPrecomputedNetDensitySRV()
+{
+    return m_pAtmosphereLUTs->GetPrecomputedNetDensitySRV();
+}
+
+ITextureView* EpipolarLightScattering::GetAverageLuminanceSRV(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    if (!m_ptex2DLowResLuminanceRTV)
+    {
+        CreateLowResLuminanceTexture(pDevice, pContext);
+    }
+
+    return m_ptex2DAverageLuminanceRTV->GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+}
+
+ITextureView* AtmosphereLUTs::GetAmbientSkyLightSRV(IRenderDevice* pDevice, IDeviceContext* pContext)
 {
     if (!(m_uiUpToDateResourceFlags & UpToDateResourceFlags::AmbientSkyLightTex))
     {
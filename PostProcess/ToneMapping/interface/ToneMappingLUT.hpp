@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/Buffer.h"
+#include "../../../../DiligentCore/Graphics/GraphicsEngine/interface/TextureView.h"
+#include "../../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+#include "../../../../DiligentCore/Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+using uint = uint32_t;
+
+#include "Shaders/PostProcess/ToneMapping/public/ToneMappingStructures.fxh"
+
+/// Bakes the tone mapping operator and optional color grading into a 3D look-up table.
+
+/// The table is indexed by log2-encoded exposed color, so that shaders replace the evaluation
+/// of the tone mapping curve with a single texture fetch, see ToneMapLUT() in ToneMapping.fxh.
+/// The exposure is applied before the look-up, so the table does not depend on the scene
+/// luminance and is only rebuilt when the tone mapping or grading parameters change.
+/// Building the table requires compute shaders.
+class ToneMappingLUT
+{
+public:
+    /// Color grading applied after tone mapping
+    struct ColorGradingAttribs
+    {
+        /// Color filter the tone mapped color is multiplied by.
+        float3 ColorFilter = float3{1, 1, 1};
+
+        /// Saturation: 0 - grayscale, 1 - unchanged.
+        float Saturation = 1;
+
+        /// Contrast around the middle gray: 1 - unchanged.
+        float Contrast = 1;
+
+        bool operator==(const ColorGradingAttribs& rhs) const
+        {
+            return ColorFilter == rhs.ColorFilter && Saturation == rhs.Saturation && Contrast == rhs.Contrast;
+        }
+        bool operator!=(const ColorGradingAttribs& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    /// The table dimension, must match TONE_MAPPING_LUT_DIM in ToneMapping.fxh.
+    static constexpr Uint32 LUTDim = 32;
+
+    explicit ToneMappingLUT(IRenderDevice* pDevice);
+
+    /// Rebuilds the table if the parameters have changed since the last call.
+
+    /// \param [in] pDevice     - Render device.
+    /// \param [in] pCtx        - Device context.
+    /// \param [in] ToneMapping - Tone mapping attributes. Exposure-related members
+    ///                           (fMiddleGray, bAutoExposure, bLightAdaptation) do not affect the table.
+    /// \param [in] Grading     - Color grading attributes.
+    /// \return     true if the table was rebuilt, and false otherwise.
+    bool Update(IRenderDevice*             pDevice,
+                IDeviceContext*            pCtx,
+                const ToneMappingAttribs&  ToneMapping,
+                const ColorGradingAttribs& Grading = ColorGradingAttribs{});
+
+    /// Returns the shader resource view of the table, or null if the table has not been built.
+    /// The view uses linear clamp sampler.
+    ITextureView* GetSRV() const
+    {
+        return m_IsValid ? m_pLUTSRV.RawPtr() : nullptr;
+    }
+
+private:
+    void CreatePSO(IRenderDevice* pDevice, int ToneMappingMode);
+
+    static constexpr Uint32 ThreadGroupSize = 4;
+
+    RefCntAutoPtr<ITextureView>           m_pLUTSRV;
+    RefCntAutoPtr<ITextureView>           m_pLUTUAV;
+    RefCntAutoPtr<IBuffer>                m_pAttribsCB;
+    RefCntAutoPtr<IPipelineState>         m_pBuildLUTPSO;
+    RefCntAutoPtr<IShaderResourceBinding> m_pBuildLUTSRB;
+
+    // Tone mapping mode the PSO was created for
+    int m_PSOToneMappingMode = -1;
+
+    // Parameters the table was built with
+    ToneMappingAttribs  m_ToneMapping;
+    ColorGradingAttribs m_Grading;
+    bool                m_IsValid = false;
+};
+
+} // namespace Diligent
@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "ToneMappingLUT.hpp"
+
+#include "../../../Utilities/include/DiligentFXShaderSourceStreamFactory.hpp"
+#include "../../../Utilities/include/DiligentFXShaderArchive.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "GraphicsUtilities.h"
+#include "CommonlyUsedStates.h"
+#include "MapHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct ToneMappingLUTAttribs
+{
+    ToneMappingAttribs ToneMapping;
+
+    float4 ColorFilter;
+    float4 GradingParams;
+};
+
+} // namespace
+
+ToneMappingLUT::ToneMappingLUT(IRenderDevice* pDevice)
+{
+    if (pDevice->GetDeviceInfo().Features.ComputeShaders == DEVICE_FEATURE_STATE_DISABLED)
+    {
+        LOG_WARNING_MESSAGE("Tone mapping look-up table requires compute shaders");
+        return;
+    }
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Tone mapping LUT";
+    TexDesc.Type      = RESOURCE_DIM_TEX_3D;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+    TexDesc.Width     = LUTDim;
+    TexDesc.Height    = LUTDim;
+    TexDesc.Depth     = LUTDim;
+    TexDesc.Format    = TEX_FORMAT_RGBA16_FLOAT;
+    TexDesc.MipLevels = 1;
+
+    RefCntAutoPtr<ITexture> pLUT;
+    pDevice->CreateTexture(TexDesc, nullptr, &pLUT);
+    m_pLUTSRV = pLUT->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    m_pLUTUAV = pLUT->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+
+    RefCntAutoPtr<ISampler> pLinearClampSampler;
+    pDevice->CreateSampler(Sam_LinearClamp, &pLinearClampSampler);
+    m_pLUTSRV->SetSampler(pLinearClampSampler);
+
+    CreateUniformBuffer(pDevice, sizeof(ToneMappingLUTAttribs), "Tone mapping LUT attribs CB", &m_pAttribsCB);
+}
+
+void ToneMappingLUT::CreatePSO(IRenderDevice* pDevice, int ToneMappingMode)
+{
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TONE_MAPPING_MODE", ToneMappingMode);
+    Macros.AddShaderMacro("TONE_MAPPING_LUT_DIM", static_cast<Int32>(LUTDim));
+    Macros.AddShaderMacro("THREAD_GROUP_SIZE", static_cast<Int32>(ThreadGroupSize));
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.pShaderSourceStreamFactory = &DiligentFXShaderSourceStreamFactory::GetInstance();
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc.Name                  = "Build tone mapping LUT CS";
+    ShaderCI.FilePath                   = "BuildToneMappingLUT.csh";
+    ShaderCI.Macros                     = Macros;
+    auto pCS = DiligentFXShaderArchive::GetInstance().CreateShader(pDevice, ShaderCI);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PipelineStateDesc&             PSODesc = PSOCreateInfo.PSODesc;
+
+    PSODesc.Name         = "Build tone mapping LUT PSO";
+    PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS    = pCS;
+
+    PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+
+    m_pBuildLUTPSO.Release();
+    m_pBuildLUTSRB.Release();
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &m_pBuildLUTPSO);
+    m_pBuildLUTPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbToneMappingLUTAttribs")->Set(m_pAttribsCB);
+    m_pBuildLUTPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "g_rwtex3DToneMappingLUT")->Set(m_pLUTUAV);
+    m_pBuildLUTPSO->CreateShaderResourceBinding(&m_pBuildLUTSRB, true);
+
+    m_PSOToneMappingMode = ToneMappingMode;
+}
+
+bool ToneMappingLUT::Update(IRenderDevice*             pDevice,
+                            IDeviceContext*            pCtx,
+                            const ToneMappingAttribs&  ToneMapping,
+                            const ColorGradingAttribs& Grading)
+{
+    if (!m_pLUTSRV)
+        return false;
+
+    // Only the members used by the tone mapping curves affect the table
+    if (m_IsValid &&
+        ToneMapping.iToneMappingMode == m_ToneMapping.iToneMappingMode &&
+        ToneMapping.fWhitePoint == m_ToneMapping.fWhitePoint &&
+        ToneMapping.fLuminanceSaturation == m_ToneMapping.fLuminanceSaturation &&
+        Grading == m_Grading)
+        return false;
+
+    if (!m_pBuildLUTPSO || m_PSOToneMappingMode != ToneMapping.iToneMappingMode)
+        CreatePSO(pDevice, ToneMapping.iToneMappingMode);
+
+    {
+        MapHelper<ToneMappingLUTAttribs> Attribs{pCtx, m_pAttribsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        Attribs->ToneMapping   = ToneMapping;
+        Attribs->ColorFilter   = float4{Grading.ColorFilter, 1};
+        Attribs->GradingParams = float4{Grading.Saturation, Grading.Contrast, 0, 0};
+    }
+
+    pCtx->SetPipelineState(m_pBuildLUTPSO);
+    pCtx->CommitShaderResources(m_pBuildLUTSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const Uint32           NumGroups = (LUTDim + ThreadGroupSize - 1) / ThreadGroupSize;
+    DispatchComputeAttribs DispatchAttribs{NumGroups, NumGroups, NumGroups};
+    pCtx->DispatchCompute(DispatchAttribs);
+
+    StateTransitionDesc Barrier{m_pLUTSRV->GetTexture(), RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pCtx->TransitionResourceStates(1, &Barrier);
+
+    m_ToneMapping = ToneMapping;
+    m_Grading     = Grading;
+    m_IsValid     = true;
+
+    return true;
+}
+
+} // namespace Diligent
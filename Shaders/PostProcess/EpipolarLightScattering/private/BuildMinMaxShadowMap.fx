@@ -0,0 +1,140 @@
+// BuildMinMaxShadowMap.fx
+// Builds all levels of the 1D min/max binary tree for an epipolar slice in a single compute pass
+
+#include "AtmosphereShadersCommon.fxh"
+
+Texture2D<float4> g_tex2DSliceUVDirAndOrigin;
+
+Texture2DArray<float> g_tex2DLightSpaceDepthMap;
+SamplerState          g_tex2DLightSpaceDepthMap_sampler;
+
+cbuffer cbPostProcessingAttribs
+{
+    EpipolarLightScatteringAttribs g_PPAttribs;
+}
+
+#if !USE_COMBINED_MIN_MAX_TEXTURE
+cbuffer cbMiscDynamicParams
+{
+    MiscDynamicParams g_MiscParams;
+}
+#endif
+
+#if IS_32BIT_MIN_MAX_MAP
+RWTexture2D<float2 /*format = rg32f*/> g_rwtex2DMinMaxLightSpaceDepth;
+#else
+RWTexture2D<float2 /*format = rg16*/>  g_rwtex2DMinMaxLightSpaceDepth;
+#endif
+
+#ifndef MIN_MAX_SHADOW_MAP_RESOLUTION
+#   define MIN_MAX_SHADOW_MAP_RESOLUTION 1024
+#endif
+
+#ifndef THREAD_GROUP_SIZE
+#   define THREAD_GROUP_SIZE 256
+#endif
+
+// Note that min/max shadow map does not contain finest resolution level
+// The first level it contains corresponds to step == 2
+#define NUM_FIRST_LEVEL_SAMPLES (MIN_MAX_SHADOW_MAP_RESOLUTION/2)
+
+// Two buffers are used in turn as the source and destination. The first one stores
+// the first level of the tree (and all even levels after it), the second one stores odd levels
+groupshared float2 g_f2MinMaxDepth0[NUM_FIRST_LEVEL_SAMPLES];
+groupshared float2 g_f2MinMaxDepth1[NUM_FIRST_LEVEL_SAMPLES/2];
+
+float2 ComputeFirstLevelMinMaxDepth(float4 f4SliceUVDirAndOrigin, float fCascadeInd, uint uiSampleInd)
+{
+    // Calculate current sample position on the ray
+    float2 f2CurrUV = f4SliceUVDirAndOrigin.zw + f4SliceUVDirAndOrigin.xy * float(uiSampleInd) * 2.0;
+
+    float4 f4MinDepth = float4(1.0, 1.0, 1.0, 1.0);
+    float4 f4MaxDepth = float4(0.0, 0.0, 0.0, 0.0);
+    // Gather 8 depths which will be used for PCF filtering for this sample and its immediate neighbor
+    // along the epipolar slice (see InitializeMinMaxShadowMapPS())
+    for( float i=0.0; i<=1.0; ++i )
+    {
+        float4 f4Depths = g_tex2DLightSpaceDepthMap.Gather(g_tex2DLightSpaceDepthMap_sampler, float3(f2CurrUV + i * f4SliceUVDirAndOrigin.xy, fCascadeInd) );
+        f4MinDepth = min(f4MinDepth, f4Depths);
+        f4MaxDepth = max(f4MaxDepth, f4Depths);
+    }
+
+    f4MinDepth.xy = min(f4MinDepth.xy, f4MinDepth.zw);
+    f4MinDepth.x = min(f4MinDepth.x, f4MinDepth.y);
+
+    f4MaxDepth.xy = max(f4MaxDepth.xy, f4MaxDepth.zw);
+    f4MaxDepth.x = max(f4MaxDepth.x, f4MaxDepth.y);
+#if !IS_32BIT_MIN_MAX_MAP
+    const float R16_UNORM_PRECISION = 1.0 / float(1<<16);
+    f4MinDepth.x = floor(f4MinDepth.x/R16_UNORM_PRECISION)*R16_UNORM_PRECISION;
+    f4MaxDepth.x =  ceil(f4MaxDepth.x/R16_UNORM_PRECISION)*R16_UNORM_PRECISION;
+#endif
+    return float2(f4MinDepth.x, f4MaxDepth.x);
+}
+
+// Every thread group processes one row of the min/max shadow map. The first level is
+// computed from the shadow map, every next level is then reduced from the previous one
+// in group shared memory. The levels are arranged in the texture the same way
+// as by ComputeMinMaxShadowMapLevelPS()
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void BuildMinMaxShadowMapCS(uint3 Gid  : SV_GroupID,
+                            uint3 GTid : SV_GroupThreadID)
+{
+    uint uiRow = Gid.y;
+    uint uiSliceInd;
+    float fCascadeInd;
+#if USE_COMBINED_MIN_MAX_TEXTURE
+    fCascadeInd = floor(float(uiRow) / float(g_PPAttribs.uiNumEpipolarSlices));
+    uiSliceInd = uiRow - uint(fCascadeInd) * g_PPAttribs.uiNumEpipolarSlices;
+    fCascadeInd += g_PPAttribs.fFirstCascadeToRayMarch;
+#else
+    uiSliceInd = uiRow;
+    fCascadeInd = g_MiscParams.fCascadeInd;
+#endif
+    // Load slice direction in shadow map
+    float4 f4SliceUVDirAndOrigin = g_tex2DSliceUVDirAndOrigin.Load( int3(uiSliceInd, int(fCascadeInd), 0) );
+
+    for(uint uiSampleInd = GTid.x; uiSampleInd < uint(NUM_FIRST_LEVEL_SAMPLES); uiSampleInd += uint(THREAD_GROUP_SIZE))
+    {
+        float2 f2MinMaxDepth = ComputeFirstLevelMinMaxDepth(f4SliceUVDirAndOrigin, fCascadeInd, uiSampleInd);
+        g_f2MinMaxDepth0[uiSampleInd] = f2MinMaxDepth;
+        g_rwtex2DMinMaxLightSpaceDepth[int2(uiSampleInd, uiRow)] = f2MinMaxDepth;
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    uint uiDstXOffset    = uint(NUM_FIRST_LEVEL_SAMPLES);
+    uint uiNumDstSamples = uint(NUM_FIRST_LEVEL_SAMPLES) / 2u;
+    bool bSrcIsBuffer0   = true;
+    // Note that the loop condition is the same for all threads in the group
+    for(uint uiStep = 4u; uiStep <= uint(g_PPAttribs.fMaxShadowMapStep); uiStep *= 2u)
+    {
+        for(uint uiSampleInd = GTid.x; uiSampleInd < uiNumDstSamples; uiSampleInd += uint(THREAD_GROUP_SIZE))
+        {
+            float2 f2MinMaxDepth0, f2MinMaxDepth1;
+            if( bSrcIsBuffer0 )
+            {
+                f2MinMaxDepth0 = g_f2MinMaxDepth0[uiSampleInd * 2u];
+                f2MinMaxDepth1 = g_f2MinMaxDepth0[uiSampleInd * 2u + 1u];
+            }
+            else
+            {
+                f2MinMaxDepth0 = g_f2MinMaxDepth1[uiSampleInd * 2u];
+                f2MinMaxDepth1 = g_f2MinMaxDepth1[uiSampleInd * 2u + 1u];
+            }
+
+            float2 f2MinMaxDepth = float2(min(f2MinMaxDepth0.x, f2MinMaxDepth1.x), max(f2MinMaxDepth0.y, f2MinMaxDepth1.y));
+            if( bSrcIsBuffer0 )
+                g_f2MinMaxDepth1[uiSampleInd] = f2MinMaxDepth;
+            else
+                g_f2MinMaxDepth0[uiSampleInd] = f2MinMaxDepth;
+            g_rwtex2DMinMaxLightSpaceDepth[int2(uiDstXOffset + uiSampleInd, uiRow)] = f2MinMaxDepth;
+        }
+
+        GroupMemoryBarrierWithGroupSync();
+
+        uiDstXOffset    += uiNumDstSamples;
+        uiNumDstSamples /= 2u;
+        bSrcIsBuffer0    = !bSrcIsBuffer0;
+    }
+}
@@ -42,9 +42,24 @@ SamplerState      g_tex3DHighOrderSctrLUT_sampler;
 Texture3D<float3> g_tex3DMultipleSctrLUT;
 SamplerState      g_tex3DMultipleSctrLUT_sampler;
 
+#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS
+Texture2D<float3> g_tex2DSkyViewInsctr;
+SamplerState      g_tex2DSkyViewInsctr_sampler;
+
+Texture2D<float3> g_tex2DSkyViewExtinction;
+SamplerState      g_tex2DSkyViewExtinction_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveInsctr;
+SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveExtinction;
+SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;
+#endif
+
 #include "LookUpTables.fxh"
 #include "ScatteringIntegrals.fxh"
 #include "Extinction.fxh"
+#include "SkyViewAndAerialPerspective.fxh"
 #include "UnshadowedScattering.fxh"
 
 void ShaderFunctionInternal(in float4  f4Pos,
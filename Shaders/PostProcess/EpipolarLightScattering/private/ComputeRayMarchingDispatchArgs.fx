@@ -0,0 +1,17 @@
+// ComputeRayMarchingDispatchArgs.fx
+// Computes indirect dispatch arguments to ray march samples from the compacted list
+
+#include "AtmosphereShadersCommon.fxh"
+
+StructuredBuffer<uint> g_RayMarchingSampleCounter;
+
+RWBuffer<uint /*format = r32ui*/> g_rwRayMarchingDispatchArgs;
+
+[numthreads(1, 1, 1)]
+void ComputeRayMarchingDispatchArgsCS()
+{
+    uint uiNumSamples = g_RayMarchingSampleCounter[0];
+    g_rwRayMarchingDispatchArgs[0] = (uiNumSamples + uint(RAY_MARCH_THREAD_GROUP_SIZE) - 1u) / uint(RAY_MARCH_THREAD_GROUP_SIZE);
+    g_rwRayMarchingDispatchArgs[1] = 1u;
+    g_rwRayMarchingDispatchArgs[2] = 1u;
+}
@@ -0,0 +1,464 @@
+// FroxelInscattering.fx
+// Evaluates inscattering in a camera-aligned froxel grid, integrates it front to back
+// and combines the result with the back buffer
+
+#include "BasicStructures.fxh"
+#include "AtmosphereShadersCommon.fxh"
+
+cbuffer cbParticipatingMediaScatteringParams
+{
+    AirScatteringAttribs g_MediaParams;
+}
+
+cbuffer cbCameraAttribs
+{
+    CameraAttribs g_CameraAttribs;
+}
+
+cbuffer cbLightParams
+{
+    LightAttribs g_LightAttribs;
+}
+
+cbuffer cbPostProcessingAttribs
+{
+    EpipolarLightScatteringAttribs g_PPAttribs;
+}
+
+cbuffer cbFroxelGridAttribs
+{
+    FroxelGridAttribs g_FroxelAttribs;
+}
+
+#ifndef FROXEL_THREAD_GROUP_SIZE
+#   define FROXEL_THREAD_GROUP_SIZE 8
+#endif
+
+Texture2D<float2> g_tex2DOccludedNetDensityToAtmTop;
+SamplerState      g_tex2DOccludedNetDensityToAtmTop_sampler;
+
+#if ENABLE_LIGHT_SHAFTS
+Texture2DArray<float>  g_tex2DLightSpaceDepthMap;
+SamplerComparisonState g_tex2DLightSpaceDepthMap_sampler;
+#endif
+
+Texture3D<float3> g_tex3DSingleSctrLUT;
+SamplerState      g_tex3DSingleSctrLUT_sampler;
+
+Texture3D<float3> g_tex3DHighOrderSctrLUT;
+SamplerState      g_tex3DHighOrderSctrLUT_sampler;
+
+Texture3D<float3> g_tex3DMultipleSctrLUT;
+SamplerState      g_tex3DMultipleSctrLUT_sampler;
+
+Texture2D<float>  g_tex2DCamSpaceZ;
+
+Texture2D<float4> g_tex2DColorBuffer;
+
+Texture2D<float>  g_tex2DAverageLuminance;
+
+#if USE_TONE_MAPPING_LUT
+Texture3D<float4> g_tex3DToneMappingLUT;
+SamplerState      g_tex3DToneMappingLUT_sampler;
+#endif
+
+#include "LookUpTables.fxh"
+#include "ScatteringIntegrals.fxh"
+#include "Extinction.fxh"
+#include "ToneMapping.fxh"
+
+// Slices of the grid are distributed exponentially between the near and far
+// boundaries, so that every slice covers the same range of log depth:
+//
+//      z(s) = Near * (Far/Near)^(s/Depth)
+//
+// f4DepthParams == (Near, Far, ln(Far/Near), *)
+float FroxelSliceToCamSpaceZ(float fSlice, float4 f4DepthParams)
+{
+    return f4DepthParams.x * exp(fSlice / g_FroxelAttribs.f4GridDim.z * f4DepthParams.z);
+}
+
+float CamSpaceZToFroxelSlice(float fCamSpaceZ, float4 f4DepthParams)
+{
+    return log(max(fCamSpaceZ, f4DepthParams.x) / f4DepthParams.x) / f4DepthParams.z * g_FroxelAttribs.f4GridDim.z;
+}
+
+float2 GetFroxelColumnNormalizedDeviceXY(uint2 ui2Column)
+{
+    return TexUVToNormalizedDeviceXY( (float2(ui2Column) + float2(0.5, 0.5)) / g_FroxelAttribs.f4GridDim.xy );
+}
+
+
+#if ENABLE_LIGHT_SHAFTS
+float GetFroxelLightVisibility(float3 f3PosWS, float fCamSpaceZ)
+{
+    // Use the finest cascade that contains the point
+    for (int iCascade = 0; iCascade < g_PPAttribs.iNumCascades; ++iCascade)
+    {
+        if (fCamSpaceZ < g_LightAttribs.ShadowAttribs.Cascades[iCascade].f4StartEndZ.y)
+        {
+            float3 f3ShadowMapUVDepth = WorldSpaceToShadowMapUV(f3PosWS, g_LightAttribs.ShadowAttribs.mWorldToShadowMapUVDepth[iCascade]);
+            // Clamp depth to a very small positive value to avoid z-fighting at camera location
+            float fDepthInLightSpace = max(f3ShadowMapUVDepth.z, 1e-7);
+            #ifdef GLSL
+                // There is no OpenGL counterpart for Texture2DArray.SampleCmpLevelZero()
+                return g_tex2DLightSpaceDepthMap.SampleCmp( g_tex2DLightSpaceDepthMap_sampler, float3(f3ShadowMapUVDepth.xy, float(iCascade)), fDepthInLightSpace );
+            #else
+                // We cannot use SampleCmp() under flow control in HLSL
+                return g_tex2DLightSpaceDepthMap.SampleCmpLevelZero( g_tex2DLightSpaceDepthMap_sampler, float3(f3ShadowMapUVDepth.xy, float(iCascade)), fDepthInLightSpace );
+            #endif
+        }
+    }
+    return 1.0;
+}
+#endif
+
+// Computes single scattering per unit length in the given point. Note that extinction
+// between the point and the camera is not applied
+float3 ComputeFroxelInscattering(float3 f3PosWS, float3 f3ViewDir, float fCamSpaceZ)
+{
+    float3 f3Inscattering = float3(0.0, 0.0, 0.0);
+#if SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE
+    float3 f3EarthCentreToPointDir = f3PosWS - g_PPAttribs.f4EarthCenter.xyz;
+    float fDistToEarthCentre = length(f3EarthCentreToPointDir);
+    f3EarthCentreToPointDir /= fDistToEarthCentre;
+    float fHeightAboveSurface = fDistToEarthCentre - g_MediaParams.fEarthRadius;
+
+    // Points below the Earth surface and outside of the atmosphere do not scatter light
+    if (fDistToEarthCentre < g_MediaParams.fAtmBottomRadius || fDistToEarthCentre > g_MediaParams.fAtmTopRadius)
+        return f3Inscattering;
+
+    float2 f2ParticleDensity = exp( -float2(fHeightAboveSurface, fHeightAboveSurface) * g_MediaParams.f4ParticleScaleHeight.zw );
+
+    // Get net particle density from the point to the top of the atmosphere and compute
+    // extinction of the light on its way to the point
+    float fCosSunZenithAngle = dot( f3EarthCentreToPointDir, -g_LightAttribs.f4Direction.xyz );
+    float2 f2NetParticleDensityToAtmTop = GetNetParticleDensity(fHeightAboveSurface, fCosSunZenithAngle, g_MediaParams.fAtmBottomAltitude, g_MediaParams.fAtmAltitudeRangeInv);
+    float3 f3RlghOpticalDepth = g_MediaParams.f4RayleighExtinctionCoeff.rgb * f2NetParticleDensityToAtmTop.x;
+    float3 f3MieOpticalDepth  = g_MediaParams.f4MieExtinctionCoeff.rgb      * f2NetParticleDensityToAtmTop.y;
+    float3 f3LightExtinction  = exp( -(f3RlghOpticalDepth + f3MieOpticalDepth) );
+
+    float3 f3RayleighInscattering = f2ParticleDensity.x * f3LightExtinction;
+    float3 f3MieInscattering      = f2ParticleDensity.y * f3LightExtinction;
+    // Note that cosTheta = dot(DirOnCamera, LightDir) = dot(ViewDir, DirOnLight) because
+    // DirOnCamera = -ViewDir and LightDir = -DirOnLight
+    ApplyPhaseFunctions(f3RayleighInscattering, f3MieInscattering, dot(f3ViewDir, -g_LightAttribs.f4Direction.xyz));
+    f3Inscattering = f3RayleighInscattering + f3MieInscattering;
+
+#   if ENABLE_LIGHT_SHAFTS
+    f3Inscattering *= GetFroxelLightVisibility(f3PosWS, fCamSpaceZ);
+#   endif
+#endif
+    return f3Inscattering;
+}
+
+
+RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DFroxelInsctr;
+
+Texture3D<float4> g_tex3DFroxelInsctrHistory;
+SamplerState      g_tex3DFroxelInsctrHistory_sampler; // Linear clamp
+
+// Evaluates scattering at a jittered location within every froxel and blends it with the
+// reprojected result of the previous frame.
+// To keep the values in half float range, the grid stores scattering per unit length
+// multiplied by the distance to the camera. Since the slices are exponentially distributed,
+// this is proportional to the scattering integrated over the slice.
+[numthreads(FROXEL_THREAD_GROUP_SIZE, FROXEL_THREAD_GROUP_SIZE, 1)]
+void InjectFroxelInscatteringCS(uint3 DTid : SV_DispatchThreadID)
+{
+    float3 f3GridDim = g_FroxelAttribs.f4GridDim.xyz;
+    if( float(DTid.x) >= f3GridDim.x || float(DTid.y) >= f3GridDim.y )
+        return;
+
+    float2 f2PosPS = GetFroxelColumnNormalizedDeviceXY(DTid.xy);
+    float fCamSpaceZ = FroxelSliceToCamSpaceZ(float(DTid.z) + g_FroxelAttribs.f4GridDepthParams.w, g_FroxelAttribs.f4GridDepthParams);
+    float3 f3PosWS = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
+
+    float3 f3ViewDir = f3PosWS - g_CameraAttribs.f4Position.xyz;
+    float fDistToCamera = length(f3ViewDir);
+    f3ViewDir /= fDistToCamera;
+
+    float4 f4Inscattering = float4(ComputeFroxelInscattering(f3PosWS, f3ViewDir, fCamSpaceZ) * fDistToCamera, 1.0);
+
+    float fHistoryWeight = g_FroxelAttribs.f4PrevCameraPos.w;
+    [branch]
+    if( fHistoryWeight > 0.0 )
+    {
+        float4 f4PrevPosPS = mul( float4(f3PosWS, 1.0), g_FroxelAttribs.mPrevViewProj );
+        if( f4PrevPosPS.w > 0.0 )
+        {
+            // Note that w is the previous camera space z
+            float3 f3PrevUVW;
+            f3PrevUVW.xy = NormalizedDeviceXYToTexUV(f4PrevPosPS.xy / f4PrevPosPS.w);
+            f3PrevUVW.z  = CamSpaceZToFroxelSlice(f4PrevPosPS.w, g_FroxelAttribs.f4PrevGridDepthParams) / f3GridDim.z;
+            if( f3PrevUVW.x >= 0.0 && f3PrevUVW.x <= 1.0 &&
+                f3PrevUVW.y >= 0.0 && f3PrevUVW.y <= 1.0 &&
+                f3PrevUVW.z >= 0.0 && f3PrevUVW.z <= 1.0 )
+            {
+                float3 f3History = g_tex3DFroxelInsctrHistory.SampleLevel(g_tex3DFroxelInsctrHistory_sampler, f3PrevUVW, 0.0).rgb;
+                // History is scaled by the distance to the previous camera position
+                float fPrevDistToCamera = length(f3PosWS - g_FroxelAttribs.f4PrevCameraPos.xyz);
+                f3History *= fDistToCamera / max(fPrevDistToCamera, 1e-3);
+                f4Inscattering.rgb = lerp(f4Inscattering.rgb, f3History, fHistoryWeight);
+            }
+        }
+    }
+
+    g_rwtex3DFroxelInsctr[DTid] = f4Inscattering;
+}
+
+
+Texture3D<float4> g_tex3DFroxelInsctr;
+
+RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DFroxelIntegratedInsctr;
+
+// Integrates froxel scattering front to back. Every thread processes one column of the grid.
+// Texel k of the integrated grid contains light scattered between the camera and the far boundary of slice k
+[numthreads(FROXEL_THREAD_GROUP_SIZE, FROXEL_THREAD_GROUP_SIZE, 1)]
+void IntegrateFroxelInscatteringCS(uint3 DTid : SV_DispatchThreadID)
+{
+    float3 f3GridDim = g_FroxelAttribs.f4GridDim.xyz;
+    if( float(DTid.x) >= f3GridDim.x || float(DTid.y) >= f3GridDim.y )
+        return;
+
+    uint uiNumSlices = uint(f3GridDim.z);
+    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;
+    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;
+
+    float fNearZ = g_FroxelAttribs.f4GridDepthParams.x;
+    float3 f3NearPos = ProjSpaceXYZToWorldSpace(float3(GetFroxelColumnNormalizedDeviceXY(DTid.xy), fNearZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
+    float3 f3ViewDir = f3NearPos - f3CameraPos;
+    // Distance along the ray per unit of camera space z
+    float fDistPerCamSpaceZ = length(f3ViewDir) / fNearZ;
+    f3ViewDir = normalize(f3ViewDir);
+
+    float4 f4Isecs;
+    GetRaySphereIntersection2(f3CameraPos, f3ViewDir, f3EarthCentre,
+                              float2(g_MediaParams.fAtmTopRadius, g_MediaParams.fAtmBottomRadius), f4Isecs);
+    float2 f2RayAtmTopIsecs = f4Isecs.xy;
+    float2 f2RayEarthIsecs  = f4Isecs.zw;
+
+    if( f2RayAtmTopIsecs.y <= 0.0 )
+    {
+        // The ray does not intersect the atmosphere
+        for(uint uiSlice = 0u; uiSlice < uiNumSlices; ++uiSlice)
+            g_rwtex3DFroxelIntegratedInsctr[uint3(DTid.xy, uiSlice)] = float4(0.0, 0.0, 0.0, 1.0);
+        return;
+    }
+
+    // Scattering is only accumulated in the part of the ray that is in the atmosphere and above the Earth surface
+    float fMinDist = max(f2RayAtmTopIsecs.x, 0.0);
+    float fMaxDist = f2RayAtmTopIsecs.y;
+    if( f2RayEarthIsecs.x > 0.0 )
+        fMaxDist = min(fMaxDist, f2RayEarthIsecs.x);
+
+#if MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE
+    // Higher-order scattering is not shadowed and is computed as the difference of the
+    // precomputed scattering at the start of the ray and at the far boundary of the slice
+    float3 f3RestrainedCameraPos = f3CameraPos + fMinDist * f3ViewDir;
+    float4 f4StartUVWQ = float4(-1.0, -1.0, -1.0, -1.0);
+    float3 f3StartHighOrderInsctr =
+        LookUpPrecomputedScattering(
+            f3RestrainedCameraPos,
+            f3ViewDir,
+            f3EarthCentre,
+            g_MediaParams.fEarthRadius,
+            -g_LightAttribs.f4Direction.xyz,
+            g_MediaParams.fAtmBottomAltitude,
+            g_MediaParams.fAtmTopAltitude,
+            g_tex3DHighOrderSctrLUT,
+            g_tex3DHighOrderSctrLUT_sampler,
+            f4StartUVWQ);
+#endif
+
+    float3 f3Transmittance = float3(1.0, 1.0, 1.0);
+    float3 f3Inscattering  = float3(0.0, 0.0, 0.0);
+    float  fSliceStartDist = 0.0;
+    for(uint uiSlice = 0u; uiSlice < uiNumSlices; ++uiSlice)
+    {
+        float fSliceCenterDist = FroxelSliceToCamSpaceZ(float(uiSlice) + 0.5, g_FroxelAttribs.f4GridDepthParams) * fDistPerCamSpaceZ;
+        float fSliceEndDist    = FroxelSliceToCamSpaceZ(float(uiSlice) + 1.0, g_FroxelAttribs.f4GridDepthParams) * fDistPerCamSpaceZ;
+        float fSectionLength   = max(min(fSliceEndDist, fMaxDist) - max(fSliceStartDist, fMinDist), 0.0);
+        fSliceStartDist = fSliceEndDist;
+
+        // Evaluate media extinction in the slice center
+        float3 f3SliceCenter = f3CameraPos + f3ViewDir * fSliceCenterDist;
+        float fHeightAboveSurface = length(f3SliceCenter - f3EarthCentre) - g_MediaParams.fEarthRadius;
+        float2 f2ParticleDensity = exp( -max(fHeightAboveSurface, 0.0) * g_MediaParams.f4ParticleScaleHeight.zw );
+        float3 f3ExtinctionCoeff = g_MediaParams.f4RayleighExtinctionCoeff.rgb * f2ParticleDensity.x +
+                                   g_MediaParams.f4MieExtinctionCoeff.rgb      * f2ParticleDensity.y;
+        float3 f3SliceTransmittance = exp( -f3ExtinctionCoeff * fSectionLength );
+
+        float3 f3SliceInsctr = g_tex3DFroxelInsctr.Load( int4(int2(DTid.xy), int(uiSlice), 0) ).rgb / fSliceCenterDist * fSectionLength;
+        // Light scattered in the slice is attenuated on its way to the slice boundary. Use the midpoint rule
+        f3Inscattering  += f3Transmittance * sqrt(f3SliceTransmittance) * f3SliceInsctr;
+        f3Transmittance *= f3SliceTransmittance;
+
+        float3 f3TotalInsctr = f3Inscattering;
+#if MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE
+        {
+            float3 f3SliceEnd = f3CameraPos + f3ViewDir * clamp(fSliceEndDist, fMinDist, fMaxDist);
+            float3 f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3SliceEnd, f3ViewDir, f3EarthCentre,
+                                                          g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);
+            // To avoid artifacts, look-ups must be consistent with the first one (see RayMarch.fx)
+            float4 f4UVWQ = f4StartUVWQ;
+            float3 f3HighOrderInsctr = f3StartHighOrderInsctr - f3Extinction *
+                LookUpPrecomputedScattering(
+                    f3SliceEnd,
+                    f3ViewDir,
+                    f3EarthCentre,
+                    g_MediaParams.fEarthRadius,
+                    -g_LightAttribs.f4Direction.xyz,
+                    g_MediaParams.fAtmBottomAltitude,
+                    g_MediaParams.fAtmTopAltitude,
+                    g_tex3DHighOrderSctrLUT,
+                    g_tex3DHighOrderSctrLUT_sampler,
+                    f4UVWQ);
+            f3TotalInsctr += max(f3HighOrderInsctr, float3(0.0, 0.0, 0.0));
+        }
+#endif
+        g_rwtex3DFroxelIntegratedInsctr[uint3(DTid.xy, uiSlice)] = float4(f3TotalInsctr * g_LightAttribs.f4Intensity.rgb, 1.0);
+    }
+}
+
+
+Texture3D<float4> g_tex3DFroxelIntegratedInsctr;
+SamplerState      g_tex3DFroxelIntegratedInsctr_sampler; // Linear clamp
+
+// Scattering beyond the grid is not shadowed and is looked up from the precomputed tables
+#if SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE && MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE
+#   define tex3DRemainingSctrLUT         g_tex3DMultipleSctrLUT
+#   define tex3DRemainingSctrLUT_sampler g_tex3DMultipleSctrLUT_sampler
+#elif SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE
+#   define tex3DRemainingSctrLUT         g_tex3DSingleSctrLUT
+#   define tex3DRemainingSctrLUT_sampler g_tex3DSingleSctrLUT_sampler
+#elif MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE
+#   define tex3DRemainingSctrLUT         g_tex3DHighOrderSctrLUT
+#   define tex3DRemainingSctrLUT_sampler g_tex3DHighOrderSctrLUT_sampler
+#endif
+
+float3 GetFroxelInscattering(float2 f2PosPS, float fCamSpaceZ)
+{
+    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;
+    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;
+
+    float3 f3RayTermination = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
+    float3 f3ViewDir = f3RayTermination - f3CameraPos;
+    float fRayLength = length(f3ViewDir);
+    f3ViewDir /= fRayLength;
+    float fCamSpaceZPerDist = fCamSpaceZ / fRayLength;
+
+    float4 f4Isecs;
+    GetRaySphereIntersection2(f3CameraPos, f3ViewDir, f3EarthCentre,
+                              float2(g_MediaParams.fAtmTopRadius, g_MediaParams.fAtmBottomRadius), f4Isecs);
+    float2 f2RayAtmTopIsecs = f4Isecs.xy;
+    float2 f2RayEarthIsecs  = f4Isecs.zw;
+    if( f2RayAtmTopIsecs.y <= 0.0 )
+    {
+        // The camera is outside the atmosphere and the ray does not intersect it
+        return float3(0.0, 0.0, 0.0);
+    }
+
+    if( fCamSpaceZ > g_CameraAttribs.fFarPlaneZ ) // fFarPlaneZ is pre-multiplied with 0.999999f
+        fRayLength = +FLT_MAX;
+    fRayLength = min(fRayLength, f2RayAtmTopIsecs.y);
+    if( f2RayEarthIsecs.x > 0.0 )
+        fRayLength = min(fRayLength, f2RayEarthIsecs.x);
+
+    float fSlice = CamSpaceZToFroxelSlice(fRayLength * fCamSpaceZPerDist, g_FroxelAttribs.f4GridDepthParams);
+    float3 f3UVW = float3(NormalizedDeviceXYToTexUV(f2PosPS), (fSlice - 0.5) / g_FroxelAttribs.f4GridDim.z);
+    float3 f3Inscattering = g_tex3DFroxelIntegratedInsctr.SampleLevel(g_tex3DFroxelIntegratedInsctr_sampler, f3UVW, 0.0).rgb;
+    // Fade scattering out in the first slice
+    f3Inscattering *= saturate(fSlice);
+
+#ifdef tex3DRemainingSctrLUT
+    float fGridEndDist = g_FroxelAttribs.f4GridDepthParams.y / fCamSpaceZPerDist;
+    [branch]
+    if( fRayLength > fGridEndDist )
+    {
+        float fDistToAtmosphere = max(f2RayAtmTopIsecs.x, 0.0);
+        float3 f3RestrainedCameraPos = f3CameraPos + fDistToAtmosphere * f3ViewDir;
+        float3 f3RemainingRayStart = f3CameraPos + max(fGridEndDist, fDistToAtmosphere) * f3ViewDir;
+        float3 f3RayEnd = f3CameraPos + fRayLength * f3ViewDir;
+
+        float3 f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3RemainingRayStart, f3ViewDir, f3EarthCentre,
+                                                      g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);
+        float4 f4UVWQ = float4(-1.0, -1.0, -1.0, -1.0);
+        float3 f3RemainingInsctr = f3Extinction *
+            LookUpPrecomputedScattering(
+                f3RemainingRayStart,
+                f3ViewDir,
+                f3EarthCentre,
+                g_MediaParams.fEarthRadius,
+                -g_LightAttribs.f4Direction.xyz,
+                g_MediaParams.fAtmBottomAltitude,
+                g_MediaParams.fAtmTopAltitude,
+                tex3DRemainingSctrLUT,
+                tex3DRemainingSctrLUT_sampler,
+                f4UVWQ);
+
+        f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3RayEnd, f3ViewDir, f3EarthCentre,
+                                               g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);
+        f3RemainingInsctr -= f3Extinction *
+            LookUpPrecomputedScattering(
+                f3RayEnd,
+                f3ViewDir,
+                f3EarthCentre,
+                g_MediaParams.fEarthRadius,
+                -g_LightAttribs.f4Direction.xyz,
+                g_MediaParams.fAtmBottomAltitude,
+                g_MediaParams.fAtmTopAltitude,
+                tex3DRemainingSctrLUT,
+                tex3DRemainingSctrLUT_sampler,
+                f4UVWQ);
+
+        f3Inscattering += max(f3RemainingInsctr, float3(0.0, 0.0, 0.0)) * g_LightAttribs.f4Intensity.rgb;
+    }
+#endif
+
+    return f3Inscattering;
+}
+
+void ApplyFroxelInscatteringPS(FullScreenTriangleVSOutput VSOut,
+                               // IMPORTANT: non-system generated pixel shader input
+                               // arguments must have the exact same name as vertex shader
+                               // outputs and must go in the same order.
+                               // Moreover, even if the shader is not using the argument,
+                               // it still must be declared.
+
+                               out float4 f4Color : SV_Target)
+{
+    // Note that the render target may be smaller than the screen when rendering luminance
+    int2 i2PixelPos = int2( NormalizedDeviceXYToTexUV(VSOut.f2NormalizedXY) * g_PPAttribs.f4ScreenResolution.xy );
+    i2PixelPos = min(i2PixelPos, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));
+    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );
+
+    float3 f3Inscattering = GetFroxelInscattering(VSOut.f2NormalizedXY, fCamSpaceZ);
+
+    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);
+    [branch]
+    if( !g_PPAttribs.bShowLightingOnly )
+    {
+        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;
+        // fFarPlaneZ is pre-multiplied with 0.999999f
+        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);
+        float3 f3ReconstructedPosWS = ProjSpaceXYZToWorldSpace(float3(VSOut.f2NormalizedXY.xy, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
+        float3 f3Extinction = GetExtinction(g_CameraAttribs.f4Position.xyz, f3ReconstructedPosWS, g_PPAttribs.f4EarthCenter.xyz,
+                                            g_MediaParams.fAtmBottomRadius, g_MediaParams.fAtmTopRadius, g_MediaParams.f4ParticleScaleHeight);
+        f3BackgroundColor *= f3Extinction;
+    }
+
+#if PERFORM_TONE_MAPPING
+    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);
+#   if USE_TONE_MAPPING_LUT
+    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);
+#   else
+    f4Color.rgb = ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum);
+#   endif
+#else
+    const float MinLumn = 0.01;
+    float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3Inscattering, MinLumn);
+    f4Color.rgb = float3(LogLum_W.x, LogLum_W.y, 0.0);
+#endif
+    f4Color.a = 1.0;
+}
@@ -55,6 +55,11 @@ Texture2D<float4> g_tex2DColorBuffer;
 
 Texture2D<float>  g_tex2DAverageLuminance;
 
+#if USE_TONE_MAPPING_LUT
+Texture3D<float4> g_tex3DToneMappingLUT;
+SamplerState      g_tex3DToneMappingLUT_sampler;
+#endif
+
 Texture3D<float3> g_tex3DSingleSctrLUT;
 SamplerState      g_tex3DSingleSctrLUT_sampler;
 
@@ -64,10 +69,25 @@ SamplerState      g_tex3DHighOrderSctrLUT_sampler;
 Texture3D<float3> g_tex3DMultipleSctrLUT;
 SamplerState      g_tex3DMultipleSctrLUT_sampler;
 
+#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS
+Texture2D<float3> g_tex2DSkyViewInsctr;
+SamplerState      g_tex2DSkyViewInsctr_sampler;
+
+Texture2D<float3> g_tex2DSkyViewExtinction;
+SamplerState      g_tex2DSkyViewExtinction_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveInsctr;
+SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveExtinction;
+SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;
+#endif
+
 
 #include "LookUpTables.fxh"
 #include "ScatteringIntegrals.fxh"
 #include "Extinction.fxh"
+#include "SkyViewAndAerialPerspective.fxh"
 #include "UnshadowedScattering.fxh"
 #include "ToneMapping.fxh"
 
@@ -666,22 +686,18 @@ float3 ComputeShadowedInscattering( in float2 f2RayMarchingSampleLocation,
 #endif
 
 
-void RayMarchPS(in FullScreenTriangleVSOutput VSOut,
-                out float4 f4Inscattering : SV_TARGET)
+float4 RayMarchEpipolarSample(uint2 ui2SamplePosSliceInd, float fCascade)
 {
-    uint2 ui2SamplePosSliceInd = uint2(VSOut.f4PixelPos.xy);
     float2 f2SampleLocation = g_tex2DCoordinates.Load( int3(ui2SamplePosSliceInd, 0) );
     float fRayEndCamSpaceZ = g_tex2DEpipolarCamSpaceZ.Load( int3(ui2SamplePosSliceInd, 0) );
 
     [branch]
     if( any( Greater( abs( f2SampleLocation ), (1.0 + 1e-3) * float2(1.0, 1.0)) ) )
     {
-        f4Inscattering = float4(0.0, 0.0, 0.0, 0.0);
-        return;
+        return float4(0.0, 0.0, 0.0, 0.0);
     }
-    f4Inscattering = float4(1.0, 1.0, 1.0, 1.0);
+    float4 f4Inscattering = float4(1.0, 1.0, 1.0, 1.0);
 #if ENABLE_LIGHT_SHAFTS
-    float fCascade = g_MiscParams.fCascadeInd + VSOut.fInstID;
     f4Inscattering.rgb = 
         ComputeShadowedInscattering(f2SampleLocation, 
                                     fRayEndCamSpaceZ,
@@ -696,10 +712,181 @@ void RayMarchPS(in FullScreenTriangleVSOutput VSOut,
                                   f4Inscattering.rgb,
                                   f3Extinction);
     f4Inscattering.rgb *= g_LightAttribs.f4Intensity.rgb;
+#endif
+    return f4Inscattering;
+}
+
+void RayMarchPS(in FullScreenTriangleVSOutput VSOut,
+                out float4 f4Inscattering : SV_TARGET)
+{
+    f4Inscattering = RayMarchEpipolarSample(uint2(VSOut.f4PixelPos.xy), g_MiscParams.fCascadeInd + VSOut.fInstID);
+}
+
+
+#if COMPACT_RAY_MARCHING_SAMPLES
+
+// Compacted list of ray marching samples generated by RefineSampleLocationsCS()
+StructuredBuffer<uint> g_RayMarchingSampleList;
+StructuredBuffer<uint> g_RayMarchingSampleCounter;
+
+RWTexture2D<float4 /*format = rgba16f*/> g_rwtex2DInitialScatteredLight;
+
+// Ray marches samples from the compacted list. The shader is executed with indirect dispatch,
+// so that only as many thread groups as required to process all samples are launched
+[numthreads(RAY_MARCH_THREAD_GROUP_SIZE, 1, 1)]
+void RayMarchCompactedSamplesCS(uint3 DTid : SV_DispatchThreadID)
+{
+    if( DTid.x >= g_RayMarchingSampleCounter[0] )
+        return;
+
+    uint uiPackedSample = g_RayMarchingSampleList[DTid.x];
+    uint2 ui2SamplePosSliceInd = uint2(uiPackedSample & 0xFFFFu, uiPackedSample >> 16u);
+    g_rwtex2DInitialScatteredLight[ui2SamplePosSliceInd] = RayMarchEpipolarSample(ui2SamplePosSliceInd, g_MiscParams.fCascadeInd);
+}
+
+#endif
+
+
+// Performs brute-force ray marching at reduced resolution. Every texel of the downscaled
+// target computes inscattering for the full resolution pixel in the center of the
+// corresponding uiBruteForceDownscaleFactor x uiBruteForceDownscaleFactor block and stores
+// its camera space z to guide bilateral upsampling (see UpsampleInscattering.fx)
+void RayMarchDownscaledPS(in FullScreenTriangleVSOutput VSOut,
+                          out float4 f4Inscattering : SV_Target0,
+                          out float  fCamSpaceZ     : SV_Target1)
+{
+    int iDownscaleFactor = int(g_PPAttribs.uiBruteForceDownscaleFactor);
+    int2 i2FullResPixel = int2(VSOut.f4PixelPos.xy) * iDownscaleFactor + int2(iDownscaleFactor/2, iDownscaleFactor/2);
+    i2FullResPixel = min(i2FullResPixel, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));
+
+    fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2FullResPixel, 0) );
+    float2 f2SampleLocation = TexUVToNormalizedDeviceXY( (float2(i2FullResPixel) + float2(0.5, 0.5)) * g_PPAttribs.f4ScreenResolution.zw );
+
+    f4Inscattering = float4(0.0, 0.0, 0.0, 1.0);
+#if ENABLE_LIGHT_SHAFTS
+    float fCascade = g_MiscParams.fCascadeInd + VSOut.fInstID;
+    f4Inscattering.rgb =
+        ComputeShadowedInscattering(f2SampleLocation,
+                                    fCamSpaceZ,
+                                    fCascade,
+                                    0u // Ignored
+                                    );
+#else
+    float3 f3Extinction;
+    ComputeUnshadowedInscattering(f2SampleLocation,
+                                  fCamSpaceZ,
+                                  g_PPAttribs.uiInstrIntegralSteps,
+                                  g_PPAttribs.f4EarthCenter.xyz,
+                                  f4Inscattering.rgb,
+                                  f3Extinction);
+    f4Inscattering.rgb *= g_LightAttribs.f4Intensity.rgb;
 #endif
 }
 
 
+#if UNWARP_AND_FIX_INSCATTERING
+
+// Resources required to unwarp epipolar inscattering image (see UnwarpEpipolarScattering.fx)
+Texture2D<float4> g_tex2DSliceEndPoints;
+SamplerState      g_tex2DSliceEndPoints_sampler; // Linear clamp
+
+SamplerState      g_tex2DEpipolarCamSpaceZ_sampler; // Linear clamp
+
+Texture2D<float3> g_tex2DScatteredColor;
+SamplerState      g_tex2DScatteredColor_sampler; // Linear clamp
+
+#if EXTINCTION_EVAL_MODE == EXTINCTION_EVAL_MODE_EPIPOLAR
+    Texture2D<float3> g_tex2DEpipolarExtinction;
+    SamplerState      g_tex2DEpipolarExtinction_sampler; // Linear clamp
+#endif
+
+#include "UnwarpEpipolarScattering.fxh"
+
+RWTexture2D<float4 /*format = rgba8*/> g_rwtex2DDstColor;
+
+// Unwarps epipolar inscattering image, ray marches pixels for which no suitable interpolation
+// sources were found, and writes the tone mapped result to the destination color buffer.
+// Unlike the pixel shader path, this does not require depth buffer to mark pixels at depth
+// breaks, and every pixel of the destination buffer is written exactly once
+[numthreads(UNWARP_THREAD_GROUP_SIZE, UNWARP_THREAD_GROUP_SIZE, 1)]
+void UnwarpAndFixInscatteringCS(uint3 DTid : SV_DispatchThreadID)
+{
+    int2 i2PixelPos = int2(DTid.xy);
+    if( float(i2PixelPos.x) >= g_PPAttribs.f4ScreenResolution.x ||
+        float(i2PixelPos.y) >= g_PPAttribs.f4ScreenResolution.y )
+        return;
+
+    float2 f2PosPS = TexUVToNormalizedDeviceXY( (float2(i2PixelPos) + float2(0.5, 0.5)) * g_PPAttribs.f4ScreenResolution.zw );
+    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );
+
+    float3 f3Inscattering, f3Extinction;
+    bool bIsDepthBreak = !UnwarpEpipolarInsctrImage(f2PosPS, fCamSpaceZ, f3Inscattering, f3Extinction);
+#if !CORRECT_INSCATTERING_AT_DEPTH_BREAKS
+    bIsDepthBreak = false;
+#endif
+
+    [branch]
+    if( bIsDepthBreak && g_PPAttribs.bShowDepthBreaks )
+    {
+        g_rwtex2DDstColor[i2PixelPos] = float4(0.0, 1.0, 0.0, 1.0);
+        return;
+    }
+
+    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);
+    [branch]
+    if( !g_PPAttribs.bShowLightingOnly )
+    {
+        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;
+        // fFarPlaneZ is pre-multiplied with 0.999999f
+        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);
+
+#if EXTINCTION_EVAL_MODE == EXTINCTION_EVAL_MODE_EPIPOLAR
+        [branch]
+        if( bIsDepthBreak )
+#endif
+        {
+            f3Extinction = GetBackgroundExtinction(f2PosPS, fCamSpaceZ);
+        }
+        f3BackgroundColor *= f3Extinction;
+    }
+
+#if CORRECT_INSCATTERING_AT_DEPTH_BREAKS
+    // Pixels at depth breaks are sparse, so they are ray marched inline rather
+    // than in a separate pass
+    [branch]
+    if( bIsDepthBreak )
+    {
+#   if ENABLE_LIGHT_SHAFTS
+        f3Inscattering = 
+            ComputeShadowedInscattering(f2PosPS,
+                                        fCamSpaceZ,
+                                        g_MiscParams.fCascadeInd,
+                                        0u // Ignored
+                                        );
+#   else
+        float3 f3RayExtinction;
+        ComputeUnshadowedInscattering(f2PosPS,
+                                      fCamSpaceZ,
+                                      g_PPAttribs.uiInstrIntegralSteps,
+                                      g_PPAttribs.f4EarthCenter.xyz,
+                                      f3Inscattering,
+                                      f3RayExtinction);
+        f3Inscattering *= g_LightAttribs.f4Intensity.rgb;
+#   endif
+    }
+#endif
+
+    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);
+#if USE_TONE_MAPPING_LUT
+    g_rwtex2DDstColor[i2PixelPos] = float4(ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler), 1.0);
+#else
+    g_rwtex2DDstColor[i2PixelPos] = float4(ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum), 1.0);
+#endif
+}
+
+#endif
+
+
 //float3 FixInscatteredRadiancePS(FullScreenTriangleVSOutput VSOut) : SV_Target
 //{
 //    if( g_PPAttribs.bShowDepthBreaks )
@@ -739,9 +926,7 @@ void FixAndApplyInscatteredRadiancePS(FullScreenTriangleVSOutput VSOut,
     {
         f3BackgroundColor = g_tex2DColorBuffer.Load( int3(VSOut.f4PixelPos.xy,0) ).rgb;
         f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);
-        float3 f3ReconstructedPosWS = ProjSpaceXYZToWorldSpace(float3(VSOut.f2NormalizedXY.xy, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
-        float3 f3Extinction = GetExtinction(g_CameraAttribs.f4Position.xyz, f3ReconstructedPosWS, g_PPAttribs.f4EarthCenter.xyz,
-                                            g_MediaParams.fAtmBottomRadius, g_MediaParams.fAtmTopRadius, g_MediaParams.f4ParticleScaleHeight);
+        float3 f3Extinction = GetBackgroundExtinction(VSOut.f2NormalizedXY.xy, fCamSpaceZ);
         f3BackgroundColor *= f3Extinction.rgb;
     }
     
@@ -768,7 +953,11 @@ void FixAndApplyInscatteredRadiancePS(FullScreenTriangleVSOutput VSOut,
     f4Color.rgb = (f3BackgroundColor + f3InsctrColor);
 #if PERFORM_TONE_MAPPING
     float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);
+#   if USE_TONE_MAPPING_LUT
+    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3InsctrColor, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);
+#   else
     f4Color.rgb = ToneMap(f3BackgroundColor + f3InsctrColor, g_PPAttribs.ToneMapping, fAveLogLum);
+#   endif
 #else
     const float MinLumn = 0.01;
     float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3InsctrColor, MinLumn);
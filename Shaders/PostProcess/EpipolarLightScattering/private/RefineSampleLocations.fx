@@ -20,6 +20,14 @@ cbuffer cbPostProcessingAttribs
     EpipolarLightScatteringAttribs g_PPAttribs;
 };
 
+#if COMPACT_RAY_MARCHING_SAMPLES
+// Compacted list of ray marching samples. Every element contains sample index
+// in the lower 16 bits and slice index in the higher 16 bits
+RWStructuredBuffer<uint> g_rwRayMarchingSampleList;
+// The first element contains the total number of samples in the list
+RWStructuredBuffer<uint> g_rwRayMarchingSampleCounter;
+#endif
+
 #include "ToneMapping.fxh"
 
 #ifndef INITIAL_SAMPLE_STEP
@@ -34,6 +42,12 @@ cbuffer cbPostProcessingAttribs
 #   define REFINEMENT_CRITERION REFINEMENT_CRITERION_INSCTR_DIFF
 #endif
 
+// Whether to use wave intrinsics. The host only enables this variant
+// when the wave size is at least 32 lanes
+#ifndef USE_WAVE_OPS
+#   define USE_WAVE_OPS 0
+#endif
+
 // In my first implementation I used group shared memory to store camera space z
 // values. This was a very low-performing method
 // After that I tried using arrays of bool flags instead, but this did not help very much
@@ -64,17 +78,20 @@ void RefineSampleLocationsCS(uint3 Gid  : SV_GroupID,
     
     bool bIsValidThread = all( Less( abs(f2SampleLocationPS), (1.0 + 1e-4)*float2(1.0,1.0) ) );
 
+#if !USE_WAVE_OPS
     // Initialize flags with zeroes
     if( GTid.x < uint(NUM_PACKED_FLAGS) )
         g_uiPackedCamSpaceDiffFlags[GTid.x] = 0u;
     
     GroupMemoryBarrierWithGroupSync();
+#endif
 
     // Let each thread in the group compute its own flag
     // Note that if the sample is located behind the screen, its flag will be set to zero
     // Besides, since g_tex2DEpipolarCamSpaceZ is cleared with invalid coordinates, the difference
     // flag between valid and invalid locations will also be zero. Thus the sample next to invalid will always
     // be marked as ray marching sample
+    bool bFlag = false;
     [branch]
     if( bIsValidThread )
     {
@@ -85,7 +102,7 @@ void RefineSampleLocationsCS(uint3 Gid  : SV_GroupID,
         float fMaxZ = max(fCamSpaceZ, fRightNeighbCamSpaceZ);
         fMaxZ = max(fMaxZ, 1.0);
         // Compare the difference with the threshold
-        bool bFlag = abs(fCamSpaceZ - fRightNeighbCamSpaceZ)/fMaxZ < 0.2*g_PPAttribs.fRefinementThreshold;
+        bFlag = abs(fCamSpaceZ - fRightNeighbCamSpaceZ)/fMaxZ < 0.2*g_PPAttribs.fRefinementThreshold;
 #elif REFINEMENT_CRITERION == REFINEMENT_CRITERION_INSCTR_DIFF
         // Load inscattering for this sample and for its right neighbour
         float3 f3Insctr0 = g_tex2DScatteredColor.Load( int3(uiGlobalSampleInd,         uiSliceInd, 0) );
@@ -105,12 +122,24 @@ void RefineSampleLocationsCS(uint3 Gid  : SV_GroupID,
         f3MaxInsctr = max(f3MaxInsctr, f3MinInsctrThreshold);
         // Compare the difference with the threshold. If the neighbour sample is invalid, its inscattering
         // is large negative value and the difference is guaranteed to be larger than the threshold
-        bool bFlag = all( Less(abs(f3Insctr0 - f3Insctr1)/f3MaxInsctr, g_PPAttribs.fRefinementThreshold*float3(1.0,1.0,1.0) ) );
+        bFlag = all( Less(abs(f3Insctr0 - f3Insctr1)/f3MaxInsctr, g_PPAttribs.fRefinementThreshold*float3(1.0,1.0,1.0) ) );
 #endif
+#if !USE_WAVE_OPS
         // Set appropriate flag using INTERLOCKED Or:
         uint uiBit = bFlag ? (1u << (uiSampleInd % 32u)) : 0u;
         InterlockedOr( g_uiPackedCamSpaceDiffFlags[int(uiSampleInd)/32], uiBit );
+#endif
+    }
+
+#if USE_WAVE_OPS
+    {
+        // Every 32 consecutive lanes of the wave produce one flag pack, so the whole pack
+        // is written by a single lane without initialization and atomic operations
+        uint4 ui4FlagBallot = WaveActiveBallot(bFlag);
+        if( (uiSampleInd % 32u) == 0u )
+            g_uiPackedCamSpaceDiffFlags[int(uiSampleInd)/32] = ui4FlagBallot[WaveGetLaneIndex() / 32u];
     }
+#endif
 
     // Synchronize threads in the group
     GroupMemoryBarrierWithGroupSync();
@@ -292,4 +321,30 @@ void RefineSampleLocationsCS(uint3 Gid  : SV_GroupID,
     }
 
     g_rwtex2DInterpolationSource[ int2(uiGlobalSampleInd, uiSliceInd) ] = uint2(uiGroupStartGlobalInd + uiLeftSrcSampleInd, uiGroupStartGlobalInd + uiRightSrcSampleInd);
+
+#if COMPACT_RAY_MARCHING_SAMPLES
+    // Append ray marching samples to the compacted list so that ray marching
+    // only needs to be dispatched for these samples (see RayMarchCompactedSamplesCS())
+    bool bIsRayMarchingSample = uiLeftSrcSampleInd == uiSampleInd && uiRightSrcSampleInd == uiSampleInd;
+#   if USE_WAVE_OPS
+    {
+        // Reserve space for all ray marching samples in the wave with a single atomic operation
+        uint uiNumWaveSamples = WaveActiveCountBits(bIsRayMarchingSample);
+        uint uiWaveListStart = 0u;
+        if( WaveIsFirstLane() && uiNumWaveSamples > 0u )
+            InterlockedAdd(g_rwRayMarchingSampleCounter[0], uiNumWaveSamples, uiWaveListStart);
+        uiWaveListStart = WaveReadLaneFirst(uiWaveListStart);
+        uint uiListInd = uiWaveListStart + WavePrefixCountBits(bIsRayMarchingSample);
+        if( bIsRayMarchingSample )
+            g_rwRayMarchingSampleList[uiListInd] = uiGlobalSampleInd | (uiSliceInd << 16u);
+    }
+#   else
+    if( bIsRayMarchingSample )
+    {
+        uint uiListInd;
+        InterlockedAdd(g_rwRayMarchingSampleCounter[0], 1u, uiListInd);
+        g_rwRayMarchingSampleList[uiListInd] = uiGlobalSampleInd | (uiSliceInd << 16u);
+    }
+#   endif
+#endif
 }
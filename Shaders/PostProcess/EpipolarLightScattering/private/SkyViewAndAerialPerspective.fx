@@ -0,0 +1,149 @@
+// SkyViewAndAerialPerspective.fx
+// Computes the per-frame sky-view and aerial perspective tables that contain unshadowed
+// inscattering and extinction as seen from the current camera position, and the low-resolution
+// sky cube map used as the environment map for image-based lighting
+
+#include "BasicStructures.fxh"
+#include "AtmosphereShadersCommon.fxh"
+
+cbuffer cbParticipatingMediaScatteringParams
+{
+    AirScatteringAttribs g_MediaParams;
+}
+
+cbuffer cbCameraAttribs
+{
+    CameraAttribs g_CameraAttribs;
+}
+
+cbuffer cbLightParams
+{
+    LightAttribs g_LightAttribs;
+}
+
+cbuffer cbPostProcessingAttribs
+{
+    EpipolarLightScatteringAttribs g_PPAttribs;
+}
+
+#ifndef SKY_VIEW_LUT_DIM
+#   define SKY_VIEW_LUT_DIM float2(192.0, 108.0)
+#endif
+
+#ifndef SKY_CUBEMAP_DIM
+#   define SKY_CUBEMAP_DIM 64
+#endif
+
+#ifndef THREAD_GROUP_SIZE
+#   define THREAD_GROUP_SIZE 8
+#endif
+
+// The tables are computed here, so they must not be used
+#undef  USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS
+#define USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS 0
+
+Texture2D<float2> g_tex2DOccludedNetDensityToAtmTop;
+SamplerState      g_tex2DOccludedNetDensityToAtmTop_sampler;
+
+Texture3D<float3> g_tex3DSingleSctrLUT;
+SamplerState      g_tex3DSingleSctrLUT_sampler;
+
+Texture3D<float3> g_tex3DHighOrderSctrLUT;
+SamplerState      g_tex3DHighOrderSctrLUT_sampler;
+
+Texture3D<float3> g_tex3DMultipleSctrLUT;
+SamplerState      g_tex3DMultipleSctrLUT_sampler;
+
+RWTexture2D<float4 /*format = rgba16f*/> g_rwtex2DSkyViewInsctr;
+RWTexture2D<float4 /*format = rgba8*/>   g_rwtex2DSkyViewExtinction;
+
+RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DAerialPerspectiveInsctr;
+RWTexture3D<float4 /*format = rgba8*/>   g_rwtex3DAerialPerspectiveExtinction;
+
+RWTexture2DArray<float4 /*format = rgba16f*/> g_rwtex2DSkyCubemap;
+
+#include "LookUpTables.fxh"
+#include "ScatteringIntegrals.fxh"
+#include "Extinction.fxh"
+#include "SkyViewAndAerialPerspective.fxh"
+#include "UnshadowedScattering.fxh"
+
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void ComputeSkyViewLUTCS(uint3 DTid : SV_DispatchThreadID)
+{
+    if( float(DTid.x) >= SKY_VIEW_LUT_DIM.x || float(DTid.y) >= SKY_VIEW_LUT_DIM.y )
+        return;
+
+    float3 f3CameraPos   = g_CameraAttribs.f4Position.xyz;
+    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;
+
+    float3 f3Zenith, f3Forward, f3Side;
+    GetSkyViewBasis(f3CameraPos, f3EarthCentre, -g_LightAttribs.f4Direction.xyz, f3Zenith, f3Forward, f3Side);
+    float2 f2UV = (float2(DTid.xy) + float2(0.5, 0.5)) / SKY_VIEW_LUT_DIM;
+    float3 f3ViewDir = SkyViewUVToDir(f2UV, f3Zenith, f3Forward, f3Side, GetSkyViewHorizonZenithAngle(length(f3CameraPos - f3EarthCentre)));
+
+    float3 f3Inscattering, f3Extinction;
+    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, +FLT_MAX, g_PPAttribs.uiInstrIntegralSteps, f3EarthCentre, f3Inscattering, f3Extinction);
+
+    g_rwtex2DSkyViewInsctr[DTid.xy]     = float4(f3Inscattering, 0.0);
+    g_rwtex2DSkyViewExtinction[DTid.xy] = float4(f3Extinction, 0.0);
+}
+
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void ComputeAerialPerspectiveLUTCS(uint3 DTid : SV_DispatchThreadID)
+{
+    uint uiResolution = g_PPAttribs.uiAerialPerspectiveLUTResolution;
+    if( DTid.x >= uiResolution || DTid.y >= uiResolution )
+        return;
+
+    float2 f2PosPS     = TexUVToNormalizedDeviceXY( (float2(DTid.xy) + float2(0.5, 0.5)) / float(uiResolution) );
+    float  fCamSpaceZ  = float(DTid.z + 1u) / float(g_PPAttribs.uiAerialPerspectiveLUTDepth) * g_PPAttribs.fAerialPerspectiveLUTMaxDist;
+    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;
+    float3 f3PosWS     = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);
+    float3 f3ViewDir   = f3PosWS - f3CameraPos;
+    float  fRayLength  = length(f3ViewDir);
+    f3ViewDir /= fRayLength;
+
+    float3 f3Inscattering, f3Extinction;
+    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, fRayLength, g_PPAttribs.uiInstrIntegralSteps, g_PPAttribs.f4EarthCenter.xyz, f3Inscattering, f3Extinction);
+
+    g_rwtex3DAerialPerspectiveInsctr[DTid]     = float4(f3Inscattering, 0.0);
+    g_rwtex3DAerialPerspectiveExtinction[DTid] = float4(f3Extinction, 0.0);
+}
+
+// Returns the direction that corresponds to the texel of the cube map face (D3D face order and orientation)
+float3 GetSkyCubemapDirection(uint3 Texel)
+{
+    float2 f2UV = (float2(Texel.xy) + float2(0.5, 0.5)) / float(SKY_CUBEMAP_DIM) * 2.0 - float2(1.0, 1.0);
+    float3 f3Dir;
+    if (Texel.z == 0u)
+        f3Dir = float3(+1.0, -f2UV.y, -f2UV.x);
+    else if (Texel.z == 1u)
+        f3Dir = float3(-1.0, -f2UV.y, +f2UV.x);
+    else if (Texel.z == 2u)
+        f3Dir = float3(+f2UV.x, +1.0, +f2UV.y);
+    else if (Texel.z == 3u)
+        f3Dir = float3(+f2UV.x, -1.0, -f2UV.y);
+    else if (Texel.z == 4u)
+        f3Dir = float3(+f2UV.x, -f2UV.y, +1.0);
+    else
+        f3Dir = float3(-f2UV.x, -f2UV.y, -1.0);
+    return normalize(f3Dir);
+}
+
+// Renders the sky radiance as seen from the camera position into the cube map that can be used
+// as the environment map for image-based lighting. The sun disk is not included.
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void RenderSkyCubemapCS(uint3 DTid : SV_DispatchThreadID)
+{
+    if( DTid.x >= uint(SKY_CUBEMAP_DIM) || DTid.y >= uint(SKY_CUBEMAP_DIM) )
+        return;
+
+    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;
+    float3 f3ViewDir   = GetSkyCubemapDirection(DTid);
+
+    float3 f3Inscattering, f3Extinction;
+    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, +FLT_MAX, g_PPAttribs.uiInstrIntegralSteps, g_PPAttribs.f4EarthCenter.xyz, f3Inscattering, f3Extinction);
+
+    g_rwtex2DSkyCubemap[DTid] = float4(f3Inscattering * g_LightAttribs.f4Intensity.rgb, 1.0);
+}
@@ -0,0 +1,169 @@
+// UpsampleInscattering.fx
+// Upsamples inscattering ray marched at reduced resolution using bilateral filter guided
+// by camera space z and combines it with the back buffer
+
+#include "BasicStructures.fxh"
+#include "AtmosphereShadersCommon.fxh"
+
+cbuffer cbParticipatingMediaScatteringParams
+{
+    AirScatteringAttribs g_MediaParams;
+}
+
+cbuffer cbLightParams
+{
+    LightAttribs g_LightAttribs;
+}
+
+cbuffer cbPostProcessingAttribs
+{
+    EpipolarLightScatteringAttribs g_PPAttribs;
+}
+
+cbuffer cbCameraAttribs
+{
+    CameraAttribs g_CameraAttribs;
+}
+
+Texture2D<float4> g_tex2DDownscaledInsctr;
+Texture2D<float>  g_tex2DDownscaledCamSpaceZ;
+
+Texture2D<float>  g_tex2DCamSpaceZ;
+
+Texture2D<float4> g_tex2DColorBuffer;
+
+Texture2D<float>  g_tex2DAverageLuminance;
+
+#if USE_TONE_MAPPING_LUT
+Texture3D<float4> g_tex3DToneMappingLUT;
+SamplerState      g_tex3DToneMappingLUT_sampler;
+#endif
+
+#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS
+Texture2D<float3> g_tex2DSkyViewInsctr;
+SamplerState      g_tex2DSkyViewInsctr_sampler;
+
+Texture2D<float3> g_tex2DSkyViewExtinction;
+SamplerState      g_tex2DSkyViewExtinction_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveInsctr;
+SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;
+
+Texture3D<float3> g_tex3DAerialPerspectiveExtinction;
+SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;
+#endif
+
+#include "Extinction.fxh"
+#include "SkyViewAndAerialPerspective.fxh"
+#include "ToneMapping.fxh"
+
+void UpsampleDownscaledInsctr(in  int2   i2PixelPos,
+                              in  float  fCamSpaceZ,
+                              out float3 f3Inscattering)
+{
+    int  iDownscaleFactor = int(g_PPAttribs.uiBruteForceDownscaleFactor);
+    int2 i2ScreenDim      = int2(g_PPAttribs.f4ScreenResolution.xy);
+    int2 i2DownscaledDim  = (i2ScreenDim + int2(iDownscaleFactor - 1, iDownscaleFactor - 1)) / iDownscaleFactor;
+
+    // Downscaled texel i contains inscattering ray marched for the full resolution
+    // pixel i * DownscaleFactor + DownscaleFactor/2 (see RayMarchDownscaledPS()):
+    //
+    //      0   1   2   3   4   5   6   7      Full resolution pixel
+    //    |   |   | X |   |   |   | X |   |
+    //    |<------------->|<------------->|
+    //            0               1            Downscaled texel (DownscaleFactor == 4)
+    //
+    float2 f2SrcPos      = float2(i2PixelPos - int2(iDownscaleFactor/2, iDownscaleFactor/2)) / float(iDownscaleFactor);
+    float2 f2SrcPosFloor = floor(f2SrcPos);
+    float2 f2UVWeight    = f2SrcPos - f2SrcPosFloor;
+    int2   i2SrcPos      = int2(f2SrcPosFloor);
+
+    float3 f3BilinearInsctr = float3(0.0, 0.0, 0.0);
+    f3Inscattering = float3(0.0, 0.0, 0.0);
+    float fTotalWeight = 0.0;
+    [unroll]
+    for (int j = 0; j < 2; ++j)
+    {
+        [unroll]
+        for (int i = 0; i < 2; ++i)
+        {
+            int2 i2SrcTexel = clamp(i2SrcPos + int2(i, j), int2(0, 0), i2DownscaledDim - int2(1, 1));
+            float  fSrcCamSpaceZ = g_tex2DDownscaledCamSpaceZ.Load( int3(i2SrcTexel, 0) );
+            float3 f3SrcInsctr   = g_tex2DDownscaledInsctr.Load( int3(i2SrcTexel, 0) ).rgb;
+
+            float fBilinearWeight = (i == 0 ? 1.0 - f2UVWeight.x : f2UVWeight.x) *
+                                    (j == 0 ? 1.0 - f2UVWeight.y : f2UVWeight.y);
+
+            // Compute depth weight in a way that if the difference is less than the threshold, the weight is 1 and
+            // the weight fades out to 0 as the difference becomes larger than the threshold
+            // (the same way as in UnwarpEpipolarInsctrImage())
+            float fMaxZ = max( max(fSrcCamSpaceZ, fCamSpaceZ), 1.0 );
+            float fThreshold = g_PPAttribs.fBruteForceUpsampleDepthThreshold;
+            float fDepthWeight = saturate( fThreshold / max( abs(fCamSpaceZ - fSrcCamSpaceZ) / fMaxZ, fThreshold ) );
+            fDepthWeight = pow(fDepthWeight, 4.0);
+
+            f3BilinearInsctr += fBilinearWeight * f3SrcInsctr;
+            f3Inscattering   += fBilinearWeight * fDepthWeight * f3SrcInsctr;
+            fTotalWeight     += fBilinearWeight * fDepthWeight;
+        }
+    }
+
+    if( fTotalWeight < 1e-2 )
+    {
+#if CORRECT_INSCATTERING_AT_DEPTH_BREAKS
+        // None of the low-resolution samples belongs to the same surface as this pixel.
+        // Discarded pixels will keep 1.0 in the depth buffer and will be later
+        // ray marched at full resolution
+        discard;
+#else
+        f3Inscattering = f3BilinearInsctr;
+        fTotalWeight   = 1.0;
+#endif
+    }
+
+    f3Inscattering /= fTotalWeight;
+}
+
+
+void UpsampleAndApplyInscatteringPS(FullScreenTriangleVSOutput VSOut,
+                                    // IMPORTANT: non-system generated pixel shader input
+                                    // arguments must have the exact same name as vertex shader
+                                    // outputs and must go in the same order.
+                                    // Moreover, even if the shader is not using the argument,
+                                    // it still must be declared.
+
+                                    out float4 f4Color : SV_Target)
+{
+    // Note that the render target may be smaller than the screen when rendering luminance
+    int2 i2PixelPos = int2( NormalizedDeviceXYToTexUV(VSOut.f2NormalizedXY) * g_PPAttribs.f4ScreenResolution.xy );
+    i2PixelPos = min(i2PixelPos, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));
+    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );
+
+    float3 f3Inscattering;
+    UpsampleDownscaledInsctr(i2PixelPos, fCamSpaceZ, f3Inscattering);
+
+    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);
+    [branch]
+    if( !g_PPAttribs.bShowLightingOnly )
+    {
+        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;
+        // fFarPlaneZ is pre-multiplied with 0.999999f
+        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);
+        float3 f3Extinction = GetBackgroundExtinction(VSOut.f2NormalizedXY.xy, fCamSpaceZ);
+        f3BackgroundColor *= f3Extinction;
+    }
+
+#if PERFORM_TONE_MAPPING
+    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);
+#   if USE_TONE_MAPPING_LUT
+    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);
+#   else
+    f4Color.rgb = ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum);
+#   endif
+#else
+    const float MinLumn = 0.01;
+    float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3Inscattering, MinLumn);
+    f4Color.rgb = float3(LogLum_W.x, LogLum_W.y, 0.0);
+#endif
+    f4Color.a = 1.0;
+}
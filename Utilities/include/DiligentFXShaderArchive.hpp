@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/Shader.h"
+#include "../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Archive of precompiled DiligentFX shader permutations.
+
+/// The archive is produced offline by the DiligentFX-PrecompiledShaders build target
+/// (see BuildTools/PrecompileShaders) and contains the byte code of every permutation listed
+/// in the permutation manifests, one section per device type. Permutations are identified by
+/// the hash of the shader file name, entry point, shader type, compiler, HLSL version,
+/// combined texture samplers flag and macros, see ComputePermutationHash().
+///
+/// DiligentFX modules create all their shaders through CreateShader(), which uses the byte code
+/// from the archive when it is available and compiles the shader from source otherwise.
+/// OpenGL and Metal devices always compile from source.
+class DiligentFXShaderArchive
+{
+public:
+    static DiligentFXShaderArchive& GetInstance();
+
+    // clang-format off
+    DiligentFXShaderArchive           (const DiligentFXShaderArchive&)  = delete;
+    DiligentFXShaderArchive           (      DiligentFXShaderArchive&&) = delete;
+    DiligentFXShaderArchive& operator=(const DiligentFXShaderArchive&)  = delete;
+    DiligentFXShaderArchive& operator=(      DiligentFXShaderArchive&&) = delete;
+    // clang-format on
+
+    /// Loads the archive data. The data is copied, so the memory may be released after the call.
+    /// Permutations that are already present are replaced.
+    /// Returns false if the data is not a valid archive.
+    bool Load(const void* pData, size_t Size);
+
+    /// Removes all permutations from the archive.
+    void Clear();
+
+    /// Creates the shader from the precompiled byte code if the archive contains the permutation
+    /// for the device type, and from the source otherwise.
+    RefCntAutoPtr<IShader> CreateShader(IRenderDevice* pDevice, const ShaderCreateInfo& ShaderCI);
+
+    /// When recording is enabled, every permutation that is compiled from source is recorded.
+    /// Recorded permutations may be added to the manifest of the build target.
+    void SetRecordMissingPermutations(bool Record);
+
+    /// Returns the recorded permutations in the permutation manifest format.
+    std::string GetRecordedPermutations() const;
+
+    /// Returns the number of shaders that were created from the precompiled byte code.
+    Uint32 GetNumHits() const { return m_NumHits; }
+
+    /// Returns the number of shaders that were compiled from source.
+    Uint32 GetNumMisses() const { return m_NumMisses; }
+
+    /// Returns the key that identifies the shader permutation.
+    /// Macros are sorted by name, so that the key does not depend on the order in which they are defined.
+    static std::string GetPermutationKey(const ShaderCreateInfo& ShaderCI);
+
+    /// Returns the 64-bit FNV-1a hash of the permutation key.
+    static Uint64 ComputePermutationHash(const ShaderCreateInfo& ShaderCI);
+
+private:
+    DiligentFXShaderArchive() = default;
+
+    mutable std::mutex m_Mtx;
+
+    // Archive data that is referenced by m_ByteCode
+    std::vector<std::vector<Uint8>> m_Data;
+
+    struct ByteCodeData
+    {
+        const Uint8* pData = nullptr;
+        size_t       Size  = 0;
+    };
+    // Device type -> permutation hash -> byte code
+    std::unordered_map<Uint32, std::unordered_map<Uint64, ByteCodeData>> m_ByteCode;
+
+    bool                  m_RecordMissingPermutations = false;
+    std::set<std::string> m_RecordedPermutations;
+
+    std::atomic<Uint32> m_NumHits{0};
+    std::atomic<Uint32> m_NumMisses{0};
+};
+
+} // namespace Diligent
@@ -71,7 +71,14 @@ public:
 
 private:
     DiligentFXShaderSourceStreamFactory();
-    std::unordered_map<HashMapStringKey, const Char*> m_NameToSourceMap;
+
+    struct ShaderSourceInfo
+    {
+        const Char* Source = nullptr;
+        size_t      Length = 0;
+    };
+    // Sources are static strings that are referenced by the streams without copying
+    std::unordered_map<HashMapStringKey, ShaderSourceInfo> m_NameToSourceMap;
 };
 
 } // namespace Diligent
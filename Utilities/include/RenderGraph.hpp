@@ -0,0 +1,209 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/DeviceContext.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/Texture.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/Buffer.h"
+#include "../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class TransientTexturePool;
+
+/// Lightweight frame graph that orders resource state transitions between passes.
+
+/// Every pass declares the resources it reads and writes together with the states it requires.
+/// When the graph is executed, it
+/// - culls passes whose results are not consumed by other passes or graph outputs,
+/// - computes lifetimes of transient textures and acquires them from a TransientTexturePool
+///   right before the first pass that uses them and returns them after the last one, so that
+///   textures with non-overlapping lifetimes share memory,
+/// - issues all state transitions required by a pass in a single TransitionResourceStates call.
+///
+/// Transitions are recorded with STATE_TRANSITION_FLAG_UPDATE_STATE, so passes that still use
+/// RESOURCE_STATE_TRANSITION_MODE_TRANSITION find their resources in the required states and do not
+/// insert barriers of their own. This allows modules to be moved to the graph one at a time.
+///
+/// The graph is expected to be rebuilt every frame: call Reset(), add passes and call Execute().
+class RenderGraph
+{
+    struct Pass;
+
+public:
+    using ResourceId = Uint32;
+
+    static constexpr ResourceId InvalidResourceId = ~ResourceId{0};
+
+    /// Creates the render graph.
+
+    /// \param [in] pDevice - Render device.
+    /// \param [in] pPool   - Optional pool to allocate transient textures from. If this parameter
+    ///                       is null, the graph will use its own pool.
+    RenderGraph(IRenderDevice* pDevice, TransientTexturePool* pPool = nullptr);
+    ~RenderGraph();
+
+    // clang-format off
+    RenderGraph           (const RenderGraph&)  = delete;
+    RenderGraph           (      RenderGraph&&) = delete;
+    RenderGraph& operator=(const RenderGraph&)  = delete;
+    RenderGraph& operator=(      RenderGraph&&) = delete;
+    // clang-format on
+
+    /// Imports an external texture into the graph. Importing the same texture again
+    /// returns the same identifier, so modules may import resources independently.
+    ResourceId ImportTexture(ITexture* pTexture);
+
+    /// Imports an external buffer into the graph.
+    ResourceId ImportBuffer(IBuffer* pBuffer);
+
+    /// Declares a transient texture that only lives while passes that use it are executed.
+    /// The contents of the texture are undefined before the first pass that writes it.
+    ResourceId CreateTexture(const TextureDesc& Desc);
+
+    /// Marks the resource as a graph output. Passes that contribute to outputs are never culled.
+    /// If FinalState is not RESOURCE_STATE_UNKNOWN, the resource is transitioned to this state
+    /// after the last pass.
+    void SetOutput(ResourceId Id, RESOURCE_STATE FinalState = RESOURCE_STATE_UNKNOWN);
+
+    /// Returns the texture, which for transient textures is only valid while the passes that use it are executed.
+    ITexture* GetTexture(ResourceId Id) const;
+
+    /// Returns the buffer.
+    IBuffer* GetBuffer(ResourceId Id) const;
+
+    /// Interface used by passes to declare their resource usage.
+    class PassBuilder
+    {
+    public:
+        /// Declares that the pass reads the resource in the given state.
+        void Read(ResourceId Id, RESOURCE_STATE State);
+
+        /// Declares that the pass writes the resource in the given state.
+        void Write(ResourceId Id, RESOURCE_STATE State);
+
+        /// Indicates that the pass has effects outside of the graph and must never be culled.
+        void SetSideEffects() { m_Pass.HasSideEffects = true; }
+
+    private:
+        friend RenderGraph;
+        PassBuilder(RenderGraph& Graph, Pass& Pass) :
+            m_Graph{Graph},
+            m_Pass{Pass}
+        {}
+
+        void AddUsage(ResourceId Id, RESOURCE_STATE State, bool IsWrite);
+
+        RenderGraph& m_Graph;
+        Pass&        m_Pass;
+    };
+
+    using SetupCallbackType   = std::function<void(PassBuilder&)>;
+    using ExecuteCallbackType = std::function<void(IDeviceContext*)>;
+
+    /// Adds a pass to the graph. Passes are executed in the order they are added.
+
+    /// \param [in] Name    - Pass name used in messages.
+    /// \param [in] Setup   - Callback that declares resources used by the pass. It is called immediately.
+    /// \param [in] Execute - Callback that records the pass commands. It is called by Execute() if the
+    ///                       pass is not culled, after all declared resources have been transitioned
+    ///                       to the required states.
+    void AddPass(const char* Name, const SetupCallbackType& Setup, ExecuteCallbackType Execute);
+
+    /// Culls unused passes, executes the remaining ones and transitions outputs to their final states.
+    void Execute(IDeviceContext* pContext);
+
+    /// Removes all passes and resources.
+    void Reset();
+
+    /// Returns the number of passes that were executed by the last call to Execute().
+    Uint32 GetNumExecutedPasses() const { return m_NumExecutedPasses; }
+
+    /// Returns the number of state transitions issued by the last call to Execute().
+    Uint32 GetNumTransitions() const { return m_NumTransitions; }
+
+    TransientTexturePool* GetTransientTexturePool() const { return m_pPool; }
+
+private:
+    struct Resource
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+        RefCntAutoPtr<IBuffer>  pBuffer;
+
+        TextureDesc TransientDesc;
+        bool        IsTransient = false;
+        bool        IsOutput    = false;
+
+        RESOURCE_STATE FinalState = RESOURCE_STATE_UNKNOWN;
+
+        // Indices of the first and the last pass that use the resource, set by Compile()
+        Uint32 FirstPass = ~0u;
+        Uint32 LastPass  = 0;
+    };
+
+    struct ResourceUsage
+    {
+        ResourceId     Id      = InvalidResourceId;
+        RESOURCE_STATE State   = RESOURCE_STATE_UNKNOWN;
+        bool           IsRead  = false;
+        bool           IsWrite = false;
+    };
+
+    struct Pass
+    {
+        std::string                Name;
+        std::vector<ResourceUsage> Usages;
+        ExecuteCallbackType        Execute;
+        bool                       HasSideEffects = false;
+        bool                       IsCulled       = false;
+    };
+
+    void Compile();
+    void TransitionResources(IDeviceContext* pContext, std::vector<StateTransitionDesc>& Barriers);
+
+    RefCntAutoPtr<IRenderDevice>          m_pDevice;
+    std::unique_ptr<TransientTexturePool> m_pOwnPool;
+    TransientTexturePool*                 m_pPool = nullptr;
+
+    std::vector<Resource>                          m_Resources;
+    std::unordered_map<IDeviceObject*, ResourceId> m_ImportedResources;
+    std::vector<Pass>                              m_Passes;
+
+    Uint32 m_NumExecutedPasses = 0;
+    Uint32 m_NumTransitions    = 0;
+};
+
+} // namespace Diligent
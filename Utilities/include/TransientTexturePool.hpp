@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/RenderDevice.h"
+#include "../../../DiligentCore/Graphics/GraphicsEngine/interface/Texture.h"
+#include "../../../DiligentCore/Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Pool of intermediate textures that are only alive during a part of the frame.
+
+/// A module acquires a texture before the first pass that writes it and releases it after
+/// the last pass that reads it. Released textures are handed out to subsequent requests
+/// with a compatible description, so intermediates whose lifetimes do not overlap share
+/// the same memory. The pool may be shared by several DiligentFX modules.
+/// The contents of a texture are undefined after it has been acquired.
+class TransientTexturePool
+{
+public:
+    explicit TransientTexturePool(IRenderDevice* pDevice);
+
+    // clang-format off
+    TransientTexturePool           (const TransientTexturePool&)  = delete;
+    TransientTexturePool           (      TransientTexturePool&&) = delete;
+    TransientTexturePool& operator=(const TransientTexturePool&)  = delete;
+    TransientTexturePool& operator=(      TransientTexturePool&&) = delete;
+    // clang-format on
+
+    /// Returns a texture that is compatible with the description and is not in use.
+    /// If pPreferred is compatible and is not in use, it is returned, so that a module that
+    /// acquires the same intermediate every frame keeps getting the same texture when possible.
+    /// New texture is created if no suitable texture is available.
+    RefCntAutoPtr<ITexture> Acquire(const TextureDesc& Desc, ITexture* pPreferred = nullptr);
+
+    /// Returns the texture to the pool.
+    void Release(ITexture* pTexture);
+
+    /// Destroys all textures that are not in use.
+    void Purge();
+
+    /// Returns the total number of textures in the pool.
+    size_t GetTextureCount() const { return m_Textures.size(); }
+
+private:
+    static bool IsCompatible(const TextureDesc& TexDesc, const TextureDesc& RequiredDesc);
+
+    struct PooledTexture
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+        bool                    InUse = false;
+    };
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    std::vector<PooledTexture>   m_Textures;
+};
+
+} // namespace Diligent
@@ -0,0 +1,344 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "../include/DiligentFXShaderArchive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Archive layout (all values are little-endian):
+//
+//  Uint32 Magic, Uint32 Version, Uint32 NumSections
+//  NumSections x {
+//      Uint32 DeviceType, Uint32 NumPermutations
+//      NumPermutations x { Uint64 Hash, Uint32 Offset, Uint32 Size }
+//  }
+//  Byte code
+//
+// Offsets are counted from the beginning of the archive.
+// Keep in sync with BuildTools/PrecompileShaders/precompile_shaders.py
+constexpr Uint32 ArchiveMagic   = 0x41584644; // 'DFXA'
+constexpr Uint32 ArchiveVersion = 2;
+
+class ArchiveReader
+{
+public:
+    ArchiveReader(const Uint8* pData, size_t Size) :
+        m_pData{pData},
+        m_Size{Size}
+    {}
+
+    template <typename T>
+    bool Read(T& Val)
+    {
+        if (m_Offset + sizeof(T) > m_Size)
+            return false;
+        memcpy(&Val, m_pData + m_Offset, sizeof(T));
+        m_Offset += sizeof(T);
+        return true;
+    }
+
+private:
+    const Uint8* const m_pData;
+    const size_t       m_Size;
+    size_t             m_Offset = 0;
+};
+
+const char* GetShaderTypeKey(SHADER_TYPE Type)
+{
+    switch (Type)
+    {
+        // clang-format off
+        case SHADER_TYPE_VERTEX:   return "vs";
+        case SHADER_TYPE_PIXEL:    return "ps";
+        case SHADER_TYPE_GEOMETRY: return "gs";
+        case SHADER_TYPE_HULL:     return "hs";
+        case SHADER_TYPE_DOMAIN:   return "ds";
+        case SHADER_TYPE_COMPUTE:  return "cs";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected shader type");
+            return "unknown";
+    }
+}
+
+// Keep in sync with SHADER_COMPILERS in precompile_shaders.py
+const char* GetShaderCompilerKey(SHADER_COMPILER Compiler)
+{
+    switch (Compiler)
+    {
+        // clang-format off
+        case SHADER_COMPILER_DEFAULT: return "default";
+        case SHADER_COMPILER_GLSLANG: return "glslang";
+        case SHADER_COMPILER_DXC:     return "dxc";
+        case SHADER_COMPILER_FXC:     return "fxc";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected shader compiler");
+            return "unknown";
+    }
+}
+
+std::string GetHLSLVersionKey(const ShaderVersion& Version)
+{
+    std::stringstream ss;
+    ss << Uint32{Version.Major} << '.' << Uint32{Version.Minor};
+    return ss.str();
+}
+
+std::vector<std::pair<const Char*, const Char*>> GetSortedMacros(const ShaderMacro* Macros)
+{
+    std::vector<std::pair<const Char*, const Char*>> SortedMacros;
+    for (auto* Macro = Macros; Macro != nullptr && Macro->Name != nullptr; ++Macro)
+        SortedMacros.emplace_back(Macro->Name, Macro->Definition != nullptr ? Macro->Definition : "");
+
+    std::stable_sort(SortedMacros.begin(), SortedMacros.end(),
+                     [](const std::pair<const Char*, const Char*>& lhs, const std::pair<const Char*, const Char*>& rhs) {
+                         return strcmp(lhs.first, rhs.first) < 0;
+                     });
+    return SortedMacros;
+}
+
+void WriteJSONString(std::stringstream& ss, const Char* Str)
+{
+    ss << '"';
+    for (auto* c = Str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            ss << '\\';
+        ss << *c;
+    }
+    ss << '"';
+}
+
+} // namespace
+
+DiligentFXShaderArchive& DiligentFXShaderArchive::GetInstance()
+{
+    static DiligentFXShaderArchive TheArchive;
+    return TheArchive;
+}
+
+bool DiligentFXShaderArchive::Load(const void* pData, size_t Size)
+{
+    std::vector<Uint8> Data(static_cast<const Uint8*>(pData), static_cast<const Uint8*>(pData) + Size);
+
+    ArchiveReader Reader{Data.data(), Data.size()};
+
+    Uint32 Magic       = 0;
+    Uint32 Version     = 0;
+    Uint32 NumSections = 0;
+    if (!Reader.Read(Magic) || !Reader.Read(Version) || !Reader.Read(NumSections) || Magic != ArchiveMagic)
+    {
+        LOG_ERROR_MESSAGE("The data is not a valid DiligentFX shader archive");
+        return false;
+    }
+    if (Version != ArchiveVersion)
+    {
+        LOG_ERROR_MESSAGE("DiligentFX shader archive version ", Version, " is not supported. Expected version: ", ArchiveVersion);
+        return false;
+    }
+
+    std::unordered_map<Uint32, std::unordered_map<Uint64, ByteCodeData>> ByteCode;
+    for (Uint32 section = 0; section < NumSections; ++section)
+    {
+        Uint32 DeviceType      = 0;
+        Uint32 NumPermutations = 0;
+        if (!Reader.Read(DeviceType) || !Reader.Read(NumPermutations))
+        {
+            LOG_ERROR_MESSAGE("DiligentFX shader archive is truncated");
+            return false;
+        }
+
+        auto& Permutations = ByteCode[DeviceType];
+        for (Uint32 i = 0; i < NumPermutations; ++i)
+        {
+            Uint64 Hash   = 0;
+            Uint32 Offset = 0;
+            Uint32 BCSize = 0;
+            if (!Reader.Read(Hash) || !Reader.Read(Offset) || !Reader.Read(BCSize) || size_t{Offset} + size_t{BCSize} > Data.size())
+            {
+                LOG_ERROR_MESSAGE("DiligentFX shader archive is truncated");
+                return false;
+            }
+            Permutations[Hash] = ByteCodeData{Data.data() + Offset, BCSize};
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    for (auto& Section : ByteCode)
+    {
+        auto& Permutations = m_ByteCode[Section.first];
+        for (auto& Permutation : Section.second)
+            Permutations[Permutation.first] = Permutation.second;
+    }
+    // Moving the vector does not move its elements, so the pointers remain valid
+    m_Data.emplace_back(std::move(Data));
+
+    return true;
+}
+
+void DiligentFXShaderArchive::Clear()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_ByteCode.clear();
+    m_Data.clear();
+}
+
+RefCntAutoPtr<IShader> DiligentFXShaderArchive::CreateShader(IRenderDevice* pDevice, const ShaderCreateInfo& ShaderCI)
+{
+    RefCntAutoPtr<IShader> pShader;
+
+    const auto Hash = ComputePermutationHash(ShaderCI);
+
+    ByteCodeData ByteCode;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto SectionIt = m_ByteCode.find(static_cast<Uint32>(pDevice->GetDeviceInfo().Type));
+        if (SectionIt != m_ByteCode.end())
+        {
+            auto it = SectionIt->second.find(Hash);
+            if (it != SectionIt->second.end())
+                ByteCode = it->second;
+        }
+    }
+
+    if (ByteCode.pData != nullptr)
+    {
+        ShaderCreateInfo ByteCodeCI{ShaderCI};
+        ByteCodeCI.FilePath                   = nullptr;
+        ByteCodeCI.Source                     = nullptr;
+        ByteCodeCI.Macros                     = nullptr;
+        ByteCodeCI.pShaderSourceStreamFactory = nullptr;
+        ByteCodeCI.ByteCode                   = ByteCode.pData;
+        ByteCodeCI.ByteCodeSize               = ByteCode.Size;
+        pDevice->CreateShader(ByteCodeCI, &pShader);
+        if (pShader)
+        {
+            ++m_NumHits;
+            return pShader;
+        }
+
+        LOG_WARNING_MESSAGE("Failed to create shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""),
+                            "' from the precompiled byte code. The shader will be compiled from source.");
+    }
+
+    ++m_NumMisses;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (m_RecordMissingPermutations)
+        {
+            std::stringstream ss;
+            ss << "{\"file\": ";
+            WriteJSONString(ss, ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "");
+            ss << ", \"entry\": ";
+            WriteJSONString(ss, ShaderCI.EntryPoint != nullptr ? ShaderCI.EntryPoint : "main");
+            ss << ", \"type\": \"" << GetShaderTypeKey(ShaderCI.Desc.ShaderType) << '"'
+               << ", \"compiler\": \"" << GetShaderCompilerKey(ShaderCI.ShaderCompiler) << '"'
+               << ", \"hlsl_version\": \"" << GetHLSLVersionKey(ShaderCI.HLSLVersion) << '"'
+               << ", \"combined_samplers\": \"" << (ShaderCI.UseCombinedTextureSamplers ? '1' : '0') << '"'
+               << ", \"macros\": {";
+            const auto SortedMacros = GetSortedMacros(ShaderCI.Macros);
+            for (size_t i = 0; i < SortedMacros.size(); ++i)
+            {
+                ss << (i > 0 ? ", " : "");
+                WriteJSONString(ss, SortedMacros[i].first);
+                ss << ": ";
+                WriteJSONString(ss, SortedMacros[i].second);
+            }
+            ss << "}}";
+            m_RecordedPermutations.emplace(ss.str());
+        }
+    }
+
+    pDevice->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+void DiligentFXShaderArchive::SetRecordMissingPermutations(bool Record)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_RecordMissingPermutations = Record;
+}
+
+std::string DiligentFXShaderArchive::GetRecordedPermutations() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    std::stringstream ss;
+    ss << "{\n    \"permutations\": [";
+    bool IsFirst = true;
+    for (const auto& Permutation : m_RecordedPermutations)
+    {
+        ss << (IsFirst ? "\n        " : ",\n        ") << Permutation;
+        IsFirst = false;
+    }
+    ss << "\n    ]\n}\n";
+    return ss.str();
+}
+
+std::string DiligentFXShaderArchive::GetPermutationKey(const ShaderCreateInfo& ShaderCI)
+{
+    // Shaders that are created from memory can't be precompiled and are not expected here
+    VERIFY(ShaderCI.FilePath != nullptr, "DiligentFX shaders are expected to be created from files");
+
+    std::stringstream ss;
+    ss << (ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "") << '|'
+       << (ShaderCI.EntryPoint != nullptr ? ShaderCI.EntryPoint : "main") << '|'
+       << GetShaderTypeKey(ShaderCI.Desc.ShaderType) << '|'
+       << GetShaderCompilerKey(ShaderCI.ShaderCompiler) << '|'
+       << GetHLSLVersionKey(ShaderCI.HLSLVersion) << '|'
+       << (ShaderCI.UseCombinedTextureSamplers ? '1' : '0');
+    for (const auto& Macro : GetSortedMacros(ShaderCI.Macros))
+        ss << '|' << Macro.first << '=' << Macro.second;
+    return ss.str();
+}
+
+Uint64 DiligentFXShaderArchive::ComputePermutationHash(const ShaderCreateInfo& ShaderCI)
+{
+    const auto Key = GetPermutationKey(ShaderCI);
+
+    Uint64 Hash = 14695981039346656037ull;
+    for (auto c : Key)
+    {
+        Hash ^= static_cast<Uint8>(c);
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+} // namespace Diligent
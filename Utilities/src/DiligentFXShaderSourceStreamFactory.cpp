@@ -25,15 +25,65 @@
  *  of the possibility of such damages.
  */
 
+#include <cstring>
+
 #include "../include/DiligentFXShaderSourceStreamFactory.hpp"
 #include "MemoryFileStream.hpp"
-#include "StringDataBlobImpl.hpp"
+#include "DataBlob.h"
+#include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "../../../shaders_inc/shaders_list.h"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Data blob that references a static shader source string. Unlike StringDataBlobImpl,
+// it does not copy the string, which is important as large headers are included by
+// many shaders.
+class StaticShaderSourceBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    using TBase = ObjectBase<IDataBlob>;
+
+    StaticShaderSourceBlob(IReferenceCounters* pRefCounters, const Char* Source, size_t Length) :
+        TBase{pRefCounters},
+        m_Source{Source},
+        m_Length{Length}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DataBlob, TBase)
+
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override final
+    {
+        UNEXPECTED("Static shader source can't be resized");
+    }
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override final
+    {
+        return m_Length;
+    }
+
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr() override final
+    {
+        // The stream never writes to the blob
+        return const_cast<Char*>(m_Source);
+    }
+
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr() const override final
+    {
+        return m_Source;
+    }
+
+private:
+    const Char* const m_Source;
+    const size_t      m_Length;
+};
+
+} // namespace
+
 DiligentFXShaderSourceStreamFactory& DiligentFXShaderSourceStreamFactory::GetInstance()
 {
     static DiligentFXShaderSourceStreamFactory TheFactory;
@@ -44,7 +94,10 @@ DiligentFXShaderSourceStreamFactory::DiligentFXShaderSourceStreamFactory()
 {
     for (size_t i = 0; i < _countof(g_Shaders); ++i)
     {
-        m_NameToSourceMap.emplace(g_Shaders[i].FileName, g_Shaders[i].Source);
+        ShaderSourceInfo SrcInfo;
+        SrcInfo.Source = g_Shaders[i].Source;
+        SrcInfo.Length = strlen(g_Shaders[i].Source);
+        m_NameToSourceMap.emplace(g_Shaders[i].FileName, SrcInfo);
     }
 }
 
@@ -61,8 +114,9 @@ void DiligentFXShaderSourceStreamFactory::CreateInputStream2(const Char*
     auto SourceIt = m_NameToSourceMap.find(Name);
     if (SourceIt != m_NameToSourceMap.end())
     {
-        RefCntAutoPtr<StringDataBlobImpl> pDataBlob(MakeNewRCObj<StringDataBlobImpl>()(SourceIt->second));
-        RefCntAutoPtr<MemoryFileStream>   pMemStream(MakeNewRCObj<MemoryFileStream>()(pDataBlob));
+        const auto&                           SrcInfo = SourceIt->second;
+        RefCntAutoPtr<StaticShaderSourceBlob> pDataBlob(MakeNewRCObj<StaticShaderSourceBlob>()(SrcInfo.Source, SrcInfo.Length));
+        RefCntAutoPtr<MemoryFileStream>       pMemStream(MakeNewRCObj<MemoryFileStream>()(pDataBlob));
 
         pMemStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
     }
@@ -0,0 +1,316 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "../include/RenderGraph.hpp"
+
+#include "../include/TransientTexturePool.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+RenderGraph::RenderGraph(IRenderDevice* pDevice, TransientTexturePool* pPool) :
+    m_pDevice{pDevice},
+    m_pPool{pPool}
+{
+    if (m_pPool == nullptr)
+    {
+        m_pOwnPool.reset(new TransientTexturePool{pDevice});
+        m_pPool = m_pOwnPool.get();
+    }
+}
+
+RenderGraph::~RenderGraph()
+{
+    // Return transient textures that are still held to the pool, which may outlive the graph
+    Reset();
+}
+
+RenderGraph::ResourceId RenderGraph::ImportTexture(ITexture* pTexture)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "Texture must not be null");
+
+    auto it = m_ImportedResources.find(pTexture);
+    if (it != m_ImportedResources.end())
+        return it->second;
+
+    const auto Id = static_cast<ResourceId>(m_Resources.size());
+    m_Resources.emplace_back();
+    m_Resources.back().pTexture = pTexture;
+    m_ImportedResources.emplace(pTexture, Id);
+    return Id;
+}
+
+RenderGraph::ResourceId RenderGraph::ImportBuffer(IBuffer* pBuffer)
+{
+    DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
+
+    auto it = m_ImportedResources.find(pBuffer);
+    if (it != m_ImportedResources.end())
+        return it->second;
+
+    const auto Id = static_cast<ResourceId>(m_Resources.size());
+    m_Resources.emplace_back();
+    m_Resources.back().pBuffer = pBuffer;
+    m_ImportedResources.emplace(pBuffer, Id);
+    return Id;
+}
+
+RenderGraph::ResourceId RenderGraph::CreateTexture(const TextureDesc& Desc)
+{
+    const auto Id = static_cast<ResourceId>(m_Resources.size());
+    m_Resources.emplace_back();
+    auto& Res         = m_Resources.back();
+    Res.TransientDesc = Desc;
+    Res.IsTransient   = true;
+    return Id;
+}
+
+void RenderGraph::SetOutput(ResourceId Id, RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(Id < m_Resources.size(), "Invalid resource id");
+    DEV_CHECK_ERR(!m_Resources[Id].IsTransient, "Transient textures can't be graph outputs");
+    auto& Res      = m_Resources[Id];
+    Res.IsOutput   = true;
+    Res.FinalState = FinalState;
+}
+
+ITexture* RenderGraph::GetTexture(ResourceId Id) const
+{
+    DEV_CHECK_ERR(Id < m_Resources.size(), "Invalid resource id");
+    DEV_CHECK_ERR(!m_Resources[Id].IsTransient || m_Resources[Id].pTexture, "Transient texture is only available while the passes that use it are executed");
+    return m_Resources[Id].pTexture;
+}
+
+IBuffer* RenderGraph::GetBuffer(ResourceId Id) const
+{
+    DEV_CHECK_ERR(Id < m_Resources.size(), "Invalid resource id");
+    return m_Resources[Id].pBuffer;
+}
+
+void RenderGraph::PassBuilder::AddUsage(ResourceId Id, RESOURCE_STATE State, bool IsWrite)
+{
+    DEV_CHECK_ERR(Id < m_Graph.m_Resources.size(), "Invalid resource id");
+    DEV_CHECK_ERR(State != RESOURCE_STATE_UNKNOWN, "Resource state must not be unknown");
+
+    for (auto& Usage : m_Pass.Usages)
+    {
+        if (Usage.Id == Id)
+        {
+            // A resource may be read in several states by the same pass (e.g. by pixel and compute shaders),
+            // but it can only be written in one state
+            DEV_CHECK_ERR(!(IsWrite || Usage.IsWrite) || Usage.State == State,
+                          "Resource is used by pass '", m_Pass.Name, "' in conflicting states");
+            Usage.State |= State;
+            Usage.IsRead  = Usage.IsRead || !IsWrite;
+            Usage.IsWrite = Usage.IsWrite || IsWrite;
+            return;
+        }
+    }
+
+    ResourceUsage Usage;
+    Usage.Id      = Id;
+    Usage.State   = State;
+    Usage.IsRead  = !IsWrite;
+    Usage.IsWrite = IsWrite;
+    m_Pass.Usages.emplace_back(Usage);
+}
+
+void RenderGraph::PassBuilder::Read(ResourceId Id, RESOURCE_STATE State)
+{
+    AddUsage(Id, State, false);
+}
+
+void RenderGraph::PassBuilder::Write(ResourceId Id, RESOURCE_STATE State)
+{
+    AddUsage(Id, State, true);
+}
+
+void RenderGraph::AddPass(const char* Name, const SetupCallbackType& Setup, ExecuteCallbackType Execute)
+{
+    m_Passes.emplace_back();
+    auto& NewPass   = m_Passes.back();
+    NewPass.Name    = Name != nullptr ? Name : "";
+    NewPass.Execute = std::move(Execute);
+
+    PassBuilder Builder{*this, NewPass};
+    Setup(Builder);
+}
+
+void RenderGraph::Compile()
+{
+    // Walk the passes backwards and keep those that have side effects or write resources
+    // that are read by the passes kept so far or are graph outputs.
+    std::vector<bool> IsResourceNeeded(m_Resources.size());
+    for (size_t i = 0; i < m_Resources.size(); ++i)
+        IsResourceNeeded[i] = m_Resources[i].IsOutput;
+
+    for (auto pass_it = m_Passes.rbegin(); pass_it != m_Passes.rend(); ++pass_it)
+    {
+        auto& CurrPass    = *pass_it;
+        CurrPass.IsCulled = !CurrPass.HasSideEffects;
+        for (const auto& Usage : CurrPass.Usages)
+        {
+            if (Usage.IsWrite && IsResourceNeeded[Usage.Id])
+                CurrPass.IsCulled = false;
+        }
+
+        if (CurrPass.IsCulled)
+            continue;
+
+        // Writes are not assumed to overwrite the entire resource, so a resource that
+        // is needed stays needed for the previous writers as well
+        for (const auto& Usage : CurrPass.Usages)
+        {
+            if (Usage.IsRead)
+                IsResourceNeeded[Usage.Id] = true;
+        }
+    }
+
+    // Compute lifetimes of transient textures
+    for (auto& Res : m_Resources)
+    {
+        Res.FirstPass = ~0u;
+        Res.LastPass  = 0;
+    }
+    for (Uint32 PassIdx = 0; PassIdx < m_Passes.size(); ++PassIdx)
+    {
+        const auto& CurrPass = m_Passes[PassIdx];
+        if (CurrPass.IsCulled)
+            continue;
+
+        for (const auto& Usage : CurrPass.Usages)
+        {
+            auto& Res = m_Resources[Usage.Id];
+            if (Res.FirstPass == ~0u)
+                Res.FirstPass = PassIdx;
+            Res.LastPass = PassIdx;
+        }
+    }
+}
+
+void RenderGraph::TransitionResources(IDeviceContext* pContext, std::vector<StateTransitionDesc>& Barriers)
+{
+    if (Barriers.empty())
+        return;
+
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+    m_NumTransitions += static_cast<Uint32>(Barriers.size());
+    Barriers.clear();
+}
+
+void RenderGraph::Execute(IDeviceContext* pContext)
+{
+    Compile();
+
+    m_NumExecutedPasses = 0;
+    m_NumTransitions    = 0;
+
+    std::vector<StateTransitionDesc> Barriers;
+    for (Uint32 PassIdx = 0; PassIdx < m_Passes.size(); ++PassIdx)
+    {
+        auto& CurrPass = m_Passes[PassIdx];
+        if (CurrPass.IsCulled)
+            continue;
+
+        // Collect all transitions required by the pass and issue them at once
+        for (const auto& Usage : CurrPass.Usages)
+        {
+            auto& Res = m_Resources[Usage.Id];
+            if (Res.IsTransient && Res.FirstPass == PassIdx)
+            {
+                Res.pTexture = m_pPool->Acquire(Res.TransientDesc);
+            }
+            if (!Res.pTexture && !Res.pBuffer)
+            {
+                LOG_ERROR_MESSAGE("Resource used by pass '", CurrPass.Name, "' is not available");
+                continue;
+            }
+
+            const auto CurrState = Res.pTexture ? Res.pTexture->GetState() : Res.pBuffer->GetState();
+            // Resources whose states are not tracked by the engine are managed by the application
+            if (CurrState == RESOURCE_STATE_UNKNOWN)
+                continue;
+
+            // Read-only states may be combined, so there is no need for a barrier
+            // if the resource is already in all required states
+            if (CurrState == Usage.State || (!Usage.IsWrite && (CurrState & Usage.State) == Usage.State))
+                continue;
+
+            if (Res.pTexture)
+                Barriers.emplace_back(Res.pTexture.RawPtr(), RESOURCE_STATE_UNKNOWN, Usage.State, STATE_TRANSITION_FLAG_UPDATE_STATE);
+            else
+                Barriers.emplace_back(Res.pBuffer.RawPtr(), RESOURCE_STATE_UNKNOWN, Usage.State, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        }
+        TransitionResources(pContext, Barriers);
+
+        if (CurrPass.Execute)
+            CurrPass.Execute(pContext);
+        ++m_NumExecutedPasses;
+
+        for (const auto& Usage : CurrPass.Usages)
+        {
+            auto& Res = m_Resources[Usage.Id];
+            if (Res.IsTransient && Res.LastPass == PassIdx && Res.pTexture)
+            {
+                m_pPool->Release(Res.pTexture);
+                Res.pTexture.Release();
+            }
+        }
+    }
+
+    for (const auto& Res : m_Resources)
+    {
+        if (!Res.IsOutput || Res.FinalState == RESOURCE_STATE_UNKNOWN)
+            continue;
+
+        const auto CurrState = Res.pTexture ? Res.pTexture->GetState() : Res.pBuffer->GetState();
+        if (CurrState == RESOURCE_STATE_UNKNOWN || CurrState == Res.FinalState)
+            continue;
+
+        if (Res.pTexture)
+            Barriers.emplace_back(Res.pTexture.RawPtr(), RESOURCE_STATE_UNKNOWN, Res.FinalState, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        else
+            Barriers.emplace_back(Res.pBuffer.RawPtr(), RESOURCE_STATE_UNKNOWN, Res.FinalState, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    }
+    TransitionResources(pContext, Barriers);
+}
+
+void RenderGraph::Reset()
+{
+    for (auto& Res : m_Resources)
+    {
+        // Return transient textures of passes that were not executed
+        if (Res.IsTransient && Res.pTexture)
+            m_pPool->Release(Res.pTexture);
+    }
+    m_Resources.clear();
+    m_ImportedResources.clear();
+    m_Passes.clear();
+}
+
+} // namespace Diligent
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "../include/TransientTexturePool.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+TransientTexturePool::TransientTexturePool(IRenderDevice* pDevice) :
+    m_pDevice{pDevice}
+{
+}
+
+bool TransientTexturePool::IsCompatible(const TextureDesc& TexDesc, const TextureDesc& RequiredDesc)
+{
+    // Texture names and clear values do not affect compatibility.
+    // A texture may have more bind flags than required.
+    // clang-format off
+    return TexDesc.Type           == RequiredDesc.Type           &&
+           TexDesc.Width          == RequiredDesc.Width          &&
+           TexDesc.Height         == RequiredDesc.Height         &&
+           TexDesc.ArraySize      == RequiredDesc.ArraySize      &&
+           TexDesc.Format         == RequiredDesc.Format         &&
+           TexDesc.MipLevels      == RequiredDesc.MipLevels      &&
+           TexDesc.SampleCount    == RequiredDesc.SampleCount    &&
+           TexDesc.Usage          == RequiredDesc.Usage          &&
+           TexDesc.CPUAccessFlags == RequiredDesc.CPUAccessFlags &&
+           TexDesc.MiscFlags      == RequiredDesc.MiscFlags      &&
+           (TexDesc.BindFlags & RequiredDesc.BindFlags) == RequiredDesc.BindFlags;
+    // clang-format on
+}
+
+RefCntAutoPtr<ITexture> TransientTexturePool::Acquire(const TextureDesc& Desc, ITexture* pPreferred)
+{
+    PooledTexture* pFreeTexture = nullptr;
+    for (auto& Tex : m_Textures)
+    {
+        if (Tex.InUse || !IsCompatible(Tex.pTexture->GetDesc(), Desc))
+            continue;
+
+        if (Tex.pTexture == pPreferred)
+        {
+            pFreeTexture = &Tex;
+            break;
+        }
+
+        if (pFreeTexture == nullptr)
+            pFreeTexture = &Tex;
+    }
+
+    if (pFreeTexture == nullptr)
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+        m_pDevice->CreateTexture(Desc, nullptr, &pTexture);
+        if (!pTexture)
+        {
+            LOG_ERROR_MESSAGE("Failed to create transient texture '", (Desc.Name != nullptr ? Desc.Name : ""), "'");
+            return {};
+        }
+        m_Textures.emplace_back();
+        pFreeTexture           = &m_Textures.back();
+        pFreeTexture->pTexture = std::move(pTexture);
+    }
+
+    pFreeTexture->InUse = true;
+    return pFreeTexture->pTexture;
+}
+
+void TransientTexturePool::Release(ITexture* pTexture)
+{
+    if (pTexture == nullptr)
+        return;
+
+    for (auto& Tex : m_Textures)
+    {
+        if (Tex.pTexture == pTexture)
+        {
+            DEV_CHECK_ERR(Tex.InUse, "Texture '", pTexture->GetDesc().Name, "' has already been released");
+            Tex.InUse = false;
+            return;
+        }
+    }
+    UNEXPECTED("Texture '", pTexture->GetDesc().Name, "' does not belong to this pool");
+}
+
+void TransientTexturePool::Purge()
+{
+    m_Textures.erase(std::remove_if(m_Textures.begin(), m_Textures.end(),
+                                    [](const PooledTexture& Tex) {
+                                        return !Tex.InUse;
+                                    }),
+                     m_Textures.end());
+}
+
+} // namespace Diligent
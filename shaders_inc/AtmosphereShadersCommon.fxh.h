@@ -59,6 +59,10 @@
 "#   define TONE_MAPPING_MODE TONE_MAPPING_MODE_REINHARD_MOD\n"
 "#endif\n"
 "\n"
+"#ifndef USE_TONE_MAPPING_LUT\n"
+"#   define USE_TONE_MAPPING_LUT 0\n"
+"#endif\n"
+"\n"
 "#ifndef LIGHT_ADAPTATION\n"
 "#   define LIGHT_ADAPTATION 1\n"
 "#endif\n"
@@ -79,6 +83,22 @@
 "#   define AUTO_EXPOSURE 1\n"
 "#endif\n"
 "\n"
+"#ifndef COMPACT_RAY_MARCHING_SAMPLES\n"
+"#   define COMPACT_RAY_MARCHING_SAMPLES 0\n"
+"#endif\n"
+"\n"
+"#ifndef RAY_MARCH_THREAD_GROUP_SIZE\n"
+"#   define RAY_MARCH_THREAD_GROUP_SIZE 64\n"
+"#endif\n"
+"\n"
+"#ifndef UNWARP_AND_FIX_INSCATTERING\n"
+"#   define UNWARP_AND_FIX_INSCATTERING 0\n"
+"#endif\n"
+"\n"
+"#ifndef UNWARP_THREAD_GROUP_SIZE\n"
+"#   define UNWARP_THREAD_GROUP_SIZE 8\n"
+"#endif\n"
+"\n"
 "#define INVALID_EPIPOLAR_LINE float4(-1000.0, -1000.0, -100.0, -100.0)\n"
 "\n"
 "#define RGB_TO_LUMINANCE float3(0.212671, 0.715160, 0.072169)\n"
@@ -0,0 +1,39 @@
+"#include \"AutoExposureStructures.fxh\"\n"
+"\n"
+"#ifndef RGB_TO_LUMINANCE\n"
+"#   define RGB_TO_LUMINANCE float3(0.212671, 0.715160, 0.072169)\n"
+"#endif\n"
+"\n"
+"// Histogram group size squared must be equal to the number of bins,\n"
+"// so that every thread of the group handles one bin.\n"
+"#define NUM_HISTOGRAM_BINS    256\n"
+"#define HISTOGRAM_GROUP_SIZE  16\n"
+"\n"
+"cbuffer cbAutoExposureAttribs\n"
+"{\n"
+"    AutoExposureAttribs g_Attribs;\n"
+"\n"
+"    uint  g_SrcWidth;\n"
+"    uint  g_SrcHeight;\n"
+"    float g_ElapsedTime;\n"
+"    uint  g_ResetAdaptation;\n"
+"}\n"
+"\n"
+"// Bin 0 contains pixels darker than the histogram range, the remaining bins\n"
+"// evenly cover the range in log2 space.\n"
+"uint GetHistogramBin(float Luminance)\n"
+"{\n"
+"    float LogLumRange = g_Attribs.fMaxLogLuminance - g_Attribs.fMinLogLuminance;\n"
+"    float LogLum      = log2(max(Luminance, 1e-10));\n"
+"    if (LogLum < g_Attribs.fMinLogLuminance)\n"
+"        return 0u;\n"
+"\n"
+"    float t = saturate((LogLum - g_Attribs.fMinLogLuminance) / LogLumRange);\n"
+"    return 1u + min(uint(t * float(NUM_HISTOGRAM_BINS - 1)), uint(NUM_HISTOGRAM_BINS - 2));\n"
+"}\n"
+"\n"
+"float GetHistogramBinLogLuminance(uint Bin)\n"
+"{\n"
+"    float LogLumRange = g_Attribs.fMaxLogLuminance - g_Attribs.fMinLogLuminance;\n"
+"    return g_Attribs.fMinLogLuminance + (float(Bin) - 0.5) / float(NUM_HISTOGRAM_BINS - 1) * LogLumRange;\n"
+"}\n"
@@ -0,0 +1,70 @@
+"#ifndef _AUTO_EXPOSURE_STRUCTURES_FXH_\n"
+"#define _AUTO_EXPOSURE_STRUCTURES_FXH_\n"
+"\n"
+"#ifdef __cplusplus\n"
+"\n"
+"#   ifndef BOOL\n"
+"#      define BOOL int32_t // Do not use bool, because sizeof(bool)==1 !\n"
+"#   endif\n"
+"\n"
+"#   ifndef TRUE\n"
+"#      define TRUE 1\n"
+"#   endif\n"
+"\n"
+"#   ifndef CHECK_STRUCT_ALIGNMENT\n"
+"        // Note that defining empty macros causes GL shader compilation error on Mac, because\n"
+"        // it does not allow standalone semicolons outside of main.\n"
+"        // On the other hand, adding semicolon at the end of the macro definition causes gcc error.\n"
+"#       define CHECK_STRUCT_ALIGNMENT(s) static_assert( sizeof(s) % 16 == 0, \"sizeof(\" #s \") is not multiple of 16\" )\n"
+"#   endif\n"
+"\n"
+"#   ifndef DEFAULT_VALUE\n"
+"#       define DEFAULT_VALUE(x) =x\n"
+"#   endif\n"
+"\n"
+"#else\n"
+"\n"
+"#   ifndef BOOL\n"
+"#       define BOOL bool\n"
+"#   endif\n"
+"\n"
+"#   ifndef DEFAULT_VALUE\n"
+"#       define DEFAULT_VALUE(x)\n"
+"#   endif\n"
+"\n"
+"#endif\n"
+"\n"
+"\n"
+"struct AutoExposureAttribs\n"
+"{\n"
+"    // Base-2 logarithm of the minimum luminance covered by the histogram.\n"
+"    // Darker pixels are ignored.\n"
+"    float fMinLogLuminance                  DEFAULT_VALUE(-10.f);\n"
+"    // Base-2 logarithm of the maximum luminance covered by the histogram.\n"
+"    // Brighter pixels are counted in the last bin.\n"
+"    float fMaxLogLuminance                  DEFAULT_VALUE(10.f);\n"
+"    // Fraction of the darkest pixels that are excluded from the average.\n"
+"    float fLowPercentile                    DEFAULT_VALUE(0.1f);\n"
+"    // Fraction of the pixels that are not brighter than the brightest pixel included in the average.\n"
+"    float fHighPercentile                   DEFAULT_VALUE(0.95f);\n"
+"\n"
+"    // Minimum average luminance.\n"
+"    float fMinAverageLuminance              DEFAULT_VALUE(0.05f);\n"
+"    // Maximum average luminance.\n"
+"    float fMaxAverageLuminance              DEFAULT_VALUE(64.f);\n"
+"    // Adaptation speed when the scene becomes brighter.\n"
+"    float fSpeedUp                          DEFAULT_VALUE(3.f);\n"
+"    // Adaptation speed when the scene becomes darker.\n"
+"    float fSpeedDown                        DEFAULT_VALUE(1.f);\n"
+"\n"
+"    // Simulate eye adaptation to light changes.\n"
+"    BOOL  bLightAdaptation                  DEFAULT_VALUE(TRUE);\n"
+"    uint  Padding0                          DEFAULT_VALUE(0);\n"
+"    uint  Padding1                          DEFAULT_VALUE(0);\n"
+"    uint  Padding2                          DEFAULT_VALUE(0);\n"
+"};\n"
+"#ifdef CHECK_STRUCT_ALIGNMENT\n"
+"    CHECK_STRUCT_ALIGNMENT(AutoExposureAttribs);\n"
+"#endif\n"
+"\n"
+"#endif // _AUTO_EXPOSURE_STRUCTURES_FXH_\n"
@@ -0,0 +1,140 @@
+"// BuildMinMaxShadowMap.fx\n"
+"// Builds all levels of the 1D min/max binary tree for an epipolar slice in a single compute pass\n"
+"\n"
+"#include \"AtmosphereShadersCommon.fxh\"\n"
+"\n"
+"Texture2D<float4> g_tex2DSliceUVDirAndOrigin;\n"
+"\n"
+"Texture2DArray<float> g_tex2DLightSpaceDepthMap;\n"
+"SamplerState          g_tex2DLightSpaceDepthMap_sampler;\n"
+"\n"
+"cbuffer cbPostProcessingAttribs\n"
+"{\n"
+"    EpipolarLightScatteringAttribs g_PPAttribs;\n"
+"}\n"
+"\n"
+"#if !USE_COMBINED_MIN_MAX_TEXTURE\n"
+"cbuffer cbMiscDynamicParams\n"
+"{\n"
+"    MiscDynamicParams g_MiscParams;\n"
+"}\n"
+"#endif\n"
+"\n"
+"#if IS_32BIT_MIN_MAX_MAP\n"
+"RWTexture2D<float2 /*format = rg32f*/> g_rwtex2DMinMaxLightSpaceDepth;\n"
+"#else\n"
+"RWTexture2D<float2 /*format = rg16*/>  g_rwtex2DMinMaxLightSpaceDepth;\n"
+"#endif\n"
+"\n"
+"#ifndef MIN_MAX_SHADOW_MAP_RESOLUTION\n"
+"#   define MIN_MAX_SHADOW_MAP_RESOLUTION 1024\n"
+"#endif\n"
+"\n"
+"#ifndef THREAD_GROUP_SIZE\n"
+"#   define THREAD_GROUP_SIZE 256\n"
+"#endif\n"
+"\n"
+"// Note that min/max shadow map does not contain finest resolution level\n"
+"// The first level it contains corresponds to step == 2\n"
+"#define NUM_FIRST_LEVEL_SAMPLES (MIN_MAX_SHADOW_MAP_RESOLUTION/2)\n"
+"\n"
+"// Two buffers are used in turn as the source and destination. The first one stores\n"
+"// the first level of the tree (and all even levels after it), the second one stores odd levels\n"
+"groupshared float2 g_f2MinMaxDepth0[NUM_FIRST_LEVEL_SAMPLES];\n"
+"groupshared float2 g_f2MinMaxDepth1[NUM_FIRST_LEVEL_SAMPLES/2];\n"
+"\n"
+"float2 ComputeFirstLevelMinMaxDepth(float4 f4SliceUVDirAndOrigin, float fCascadeInd, uint uiSampleInd)\n"
+"{\n"
+"    // Calculate current sample position on the ray\n"
+"    float2 f2CurrUV = f4SliceUVDirAndOrigin.zw + f4SliceUVDirAndOrigin.xy * float(uiSampleInd) * 2.0;\n"
+"\n"
+"    float4 f4MinDepth = float4(1.0, 1.0, 1.0, 1.0);\n"
+"    float4 f4MaxDepth = float4(0.0, 0.0, 0.0, 0.0);\n"
+"    // Gather 8 depths which will be used for PCF filtering for this sample and its immediate neighbor\n"
+"    // along the epipolar slice (see InitializeMinMaxShadowMapPS())\n"
+"    for( float i=0.0; i<=1.0; ++i )\n"
+"    {\n"
+"        float4 f4Depths = g_tex2DLightSpaceDepthMap.Gather(g_tex2DLightSpaceDepthMap_sampler, float3(f2CurrUV + i * f4SliceUVDirAndOrigin.xy, fCascadeInd) );\n"
+"        f4MinDepth = min(f4MinDepth, f4Depths);\n"
+"        f4MaxDepth = max(f4MaxDepth, f4Depths);\n"
+"    }\n"
+"\n"
+"    f4MinDepth.xy = min(f4MinDepth.xy, f4MinDepth.zw);\n"
+"    f4MinDepth.x = min(f4MinDepth.x, f4MinDepth.y);\n"
+"\n"
+"    f4MaxDepth.xy = max(f4MaxDepth.xy, f4MaxDepth.zw);\n"
+"    f4MaxDepth.x = max(f4MaxDepth.x, f4MaxDepth.y);\n"
+"#if !IS_32BIT_MIN_MAX_MAP\n"
+"    const float R16_UNORM_PRECISION = 1.0 / float(1<<16);\n"
+"    f4MinDepth.x = floor(f4MinDepth.x/R16_UNORM_PRECISION)*R16_UNORM_PRECISION;\n"
+"    f4MaxDepth.x =  ceil(f4MaxDepth.x/R16_UNORM_PRECISION)*R16_UNORM_PRECISION;\n"
+"#endif\n"
+"    return float2(f4MinDepth.x, f4MaxDepth.x);\n"
+"}\n"
+"\n"
+"// Every thread group processes one row of the min/max shadow map. The first level is\n"
+"// computed from the shadow map, every next level is then reduced from the previous one\n"
+"// in group shared memory. The levels are arranged in the texture the same way\n"
+"// as by ComputeMinMaxShadowMapLevelPS()\n"
+"[numthreads(THREAD_GROUP_SIZE, 1, 1)]\n"
+"void BuildMinMaxShadowMapCS(uint3 Gid  : SV_GroupID,\n"
+"                            uint3 GTid : SV_GroupThreadID)\n"
+"{\n"
+"    uint uiRow = Gid.y;\n"
+"    uint uiSliceInd;\n"
+"    float fCascadeInd;\n"
+"#if USE_COMBINED_MIN_MAX_TEXTURE\n"
+"    fCascadeInd = floor(float(uiRow) / float(g_PPAttribs.uiNumEpipolarSlices));\n"
+"    uiSliceInd = uiRow - uint(fCascadeInd) * g_PPAttribs.uiNumEpipolarSlices;\n"
+"    fCascadeInd += g_PPAttribs.fFirstCascadeToRayMarch;\n"
+"#else\n"
+"    uiSliceInd = uiRow;\n"
+"    fCascadeInd = g_MiscParams.fCascadeInd;\n"
+"#endif\n"
+"    // Load slice direction in shadow map\n"
+"    float4 f4SliceUVDirAndOrigin = g_tex2DSliceUVDirAndOrigin.Load( int3(uiSliceInd, int(fCascadeInd), 0) );\n"
+"\n"
+"    for(uint uiSampleInd = GTid.x; uiSampleInd < uint(NUM_FIRST_LEVEL_SAMPLES); uiSampleInd += uint(THREAD_GROUP_SIZE))\n"
+"    {\n"
+"        float2 f2MinMaxDepth = ComputeFirstLevelMinMaxDepth(f4SliceUVDirAndOrigin, fCascadeInd, uiSampleInd);\n"
+"        g_f2MinMaxDepth0[uiSampleInd] = f2MinMaxDepth;\n"
+"        g_rwtex2DMinMaxLightSpaceDepth[int2(uiSampleInd, uiRow)] = f2MinMaxDepth;\n"
+"    }\n"
+"\n"
+"    GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"    uint uiDstXOffset    = uint(NUM_FIRST_LEVEL_SAMPLES);\n"
+"    uint uiNumDstSamples = uint(NUM_FIRST_LEVEL_SAMPLES) / 2u;\n"
+"    bool bSrcIsBuffer0   = true;\n"
+"    // Note that the loop condition is the same for all threads in the group\n"
+"    for(uint uiStep = 4u; uiStep <= uint(g_PPAttribs.fMaxShadowMapStep); uiStep *= 2u)\n"
+"    {\n"
+"        for(uint uiSampleInd = GTid.x; uiSampleInd < uiNumDstSamples; uiSampleInd += uint(THREAD_GROUP_SIZE))\n"
+"        {\n"
+"            float2 f2MinMaxDepth0, f2MinMaxDepth1;\n"
+"            if( bSrcIsBuffer0 )\n"
+"            {\n"
+"                f2MinMaxDepth0 = g_f2MinMaxDepth0[uiSampleInd * 2u];\n"
+"                f2MinMaxDepth1 = g_f2MinMaxDepth0[uiSampleInd * 2u + 1u];\n"
+"            }\n"
+"            else\n"
+"            {\n"
+"                f2MinMaxDepth0 = g_f2MinMaxDepth1[uiSampleInd * 2u];\n"
+"                f2MinMaxDepth1 = g_f2MinMaxDepth1[uiSampleInd * 2u + 1u];\n"
+"            }\n"
+"\n"
+"            float2 f2MinMaxDepth = float2(min(f2MinMaxDepth0.x, f2MinMaxDepth1.x), max(f2MinMaxDepth0.y, f2MinMaxDepth1.y));\n"
+"            if( bSrcIsBuffer0 )\n"
+"                g_f2MinMaxDepth1[uiSampleInd] = f2MinMaxDepth;\n"
+"            else\n"
+"                g_f2MinMaxDepth0[uiSampleInd] = f2MinMaxDepth;\n"
+"            g_rwtex2DMinMaxLightSpaceDepth[int2(uiDstXOffset + uiSampleInd, uiRow)] = f2MinMaxDepth;\n"
+"        }\n"
+"\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"        uiDstXOffset    += uiNumDstSamples;\n"
+"        uiNumDstSamples /= 2u;\n"
+"        bSrcIsBuffer0    = !bSrcIsBuffer0;\n"
+"    }\n"
+"}\n"
@@ -0,0 +1,47 @@
+"// Bakes the tone mapping operator selected by TONE_MAPPING_MODE and color grading\n"
+"// into the 3D look-up table indexed by log2-encoded exposed color.\n"
+"\n"
+"#include \"ToneMapping.fxh\"\n"
+"\n"
+"#ifndef THREAD_GROUP_SIZE\n"
+"#   define THREAD_GROUP_SIZE 4\n"
+"#endif\n"
+"\n"
+"cbuffer cbToneMappingLUTAttribs\n"
+"{\n"
+"    ToneMappingAttribs g_ToneMapping;\n"
+"\n"
+"    // rgb - color filter\n"
+"    float4 g_ColorFilter;\n"
+"\n"
+"    // x - saturation, y - contrast\n"
+"    float4 g_GradingParams;\n"
+"}\n"
+"\n"
+"RWTexture3D<float4> g_rwtex3DToneMappingLUT;\n"
+"\n"
+"[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, THREAD_GROUP_SIZE)]\n"
+"void main(uint3 ThreadId : SV_DispatchThreadID)\n"
+"{\n"
+"    if (ThreadId.x >= uint(TONE_MAPPING_LUT_DIM) || ThreadId.y >= uint(TONE_MAPPING_LUT_DIM) || ThreadId.z >= uint(TONE_MAPPING_LUT_DIM))\n"
+"        return;\n"
+"\n"
+"    // The exposure is applied before the look-up, so the average luminance\n"
+"    // is set to the middle gray to make the luminance scale equal to 1.\n"
+"    float3 f3ExposedColor = ToneMappingLUTTexelToExposedColor(ThreadId);\n"
+"    float3 f3Color = ToneMap(f3ExposedColor, g_ToneMapping, g_ToneMapping.fMiddleGray);\n"
+"\n"
+"    f3Color *= g_ColorFilter.rgb;\n"
+"\n"
+"    float fLuminance = dot(f3Color, RGB_TO_LUMINANCE);\n"
+"    f3Color = max(lerp(float3(fLuminance, fLuminance, fLuminance), f3Color, g_GradingParams.x), float3(0.0, 0.0, 0.0));\n"
+"\n"
+"    // Contrast is applied around the middle gray\n"
+"    if (g_GradingParams.y != 1.0)\n"
+"    {\n"
+"        float fMiddleGray = 0.18;\n"
+"        f3Color = fMiddleGray * pow(f3Color / fMiddleGray, g_GradingParams.yyy);\n"
+"    }\n"
+"\n"
+"    g_rwtex3DToneMappingLUT[ThreadId] = float4(f3Color, 1.0);\n"
+"}\n"
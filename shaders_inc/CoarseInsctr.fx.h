@@ -42,9 +42,24 @@
 "Texture3D<float3> g_tex3DMultipleSctrLUT;\n"
 "SamplerState      g_tex3DMultipleSctrLUT_sampler;\n"
 "\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"Texture2D<float3> g_tex2DSkyViewInsctr;\n"
+"SamplerState      g_tex2DSkyViewInsctr_sampler;\n"
+"\n"
+"Texture2D<float3> g_tex2DSkyViewExtinction;\n"
+"SamplerState      g_tex2DSkyViewExtinction_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveInsctr;\n"
+"SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveExtinction;\n"
+"SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;\n"
+"#endif\n"
+"\n"
 "#include \"LookUpTables.fxh\"\n"
 "#include \"ScatteringIntegrals.fxh\"\n"
 "#include \"Extinction.fxh\"\n"
+"#include \"SkyViewAndAerialPerspective.fxh\"\n"
 "#include \"UnshadowedScattering.fxh\"\n"
 "\n"
 "void ShaderFunctionInternal(in float4  f4Pos,\n"
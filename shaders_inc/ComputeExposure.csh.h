@@ -0,0 +1,72 @@
+"// Computes the average scene luminance from the histogram built by ComputeLuminanceHistogram.csh.\n"
+"// The darkest and the brightest pixels are excluded by percentile clipping, and the result is\n"
+"// blended with the previous value to simulate eye adaptation. The whole computation is performed\n"
+"// by a single thread group that also clears the histogram for the next frame.\n"
+"\n"
+"#include \"AutoExposureCommon.fxh\"\n"
+"\n"
+"RWStructuredBuffer<uint> g_rwHistogram;\n"
+"RWTexture2D<float>       g_rwtex2DAverageLuminance;\n"
+"\n"
+"groupshared float  g_PrefixSum[NUM_HISTOGRAM_BINS];\n"
+"groupshared float2 g_WeightedLogLum[NUM_HISTOGRAM_BINS];\n"
+"\n"
+"[numthreads(NUM_HISTOGRAM_BINS, 1, 1)]\n"
+"void main(uint Bin : SV_GroupIndex)\n"
+"{\n"
+"    float Count = float(g_rwHistogram[Bin]);\n"
+"    g_rwHistogram[Bin] = 0u;\n"
+"\n"
+"    g_PrefixSum[Bin] = Count;\n"
+"    GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"    // Inclusive prefix sum of the bin counts\n"
+"    for (uint Offset = 1u; Offset < uint(NUM_HISTOGRAM_BINS); Offset *= 2u)\n"
+"    {\n"
+"        float Sum = g_PrefixSum[Bin];\n"
+"        if (Bin >= Offset)\n"
+"            Sum += g_PrefixSum[Bin - Offset];\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"        g_PrefixSum[Bin] = Sum;\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"    }\n"
+"\n"
+"    // Pixels darker than the histogram range are not counted\n"
+"    float NumDarkPixels = g_PrefixSum[0];\n"
+"    float NumPixels     = g_PrefixSum[NUM_HISTOGRAM_BINS - 1] - NumDarkPixels;\n"
+"    float LowBound      = NumPixels * g_Attribs.fLowPercentile;\n"
+"    float HighBound     = NumPixels * g_Attribs.fHighPercentile;\n"
+"\n"
+"    // Only the part of the bin that lies between the percentiles contributes to the average\n"
+"    float BinEnd   = g_PrefixSum[Bin] - NumDarkPixels;\n"
+"    float BinStart = BinEnd - Count;\n"
+"    float Weight   = Bin > 0u ? max(min(BinEnd, HighBound) - max(BinStart, LowBound), 0.0) : 0.0;\n"
+"    g_WeightedLogLum[Bin] = float2(Weight * GetHistogramBinLogLuminance(Bin), Weight);\n"
+"    GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"    for (uint Stride = uint(NUM_HISTOGRAM_BINS) / 2u; Stride > 0u; Stride /= 2u)\n"
+"    {\n"
+"        if (Bin < Stride)\n"
+"            g_WeightedLogLum[Bin] += g_WeightedLogLum[Bin + Stride];\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"    }\n"
+"\n"
+"    if (Bin == 0u)\n"
+"    {\n"
+"        float2 LogLum_W = g_WeightedLogLum[0];\n"
+"        // If all pixels are darker than the histogram range, adapt to the minimum luminance\n"
+"        float TargetLuminance = LogLum_W.y > 0.0 ? exp2(LogLum_W.x / LogLum_W.y) : g_Attribs.fMinAverageLuminance;\n"
+"        TargetLuminance = clamp(TargetLuminance, g_Attribs.fMinAverageLuminance, g_Attribs.fMaxAverageLuminance);\n"
+"\n"
+"        float AverageLuminance = TargetLuminance;\n"
+"        if (g_Attribs.bLightAdaptation && g_ResetAdaptation == 0u)\n"
+"        {\n"
+"            float PrevLuminance  = max(g_rwtex2DAverageLuminance[int2(0, 0)], 1e-5);\n"
+"            float Speed          = TargetLuminance > PrevLuminance ? g_Attribs.fSpeedUp : g_Attribs.fSpeedDown;\n"
+"            float NewLumWeight   = 1.0 - exp(-Speed * g_ElapsedTime);\n"
+"            AverageLuminance     = exp2(lerp(log2(PrevLuminance), log2(TargetLuminance), NewLumWeight));\n"
+"        }\n"
+"\n"
+"        g_rwtex2DAverageLuminance[int2(0, 0)] = AverageLuminance;\n"
+"    }\n"
+"}\n"
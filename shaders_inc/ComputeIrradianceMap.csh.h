@@ -0,0 +1,39 @@
+"// Generates faces of one mip level of the irradiance cube, starting from g_FirstFace\n"
+"\n"
+"TextureCube  g_EnvironmentMap;\n"
+"SamplerState g_EnvironmentMap_sampler;\n"
+"\n"
+"RWTexture2DArray<float4 /*format = rgba32f*/> g_rwtex2DIrradianceCube;\n"
+"\n"
+"#include \"GLTF_PBR_EnvMapFiltering.fxh\"\n"
+"\n"
+"#ifndef THREAD_GROUP_SIZE\n"
+"#   define THREAD_GROUP_SIZE 8\n"
+"#endif\n"
+"\n"
+"cbuffer cbCubemapFaceAttribs\n"
+"{\n"
+"    float4x4 g_FaceRotation[6];\n"
+"\n"
+"    float    g_Roughness;\n"
+"    float    g_EnvMapDim;\n"
+"    uint     g_NumSamples;\n"
+"    uint     g_MipDim;\n"
+"\n"
+"    uint     g_FirstFace;\n"
+"    uint     g_Padding0;\n"
+"    uint     g_Padding1;\n"
+"    uint     g_Padding2;\n"
+"}\n"
+"\n"
+"[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]\n"
+"void main(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    if (DTid.x >= g_MipDim || DTid.y >= g_MipDim)\n"
+"        return;\n"
+"\n"
+"    uint3 Texel = uint3(DTid.xy, DTid.z + g_FirstFace);\n"
+"\n"
+"    float3 N = normalize(GetCubemapFaceDirection(Texel, g_MipDim, g_FaceRotation[Texel.z]));\n"
+"    g_rwtex2DIrradianceCube[Texel] = float4(ComputeIrradiance(N), 1.0);\n"
+"}\n"
@@ -0,0 +1,101 @@
+"// Projects the environment map onto 9 spherical harmonics coefficients that encode the diffuse irradiance.\n"
+"// The whole reduction is performed by a single thread group.\n"
+"\n"
+"TextureCube  g_EnvironmentMap;\n"
+"SamplerState g_EnvironmentMap_sampler;\n"
+"\n"
+"RWStructuredBuffer<float4> g_rwIrradianceSH;\n"
+"\n"
+"#include \"GLTF_PBR_EnvMapFiltering.fxh\"\n"
+"\n"
+"#ifndef THREAD_GROUP_SIZE\n"
+"#   define THREAD_GROUP_SIZE 256\n"
+"#endif\n"
+"\n"
+"// The environment map is sampled at this face resolution regardless of its size\n"
+"#ifndef SH_SAMPLE_DIM\n"
+"#   define SH_SAMPLE_DIM 64\n"
+"#endif\n"
+"\n"
+"cbuffer cbCubemapFaceAttribs\n"
+"{\n"
+"    float4x4 g_FaceRotation[6];\n"
+"\n"
+"    float    g_Roughness;\n"
+"    float    g_EnvMapDim;\n"
+"    uint     g_NumSamples;\n"
+"    uint     g_MipDim;\n"
+"\n"
+"    uint     g_FirstFace;\n"
+"    uint     g_Padding0;\n"
+"    uint     g_Padding1;\n"
+"    uint     g_Padding2;\n"
+"}\n"
+"\n"
+"// Real spherical harmonics basis constants. The polynomial parts of the basis functions\n"
+"// are evaluated in main() and in GLTF_PBR_EvaluateIrradianceSH().\n"
+"static const float g_SHBasis[9] =\n"
+"{\n"
+"    0.282095,\n"
+"    0.488603, 0.488603, 0.488603,\n"
+"    1.092548, 1.092548, 0.315392, 1.092548, 0.546274\n"
+"};\n"
+"\n"
+"// Clamped cosine lobe convolution weights (pi, 2pi/3, pi/4) divided by pi, so that the evaluated\n"
+"// irradiance is scaled the same way as ComputeIrradiance() output.\n"
+"static const float g_SHConvolution[9] =\n"
+"{\n"
+"    1.0,\n"
+"    2.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0,\n"
+"    0.25, 0.25, 0.25, 0.25, 0.25\n"
+"};\n"
+"\n"
+"groupshared float3 g_PartialSums[THREAD_GROUP_SIZE];\n"
+"\n"
+"[numthreads(THREAD_GROUP_SIZE, 1, 1)]\n"
+"void main(uint3 GTid : SV_GroupThreadID)\n"
+"{\n"
+"    float3 SH[9];\n"
+"    for (int k = 0; k < 9; ++k)\n"
+"        SH[k] = float3(0.0, 0.0, 0.0);\n"
+"\n"
+"    float Lod = max(log2(g_EnvMapDim / float(SH_SAMPLE_DIM)), 0.0);\n"
+"    for (uint i = GTid.x; i < 6u * SH_SAMPLE_DIM * SH_SAMPLE_DIM; i += THREAD_GROUP_SIZE)\n"
+"    {\n"
+"        uint3  Texel = uint3(i % SH_SAMPLE_DIM, (i / SH_SAMPLE_DIM) % SH_SAMPLE_DIM, i / (SH_SAMPLE_DIM * SH_SAMPLE_DIM));\n"
+"        float3 Dir   = GetCubemapFaceDirection(Texel, SH_SAMPLE_DIM, g_FaceRotation[Texel.z]);\n"
+"        // The face is at unit distance, so the texel solid angle is its area divided by the cubed distance\n"
+"        float  LenSq      = dot(Dir, Dir);\n"
+"        float  SolidAngle = 4.0 / (float(SH_SAMPLE_DIM * SH_SAMPLE_DIM) * LenSq * sqrt(LenSq));\n"
+"        Dir /= sqrt(LenSq);\n"
+"\n"
+"        float3 L = g_EnvironmentMap.SampleLevel(g_EnvironmentMap_sampler, Dir, Lod).rgb * SolidAngle;\n"
+"        SH[0] += L;\n"
+"        SH[1] += L * Dir.y;\n"
+"        SH[2] += L * Dir.z;\n"
+"        SH[3] += L * Dir.x;\n"
+"        SH[4] += L * (Dir.x * Dir.y);\n"
+"        SH[5] += L * (Dir.y * Dir.z);\n"
+"        SH[6] += L * (3.0 * Dir.z * Dir.z - 1.0);\n"
+"        SH[7] += L * (Dir.x * Dir.z);\n"
+"        SH[8] += L * (Dir.x * Dir.x - Dir.y * Dir.y);\n"
+"    }\n"
+"\n"
+"    for (int c = 0; c < 9; ++c)\n"
+"    {\n"
+"        g_PartialSums[GTid.x] = SH[c];\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"        for (uint s = THREAD_GROUP_SIZE / 2u; s > 0u; s >>= 1u)\n"
+"        {\n"
+"            if (GTid.x < s)\n"
+"                g_PartialSums[GTid.x] += g_PartialSums[GTid.x + s];\n"
+"            GroupMemoryBarrierWithGroupSync();\n"
+"        }\n"
+"        if (GTid.x == 0u)\n"
+"        {\n"
+"            // The basis constant is applied twice: once when projecting and once when evaluating\n"
+"            g_rwIrradianceSH[c] = float4(g_PartialSums[0] * (g_SHBasis[c] * g_SHBasis[c] * g_SHConvolution[c]), 0.0);\n"
+"        }\n"
+"        GroupMemoryBarrierWithGroupSync();\n"
+"    }\n"
+"}\n"
@@ -0,0 +1,29 @@
+"// Builds the luminance histogram of the source color buffer.\n"
+"// Every thread group accumulates a local histogram in shared memory and then\n"
+"// merges it into the global histogram, which keeps the number of global atomics low.\n"
+"\n"
+"#include \"AutoExposureCommon.fxh\"\n"
+"\n"
+"Texture2D<float4>        g_tex2DColor;\n"
+"RWStructuredBuffer<uint> g_rwHistogram;\n"
+"\n"
+"groupshared uint g_LocalHistogram[NUM_HISTOGRAM_BINS];\n"
+"\n"
+"[numthreads(HISTOGRAM_GROUP_SIZE, HISTOGRAM_GROUP_SIZE, 1)]\n"
+"void main(uint3 ThreadId   : SV_DispatchThreadID,\n"
+"          uint  GroupIndex : SV_GroupIndex)\n"
+"{\n"
+"    g_LocalHistogram[GroupIndex] = 0u;\n"
+"    GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"    if (ThreadId.x < g_SrcWidth && ThreadId.y < g_SrcHeight)\n"
+"    {\n"
+"        float3 f3Color = g_tex2DColor.Load(int3(ThreadId.xy, 0)).rgb;\n"
+"        InterlockedAdd(g_LocalHistogram[GetHistogramBin(dot(f3Color, RGB_TO_LUMINANCE))], 1u);\n"
+"    }\n"
+"    GroupMemoryBarrierWithGroupSync();\n"
+"\n"
+"    uint Count = g_LocalHistogram[GroupIndex];\n"
+"    if (Count > 0u)\n"
+"        InterlockedAdd(g_rwHistogram[GroupIndex], Count);\n"
+"}\n"
@@ -0,0 +1,17 @@
+"// ComputeRayMarchingDispatchArgs.fx\n"
+"// Computes indirect dispatch arguments to ray march samples from the compacted list\n"
+"\n"
+"#include \"AtmosphereShadersCommon.fxh\"\n"
+"\n"
+"StructuredBuffer<uint> g_RayMarchingSampleCounter;\n"
+"\n"
+"RWBuffer<uint /*format = r32ui*/> g_rwRayMarchingDispatchArgs;\n"
+"\n"
+"[numthreads(1, 1, 1)]\n"
+"void ComputeRayMarchingDispatchArgsCS()\n"
+"{\n"
+"    uint uiNumSamples = g_RayMarchingSampleCounter[0];\n"
+"    g_rwRayMarchingDispatchArgs[0] = (uiNumSamples + uint(RAY_MARCH_THREAD_GROUP_SIZE) - 1u) / uint(RAY_MARCH_THREAD_GROUP_SIZE);\n"
+"    g_rwRayMarchingDispatchArgs[1] = 1u;\n"
+"    g_rwRayMarchingDispatchArgs[2] = 1u;\n"
+"}\n"
@@ -43,6 +43,8 @@
 "#define LIGHT_SCTR_TECHNIQUE_EPIPOLAR_SAMPLING  0\n"
 "// High-quality brute-force ray marching for every pixel without any optimizations\n"
 "#define LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE        1\n"
+"// Volumetric scattering evaluated in a camera-aligned froxel grid and integrated front to back\n"
+"#define LIGHT_SCTR_TECHNIQUE_FROXEL             2\n"
 "\n"
 "\n"
 "// Shadow map cascade processing mode\n"
@@ -185,6 +187,46 @@
 "    // Aerosol absorption scale to use for scattering coefficient computation.\n"
 "    float fAerosolAbsorbtionScale           DEFAULT_VALUE(0.1f);\n"
 "\n"
+"    // Brute-force ray marching resolution downscale factor (1, 2 or 4). When greater than 1,\n"
+"    // inscattering is ray marched into a reduced-resolution target and upsampled with a bilateral\n"
+"    // filter guided by camera space z. Pixels rejected by the filter are ray marched at full resolution.\n"
+"    // Only has effect when iLightSctrTechnique is LIGHT_SCTR_TECHNIQUE_BRUTE_FORCE.\n"
+"    uint  uiBruteForceDownscaleFactor       DEFAULT_VALUE(1);\n"
+"    // Relative camera space z difference at which the upsampling filter starts rejecting\n"
+"    // reduced-resolution samples.\n"
+"    float fBruteForceUpsampleDepthThreshold DEFAULT_VALUE(0.03f);\n"
+"    // Whether to append ray marching samples selected by the refinement pass to a compacted list\n"
+"    // and ray march them with an indirect compute dispatch instead of marking them in the stencil.\n"
+"    // Only has effect with epipolar sampling when the device supports indirect rendering and\n"
+"    // cascades are processed in a single pass (or light shafts are disabled).\n"
+"    BOOL  bCompactRayMarchingSamples        DEFAULT_VALUE(FALSE);\n"
+"    // Whether to store epipolar coordinates, slice end points and slice directions in the shadow map\n"
+"    // in 16-bit formats. This reduces memory bandwidth at the cost of a small loss of precision.\n"
+"    BOOL  bUseLowPrecisionIntermediates     DEFAULT_VALUE(FALSE);\n"
+"\n"
+"    // Froxel grid resolution. Slices are distributed exponentially between the camera\n"
+"    // near plane and the far boundary of the last shadow cascade.\n"
+"    // Only has effect when iLightSctrTechnique is LIGHT_SCTR_TECHNIQUE_FROXEL.\n"
+"    uint  uiFroxelGridWidth                 DEFAULT_VALUE(160);\n"
+"    uint  uiFroxelGridHeight                DEFAULT_VALUE(90);\n"
+"    uint  uiFroxelGridDepth                 DEFAULT_VALUE(64);\n"
+"    // Weight of the scattering reprojected from the previous frame, in [0, 1).\n"
+"    // 0 disables temporal reprojection.\n"
+"    float fFroxelTemporalBlendFactor        DEFAULT_VALUE(0.9f);\n"
+"\n"
+"    // Whether to precompute unshadowed inscattering for the current camera position into a\n"
+"    // sky-view table and a camera-aligned aerial perspective volume once per frame and look it up\n"
+"    // instead of evaluating it per sample. Only unshadowed scattering (when light shafts are disabled),\n"
+"    // coarse inscattering and background extinction use the tables.\n"
+"    // Requires compute shaders. Has no effect when iLightSctrTechnique is LIGHT_SCTR_TECHNIQUE_FROXEL.\n"
+"    BOOL  bUseSkyViewAndAerialPerspectiveLUTs DEFAULT_VALUE(FALSE);\n"
+"    // Camera space z of the last aerial perspective slice. Surfaces farther than this\n"
+"    // distance fall back to per-sample evaluation.\n"
+"    float fAerialPerspectiveLUTMaxDist      DEFAULT_VALUE(32000.f);\n"
+"    // Screen-space resolution and number of depth slices of the aerial perspective volume.\n"
+"    uint  uiAerialPerspectiveLUTResolution  DEFAULT_VALUE(32);\n"
+"    uint  uiAerialPerspectiveLUTDepth       DEFAULT_VALUE(32);\n"
+"\n"
 "    // Custom Rayleigh coefficients.\n"
 "    float4 f4CustomRlghBeta                 DEFAULT_VALUE(float4(5.8e-6f, 13.5e-6f, 33.1e-6f, 0.f));\n"
 "    // Custom Mie coefficients.\n"
@@ -272,4 +314,21 @@
 "    CHECK_STRUCT_ALIGNMENT(MiscDynamicParams);\n"
 "#endif\n"
 "\n"
+"// Internal structure used by the froxel technique\n"
+"struct FroxelGridAttribs\n"
+"{\n"
+"#ifdef __cplusplus\n"
+"    float4x4 mPrevViewProjT;\n"
+"#else\n"
+"    matrix mPrevViewProj;\n"
+"#endif\n"
+"    float4 f4GridDim;             // Width, Height, Depth, unused\n"
+"    float4 f4GridDepthParams;     // Near z, Far z, ln(Far/Near), slice depth jitter\n"
+"    float4 f4PrevGridDepthParams; // Grid depth parameters of the previous frame\n"
+"    float4 f4PrevCameraPos;       // xyz - previous camera position, w - history weight (0 if history is invalid)\n"
+"};\n"
+"#ifdef CHECK_STRUCT_ALIGNMENT\n"
+"    CHECK_STRUCT_ALIGNMENT(FroxelGridAttribs);\n"
+"#endif\n"
+"\n"
 "#endif //_EPIPOLAR_LIGHT_SCATTERING_STRCUTURES_FXH_\n"
@@ -0,0 +1,464 @@
+"// FroxelInscattering.fx\n"
+"// Evaluates inscattering in a camera-aligned froxel grid, integrates it front to back\n"
+"// and combines the result with the back buffer\n"
+"\n"
+"#include \"BasicStructures.fxh\"\n"
+"#include \"AtmosphereShadersCommon.fxh\"\n"
+"\n"
+"cbuffer cbParticipatingMediaScatteringParams\n"
+"{\n"
+"    AirScatteringAttribs g_MediaParams;\n"
+"}\n"
+"\n"
+"cbuffer cbCameraAttribs\n"
+"{\n"
+"    CameraAttribs g_CameraAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbLightParams\n"
+"{\n"
+"    LightAttribs g_LightAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbPostProcessingAttribs\n"
+"{\n"
+"    EpipolarLightScatteringAttribs g_PPAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbFroxelGridAttribs\n"
+"{\n"
+"    FroxelGridAttribs g_FroxelAttribs;\n"
+"}\n"
+"\n"
+"#ifndef FROXEL_THREAD_GROUP_SIZE\n"
+"#   define FROXEL_THREAD_GROUP_SIZE 8\n"
+"#endif\n"
+"\n"
+"Texture2D<float2> g_tex2DOccludedNetDensityToAtmTop;\n"
+"SamplerState      g_tex2DOccludedNetDensityToAtmTop_sampler;\n"
+"\n"
+"#if ENABLE_LIGHT_SHAFTS\n"
+"Texture2DArray<float>  g_tex2DLightSpaceDepthMap;\n"
+"SamplerComparisonState g_tex2DLightSpaceDepthMap_sampler;\n"
+"#endif\n"
+"\n"
+"Texture3D<float3> g_tex3DSingleSctrLUT;\n"
+"SamplerState      g_tex3DSingleSctrLUT_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DHighOrderSctrLUT;\n"
+"SamplerState      g_tex3DHighOrderSctrLUT_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DMultipleSctrLUT;\n"
+"SamplerState      g_tex3DMultipleSctrLUT_sampler;\n"
+"\n"
+"Texture2D<float>  g_tex2DCamSpaceZ;\n"
+"\n"
+"Texture2D<float4> g_tex2DColorBuffer;\n"
+"\n"
+"Texture2D<float>  g_tex2DAverageLuminance;\n"
+"\n"
+"#if USE_TONE_MAPPING_LUT\n"
+"Texture3D<float4> g_tex3DToneMappingLUT;\n"
+"SamplerState      g_tex3DToneMappingLUT_sampler;\n"
+"#endif\n"
+"\n"
+"#include \"LookUpTables.fxh\"\n"
+"#include \"ScatteringIntegrals.fxh\"\n"
+"#include \"Extinction.fxh\"\n"
+"#include \"ToneMapping.fxh\"\n"
+"\n"
+"// Slices of the grid are distributed exponentially between the near and far\n"
+"// boundaries, so that every slice covers the same range of log depth:\n"
+"//\n"
+"//      z(s) = Near * (Far/Near)^(s/Depth)\n"
+"//\n"
+"// f4DepthParams == (Near, Far, ln(Far/Near), *)\n"
+"float FroxelSliceToCamSpaceZ(float fSlice, float4 f4DepthParams)\n"
+"{\n"
+"    return f4DepthParams.x * exp(fSlice / g_FroxelAttribs.f4GridDim.z * f4DepthParams.z);\n"
+"}\n"
+"\n"
+"float CamSpaceZToFroxelSlice(float fCamSpaceZ, float4 f4DepthParams)\n"
+"{\n"
+"    return log(max(fCamSpaceZ, f4DepthParams.x) / f4DepthParams.x) / f4DepthParams.z * g_FroxelAttribs.f4GridDim.z;\n"
+"}\n"
+"\n"
+"float2 GetFroxelColumnNormalizedDeviceXY(uint2 ui2Column)\n"
+"{\n"
+"    return TexUVToNormalizedDeviceXY( (float2(ui2Column) + float2(0.5, 0.5)) / g_FroxelAttribs.f4GridDim.xy );\n"
+"}\n"
+"\n"
+"\n"
+"#if ENABLE_LIGHT_SHAFTS\n"
+"float GetFroxelLightVisibility(float3 f3PosWS, float fCamSpaceZ)\n"
+"{\n"
+"    // Use the finest cascade that contains the point\n"
+"    for (int iCascade = 0; iCascade < g_PPAttribs.iNumCascades; ++iCascade)\n"
+"    {\n"
+"        if (fCamSpaceZ < g_LightAttribs.ShadowAttribs.Cascades[iCascade].f4StartEndZ.y)\n"
+"        {\n"
+"            float3 f3ShadowMapUVDepth = WorldSpaceToShadowMapUV(f3PosWS, g_LightAttribs.ShadowAttribs.mWorldToShadowMapUVDepth[iCascade]);\n"
+"            // Clamp depth to a very small positive value to avoid z-fighting at camera location\n"
+"            float fDepthInLightSpace = max(f3ShadowMapUVDepth.z, 1e-7);\n"
+"            #ifdef GLSL\n"
+"                // There is no OpenGL counterpart for Texture2DArray.SampleCmpLevelZero()\n"
+"                return g_tex2DLightSpaceDepthMap.SampleCmp( g_tex2DLightSpaceDepthMap_sampler, float3(f3ShadowMapUVDepth.xy, float(iCascade)), fDepthInLightSpace );\n"
+"            #else\n"
+"                // We cannot use SampleCmp() under flow control in HLSL\n"
+"                return g_tex2DLightSpaceDepthMap.SampleCmpLevelZero( g_tex2DLightSpaceDepthMap_sampler, float3(f3ShadowMapUVDepth.xy, float(iCascade)), fDepthInLightSpace );\n"
+"            #endif\n"
+"        }\n"
+"    }\n"
+"    return 1.0;\n"
+"}\n"
+"#endif\n"
+"\n"
+"// Computes single scattering per unit length in the given point. Note that extinction\n"
+"// between the point and the camera is not applied\n"
+"float3 ComputeFroxelInscattering(float3 f3PosWS, float3 f3ViewDir, float fCamSpaceZ)\n"
+"{\n"
+"    float3 f3Inscattering = float3(0.0, 0.0, 0.0);\n"
+"#if SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE\n"
+"    float3 f3EarthCentreToPointDir = f3PosWS - g_PPAttribs.f4EarthCenter.xyz;\n"
+"    float fDistToEarthCentre = length(f3EarthCentreToPointDir);\n"
+"    f3EarthCentreToPointDir /= fDistToEarthCentre;\n"
+"    float fHeightAboveSurface = fDistToEarthCentre - g_MediaParams.fEarthRadius;\n"
+"\n"
+"    // Points below the Earth surface and outside of the atmosphere do not scatter light\n"
+"    if (fDistToEarthCentre < g_MediaParams.fAtmBottomRadius || fDistToEarthCentre > g_MediaParams.fAtmTopRadius)\n"
+"        return f3Inscattering;\n"
+"\n"
+"    float2 f2ParticleDensity = exp( -float2(fHeightAboveSurface, fHeightAboveSurface) * g_MediaParams.f4ParticleScaleHeight.zw );\n"
+"\n"
+"    // Get net particle density from the point to the top of the atmosphere and compute\n"
+"    // extinction of the light on its way to the point\n"
+"    float fCosSunZenithAngle = dot( f3EarthCentreToPointDir, -g_LightAttribs.f4Direction.xyz );\n"
+"    float2 f2NetParticleDensityToAtmTop = GetNetParticleDensity(fHeightAboveSurface, fCosSunZenithAngle, g_MediaParams.fAtmBottomAltitude, g_MediaParams.fAtmAltitudeRangeInv);\n"
+"    float3 f3RlghOpticalDepth = g_MediaParams.f4RayleighExtinctionCoeff.rgb * f2NetParticleDensityToAtmTop.x;\n"
+"    float3 f3MieOpticalDepth  = g_MediaParams.f4MieExtinctionCoeff.rgb      * f2NetParticleDensityToAtmTop.y;\n"
+"    float3 f3LightExtinction  = exp( -(f3RlghOpticalDepth + f3MieOpticalDepth) );\n"
+"\n"
+"    float3 f3RayleighInscattering = f2ParticleDensity.x * f3LightExtinction;\n"
+"    float3 f3MieInscattering      = f2ParticleDensity.y * f3LightExtinction;\n"
+"    // Note that cosTheta = dot(DirOnCamera, LightDir) = dot(ViewDir, DirOnLight) because\n"
+"    // DirOnCamera = -ViewDir and LightDir = -DirOnLight\n"
+"    ApplyPhaseFunctions(f3RayleighInscattering, f3MieInscattering, dot(f3ViewDir, -g_LightAttribs.f4Direction.xyz));\n"
+"    f3Inscattering = f3RayleighInscattering + f3MieInscattering;\n"
+"\n"
+"#   if ENABLE_LIGHT_SHAFTS\n"
+"    f3Inscattering *= GetFroxelLightVisibility(f3PosWS, fCamSpaceZ);\n"
+"#   endif\n"
+"#endif\n"
+"    return f3Inscattering;\n"
+"}\n"
+"\n"
+"\n"
+"RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DFroxelInsctr;\n"
+"\n"
+"Texture3D<float4> g_tex3DFroxelInsctrHistory;\n"
+"SamplerState      g_tex3DFroxelInsctrHistory_sampler; // Linear clamp\n"
+"\n"
+"// Evaluates scattering at a jittered location within every froxel and blends it with the\n"
+"// reprojected result of the previous frame.\n"
+"// To keep the values in half float range, the grid stores scattering per unit length\n"
+"// multiplied by the distance to the camera. Since the slices are exponentially distributed,\n"
+"// this is proportional to the scattering integrated over the slice.\n"
+"[numthreads(FROXEL_THREAD_GROUP_SIZE, FROXEL_THREAD_GROUP_SIZE, 1)]\n"
+"void InjectFroxelInscatteringCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    float3 f3GridDim = g_FroxelAttribs.f4GridDim.xyz;\n"
+"    if( float(DTid.x) >= f3GridDim.x || float(DTid.y) >= f3GridDim.y )\n"
+"        return;\n"
+"\n"
+"    float2 f2PosPS = GetFroxelColumnNormalizedDeviceXY(DTid.xy);\n"
+"    float fCamSpaceZ = FroxelSliceToCamSpaceZ(float(DTid.z) + g_FroxelAttribs.f4GridDepthParams.w, g_FroxelAttribs.f4GridDepthParams);\n"
+"    float3 f3PosWS = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"\n"
+"    float3 f3ViewDir = f3PosWS - g_CameraAttribs.f4Position.xyz;\n"
+"    float fDistToCamera = length(f3ViewDir);\n"
+"    f3ViewDir /= fDistToCamera;\n"
+"\n"
+"    float4 f4Inscattering = float4(ComputeFroxelInscattering(f3PosWS, f3ViewDir, fCamSpaceZ) * fDistToCamera, 1.0);\n"
+"\n"
+"    float fHistoryWeight = g_FroxelAttribs.f4PrevCameraPos.w;\n"
+"    [branch]\n"
+"    if( fHistoryWeight > 0.0 )\n"
+"    {\n"
+"        float4 f4PrevPosPS = mul( float4(f3PosWS, 1.0), g_FroxelAttribs.mPrevViewProj );\n"
+"        if( f4PrevPosPS.w > 0.0 )\n"
+"        {\n"
+"            // Note that w is the previous camera space z\n"
+"            float3 f3PrevUVW;\n"
+"            f3PrevUVW.xy = NormalizedDeviceXYToTexUV(f4PrevPosPS.xy / f4PrevPosPS.w);\n"
+"            f3PrevUVW.z  = CamSpaceZToFroxelSlice(f4PrevPosPS.w, g_FroxelAttribs.f4PrevGridDepthParams) / f3GridDim.z;\n"
+"            if( f3PrevUVW.x >= 0.0 && f3PrevUVW.x <= 1.0 &&\n"
+"                f3PrevUVW.y >= 0.0 && f3PrevUVW.y <= 1.0 &&\n"
+"                f3PrevUVW.z >= 0.0 && f3PrevUVW.z <= 1.0 )\n"
+"            {\n"
+"                float3 f3History = g_tex3DFroxelInsctrHistory.SampleLevel(g_tex3DFroxelInsctrHistory_sampler, f3PrevUVW, 0.0).rgb;\n"
+"                // History is scaled by the distance to the previous camera position\n"
+"                float fPrevDistToCamera = length(f3PosWS - g_FroxelAttribs.f4PrevCameraPos.xyz);\n"
+"                f3History *= fDistToCamera / max(fPrevDistToCamera, 1e-3);\n"
+"                f4Inscattering.rgb = lerp(f4Inscattering.rgb, f3History, fHistoryWeight);\n"
+"            }\n"
+"        }\n"
+"    }\n"
+"\n"
+"    g_rwtex3DFroxelInsctr[DTid] = f4Inscattering;\n"
+"}\n"
+"\n"
+"\n"
+"Texture3D<float4> g_tex3DFroxelInsctr;\n"
+"\n"
+"RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DFroxelIntegratedInsctr;\n"
+"\n"
+"// Integrates froxel scattering front to back. Every thread processes one column of the grid.\n"
+"// Texel k of the integrated grid contains light scattered between the camera and the far boundary of slice k\n"
+"[numthreads(FROXEL_THREAD_GROUP_SIZE, FROXEL_THREAD_GROUP_SIZE, 1)]\n"
+"void IntegrateFroxelInscatteringCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    float3 f3GridDim = g_FroxelAttribs.f4GridDim.xyz;\n"
+"    if( float(DTid.x) >= f3GridDim.x || float(DTid.y) >= f3GridDim.y )\n"
+"        return;\n"
+"\n"
+"    uint uiNumSlices = uint(f3GridDim.z);\n"
+"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;\n"
+"\n"
+"    float fNearZ = g_FroxelAttribs.f4GridDepthParams.x;\n"
+"    float3 f3NearPos = ProjSpaceXYZToWorldSpace(float3(GetFroxelColumnNormalizedDeviceXY(DTid.xy), fNearZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"    float3 f3ViewDir = f3NearPos - f3CameraPos;\n"
+"    // Distance along the ray per unit of camera space z\n"
+"    float fDistPerCamSpaceZ = length(f3ViewDir) / fNearZ;\n"
+"    f3ViewDir = normalize(f3ViewDir);\n"
+"\n"
+"    float4 f4Isecs;\n"
+"    GetRaySphereIntersection2(f3CameraPos, f3ViewDir, f3EarthCentre,\n"
+"                              float2(g_MediaParams.fAtmTopRadius, g_MediaParams.fAtmBottomRadius), f4Isecs);\n"
+"    float2 f2RayAtmTopIsecs = f4Isecs.xy;\n"
+"    float2 f2RayEarthIsecs  = f4Isecs.zw;\n"
+"\n"
+"    if( f2RayAtmTopIsecs.y <= 0.0 )\n"
+"    {\n"
+"        // The ray does not intersect the atmosphere\n"
+"        for(uint uiSlice = 0u; uiSlice < uiNumSlices; ++uiSlice)\n"
+"            g_rwtex3DFroxelIntegratedInsctr[uint3(DTid.xy, uiSlice)] = float4(0.0, 0.0, 0.0, 1.0);\n"
+"        return;\n"
+"    }\n"
+"\n"
+"    // Scattering is only accumulated in the part of the ray that is in the atmosphere and above the Earth surface\n"
+"    float fMinDist = max(f2RayAtmTopIsecs.x, 0.0);\n"
+"    float fMaxDist = f2RayAtmTopIsecs.y;\n"
+"    if( f2RayEarthIsecs.x > 0.0 )\n"
+"        fMaxDist = min(fMaxDist, f2RayEarthIsecs.x);\n"
+"\n"
+"#if MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE\n"
+"    // Higher-order scattering is not shadowed and is computed as the difference of the\n"
+"    // precomputed scattering at the start of the ray and at the far boundary of the slice\n"
+"    float3 f3RestrainedCameraPos = f3CameraPos + fMinDist * f3ViewDir;\n"
+"    float4 f4StartUVWQ = float4(-1.0, -1.0, -1.0, -1.0);\n"
+"    float3 f3StartHighOrderInsctr =\n"
+"        LookUpPrecomputedScattering(\n"
+"            f3RestrainedCameraPos,\n"
+"            f3ViewDir,\n"
+"            f3EarthCentre,\n"
+"            g_MediaParams.fEarthRadius,\n"
+"            -g_LightAttribs.f4Direction.xyz,\n"
+"            g_MediaParams.fAtmBottomAltitude,\n"
+"            g_MediaParams.fAtmTopAltitude,\n"
+"            g_tex3DHighOrderSctrLUT,\n"
+"            g_tex3DHighOrderSctrLUT_sampler,\n"
+"            f4StartUVWQ);\n"
+"#endif\n"
+"\n"
+"    float3 f3Transmittance = float3(1.0, 1.0, 1.0);\n"
+"    float3 f3Inscattering  = float3(0.0, 0.0, 0.0);\n"
+"    float  fSliceStartDist = 0.0;\n"
+"    for(uint uiSlice = 0u; uiSlice < uiNumSlices; ++uiSlice)\n"
+"    {\n"
+"        float fSliceCenterDist = FroxelSliceToCamSpaceZ(float(uiSlice) + 0.5, g_FroxelAttribs.f4GridDepthParams) * fDistPerCamSpaceZ;\n"
+"        float fSliceEndDist    = FroxelSliceToCamSpaceZ(float(uiSlice) + 1.0, g_FroxelAttribs.f4GridDepthParams) * fDistPerCamSpaceZ;\n"
+"        float fSectionLength   = max(min(fSliceEndDist, fMaxDist) - max(fSliceStartDist, fMinDist), 0.0);\n"
+"        fSliceStartDist = fSliceEndDist;\n"
+"\n"
+"        // Evaluate media extinction in the slice center\n"
+"        float3 f3SliceCenter = f3CameraPos + f3ViewDir * fSliceCenterDist;\n"
+"        float fHeightAboveSurface = length(f3SliceCenter - f3EarthCentre) - g_MediaParams.fEarthRadius;\n"
+"        float2 f2ParticleDensity = exp( -max(fHeightAboveSurface, 0.0) * g_MediaParams.f4ParticleScaleHeight.zw );\n"
+"        float3 f3ExtinctionCoeff = g_MediaParams.f4RayleighExtinctionCoeff.rgb * f2ParticleDensity.x +\n"
+"                                   g_MediaParams.f4MieExtinctionCoeff.rgb      * f2ParticleDensity.y;\n"
+"        float3 f3SliceTransmittance = exp( -f3ExtinctionCoeff * fSectionLength );\n"
+"\n"
+"        float3 f3SliceInsctr = g_tex3DFroxelInsctr.Load( int4(int2(DTid.xy), int(uiSlice), 0) ).rgb / fSliceCenterDist * fSectionLength;\n"
+"        // Light scattered in the slice is attenuated on its way to the slice boundary. Use the midpoint rule\n"
+"        f3Inscattering  += f3Transmittance * sqrt(f3SliceTransmittance) * f3SliceInsctr;\n"
+"        f3Transmittance *= f3SliceTransmittance;\n"
+"\n"
+"        float3 f3TotalInsctr = f3Inscattering;\n"
+"#if MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE\n"
+"        {\n"
+"            float3 f3SliceEnd = f3CameraPos + f3ViewDir * clamp(fSliceEndDist, fMinDist, fMaxDist);\n"
+"            float3 f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3SliceEnd, f3ViewDir, f3EarthCentre,\n"
+"                                                          g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"            // To avoid artifacts, look-ups must be consistent with the first one (see RayMarch.fx)\n"
+"            float4 f4UVWQ = f4StartUVWQ;\n"
+"            float3 f3HighOrderInsctr = f3StartHighOrderInsctr - f3Extinction *\n"
+"                LookUpPrecomputedScattering(\n"
+"                    f3SliceEnd,\n"
+"                    f3ViewDir,\n"
+"                    f3EarthCentre,\n"
+"                    g_MediaParams.fEarthRadius,\n"
+"                    -g_LightAttribs.f4Direction.xyz,\n"
+"                    g_MediaParams.fAtmBottomAltitude,\n"
+"                    g_MediaParams.fAtmTopAltitude,\n"
+"                    g_tex3DHighOrderSctrLUT,\n"
+"                    g_tex3DHighOrderSctrLUT_sampler,\n"
+"                    f4UVWQ);\n"
+"            f3TotalInsctr += max(f3HighOrderInsctr, float3(0.0, 0.0, 0.0));\n"
+"        }\n"
+"#endif\n"
+"        g_rwtex3DFroxelIntegratedInsctr[uint3(DTid.xy, uiSlice)] = float4(f3TotalInsctr * g_LightAttribs.f4Intensity.rgb, 1.0);\n"
+"    }\n"
+"}\n"
+"\n"
+"\n"
+"Texture3D<float4> g_tex3DFroxelIntegratedInsctr;\n"
+"SamplerState      g_tex3DFroxelIntegratedInsctr_sampler; // Linear clamp\n"
+"\n"
+"// Scattering beyond the grid is not shadowed and is looked up from the precomputed tables\n"
+"#if SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE && MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE\n"
+"#   define tex3DRemainingSctrLUT         g_tex3DMultipleSctrLUT\n"
+"#   define tex3DRemainingSctrLUT_sampler g_tex3DMultipleSctrLUT_sampler\n"
+"#elif SINGLE_SCATTERING_MODE != SINGLE_SCTR_MODE_NONE\n"
+"#   define tex3DRemainingSctrLUT         g_tex3DSingleSctrLUT\n"
+"#   define tex3DRemainingSctrLUT_sampler g_tex3DSingleSctrLUT_sampler\n"
+"#elif MULTIPLE_SCATTERING_MODE > MULTIPLE_SCTR_MODE_NONE\n"
+"#   define tex3DRemainingSctrLUT         g_tex3DHighOrderSctrLUT\n"
+"#   define tex3DRemainingSctrLUT_sampler g_tex3DHighOrderSctrLUT_sampler\n"
+"#endif\n"
+"\n"
+"float3 GetFroxelInscattering(float2 f2PosPS, float fCamSpaceZ)\n"
+"{\n"
+"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;\n"
+"\n"
+"    float3 f3RayTermination = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"    float3 f3ViewDir = f3RayTermination - f3CameraPos;\n"
+"    float fRayLength = length(f3ViewDir);\n"
+"    f3ViewDir /= fRayLength;\n"
+"    float fCamSpaceZPerDist = fCamSpaceZ / fRayLength;\n"
+"\n"
+"    float4 f4Isecs;\n"
+"    GetRaySphereIntersection2(f3CameraPos, f3ViewDir, f3EarthCentre,\n"
+"                              float2(g_MediaParams.fAtmTopRadius, g_MediaParams.fAtmBottomRadius), f4Isecs);\n"
+"    float2 f2RayAtmTopIsecs = f4Isecs.xy;\n"
+"    float2 f2RayEarthIsecs  = f4Isecs.zw;\n"
+"    if( f2RayAtmTopIsecs.y <= 0.0 )\n"
+"    {\n"
+"        // The camera is outside the atmosphere and the ray does not intersect it\n"
+"        return float3(0.0, 0.0, 0.0);\n"
+"    }\n"
+"\n"
+"    if( fCamSpaceZ > g_CameraAttribs.fFarPlaneZ ) // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"        fRayLength = +FLT_MAX;\n"
+"    fRayLength = min(fRayLength, f2RayAtmTopIsecs.y);\n"
+"    if( f2RayEarthIsecs.x > 0.0 )\n"
+"        fRayLength = min(fRayLength, f2RayEarthIsecs.x);\n"
+"\n"
+"    float fSlice = CamSpaceZToFroxelSlice(fRayLength * fCamSpaceZPerDist, g_FroxelAttribs.f4GridDepthParams);\n"
+"    float3 f3UVW = float3(NormalizedDeviceXYToTexUV(f2PosPS), (fSlice - 0.5) / g_FroxelAttribs.f4GridDim.z);\n"
+"    float3 f3Inscattering = g_tex3DFroxelIntegratedInsctr.SampleLevel(g_tex3DFroxelIntegratedInsctr_sampler, f3UVW, 0.0).rgb;\n"
+"    // Fade scattering out in the first slice\n"
+"    f3Inscattering *= saturate(fSlice);\n"
+"\n"
+"#ifdef tex3DRemainingSctrLUT\n"
+"    float fGridEndDist = g_FroxelAttribs.f4GridDepthParams.y / fCamSpaceZPerDist;\n"
+"    [branch]\n"
+"    if( fRayLength > fGridEndDist )\n"
+"    {\n"
+"        float fDistToAtmosphere = max(f2RayAtmTopIsecs.x, 0.0);\n"
+"        float3 f3RestrainedCameraPos = f3CameraPos + fDistToAtmosphere * f3ViewDir;\n"
+"        float3 f3RemainingRayStart = f3CameraPos + max(fGridEndDist, fDistToAtmosphere) * f3ViewDir;\n"
+"        float3 f3RayEnd = f3CameraPos + fRayLength * f3ViewDir;\n"
+"\n"
+"        float3 f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3RemainingRayStart, f3ViewDir, f3EarthCentre,\n"
+"                                                      g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"        float4 f4UVWQ = float4(-1.0, -1.0, -1.0, -1.0);\n"
+"        float3 f3RemainingInsctr = f3Extinction *\n"
+"            LookUpPrecomputedScattering(\n"
+"                f3RemainingRayStart,\n"
+"                f3ViewDir,\n"
+"                f3EarthCentre,\n"
+"                g_MediaParams.fEarthRadius,\n"
+"                -g_LightAttribs.f4Direction.xyz,\n"
+"                g_MediaParams.fAtmBottomAltitude,\n"
+"                g_MediaParams.fAtmTopAltitude,\n"
+"                tex3DRemainingSctrLUT,\n"
+"                tex3DRemainingSctrLUT_sampler,\n"
+"                f4UVWQ);\n"
+"\n"
+"        f3Extinction = GetExtinctionUnverified(f3RestrainedCameraPos, f3RayEnd, f3ViewDir, f3EarthCentre,\n"
+"                                               g_MediaParams.fEarthRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"        f3RemainingInsctr -= f3Extinction *\n"
+"            LookUpPrecomputedScattering(\n"
+"                f3RayEnd,\n"
+"                f3ViewDir,\n"
+"                f3EarthCentre,\n"
+"                g_MediaParams.fEarthRadius,\n"
+"                -g_LightAttribs.f4Direction.xyz,\n"
+"                g_MediaParams.fAtmBottomAltitude,\n"
+"                g_MediaParams.fAtmTopAltitude,\n"
+"                tex3DRemainingSctrLUT,\n"
+"                tex3DRemainingSctrLUT_sampler,\n"
+"                f4UVWQ);\n"
+"\n"
+"        f3Inscattering += max(f3RemainingInsctr, float3(0.0, 0.0, 0.0)) * g_LightAttribs.f4Intensity.rgb;\n"
+"    }\n"
+"#endif\n"
+"\n"
+"    return f3Inscattering;\n"
+"}\n"
+"\n"
+"void ApplyFroxelInscatteringPS(FullScreenTriangleVSOutput VSOut,\n"
+"                               // IMPORTANT: non-system generated pixel shader input\n"
+"                               // arguments must have the exact same name as vertex shader\n"
+"                               // outputs and must go in the same order.\n"
+"                               // Moreover, even if the shader is not using the argument,\n"
+"                               // it still must be declared.\n"
+"\n"
+"                               out float4 f4Color : SV_Target)\n"
+"{\n"
+"    // Note that the render target may be smaller than the screen when rendering luminance\n"
+"    int2 i2PixelPos = int2( NormalizedDeviceXYToTexUV(VSOut.f2NormalizedXY) * g_PPAttribs.f4ScreenResolution.xy );\n"
+"    i2PixelPos = min(i2PixelPos, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));\n"
+"    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );\n"
+"\n"
+"    float3 f3Inscattering = GetFroxelInscattering(VSOut.f2NormalizedXY, fCamSpaceZ);\n"
+"\n"
+"    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);\n"
+"    [branch]\n"
+"    if( !g_PPAttribs.bShowLightingOnly )\n"
+"    {\n"
+"        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;\n"
+"        // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);\n"
+"        float3 f3ReconstructedPosWS = ProjSpaceXYZToWorldSpace(float3(VSOut.f2NormalizedXY.xy, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"        float3 f3Extinction = GetExtinction(g_CameraAttribs.f4Position.xyz, f3ReconstructedPosWS, g_PPAttribs.f4EarthCenter.xyz,\n"
+"                                            g_MediaParams.fAtmBottomRadius, g_MediaParams.fAtmTopRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"        f3BackgroundColor *= f3Extinction;\n"
+"    }\n"
+"\n"
+"#if PERFORM_TONE_MAPPING\n"
+"    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);\n"
+"#   if USE_TONE_MAPPING_LUT\n"
+"    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);\n"
+"#   else\n"
+"    f4Color.rgb = ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum);\n"
+"#   endif\n"
+"#else\n"
+"    const float MinLumn = 0.01;\n"
+"    float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3Inscattering, MinLumn);\n"
+"    f4Color.rgb = float3(LogLum_W.x, LogLum_W.y, 0.0);\n"
+"#endif\n"
+"    f4Color.a = 1.0;\n"
+"}\n"
@@ -0,0 +1,95 @@
+"#ifndef _GLTF_PBR_ENV_MAP_FILTERING_FXH_\n"
+"#define _GLTF_PBR_ENV_MAP_FILTERING_FXH_\n"
+"\n"
+"// Environment map convolution functions that are shared by the pixel and compute shaders.\n"
+"// g_EnvironmentMap and g_EnvironmentMap_sampler must be declared before including this file.\n"
+"\n"
+"#include \"GLTF_PBR_PrecomputeCommon.fxh\"\n"
+"\n"
+"#ifndef NUM_PHI_SAMPLES\n"
+"#   define NUM_PHI_SAMPLES 64\n"
+"#endif\n"
+"\n"
+"#ifndef NUM_THETA_SAMPLES\n"
+"#   define NUM_THETA_SAMPLES 32\n"
+"#endif\n"
+"\n"
+"#ifndef OPTIMIZE_SAMPLES\n"
+"#   define OPTIMIZE_SAMPLES 1\n"
+"#endif\n"
+"\n"
+"// Returns the direction that corresponds to the texel of the cube map face, the same way as\n"
+"// CubemapFace.vsh does for the rasterized face.\n"
+"float3 GetCubemapFaceDirection(uint3 Texel, uint FaceDim, float4x4 FaceRotation)\n"
+"{\n"
+"    float2 PosXY = (float2(Texel.xy) + float2(0.5, 0.5)) / float(FaceDim) * float2(2.0, -2.0) + float2(-1.0, 1.0);\n"
+"    float4 f4WorldPos = mul(FaceRotation, float4(PosXY, 1.0, 1.0));\n"
+"    return f4WorldPos.xyz / f4WorldPos.w;\n"
+"}\n"
+"\n"
+"float3 ComputeIrradiance(float3 N)\n"
+"{\n"
+"    float3 up    = float3(0.0, 1.0, 0.0);\n"
+"    float3 right = normalize(cross(up, N));\n"
+"    up = cross(N, right);\n"
+"\n"
+"    const float deltaPhi   = 2.0 * PI / float(NUM_PHI_SAMPLES);\n"
+"    const float deltaTheta = 0.5 * PI / float(NUM_THETA_SAMPLES);\n"
+"\n"
+"    float3 color = float3(0.0, 0.0, 0.0);\n"
+"    float sampleCount = 0.0;\n"
+"    for (int p=0; p < NUM_PHI_SAMPLES; ++p)\n"
+"    {\n"
+"        float phi = float(p) * deltaPhi;\n"
+"        for (int t=0; t < NUM_THETA_SAMPLES; ++t)\n"
+"        {\n"
+"            float theta = float(t) * deltaTheta;\n"
+"            float3 tempVec   = cos(phi) * right + sin(phi) * up;\n"
+"            float3 sampleDir = cos(theta) * N + sin(theta) * tempVec;\n"
+"            color += g_EnvironmentMap.SampleLevel(g_EnvironmentMap_sampler, sampleDir, 0.0).rgb * cos(theta) * sin(theta);\n"
+"            sampleCount += 1.0;\n"
+"        }\n"
+"    }\n"
+"    return PI * color / sampleCount;\n"
+"}\n"
+"\n"
+"// https://blog.selfshadow.com/publications/s2013-shading-course/karis/s2013_pbs_epic_notes_v2.pdf\n"
+"float3 PrefilterEnvMap( float Roughness, float3 R, uint NumSamples, float EnvMapDim )\n"
+"{\n"
+"    float3 N = R;\n"
+"    float3 V = R;\n"
+"    float3 PrefilteredColor = float3(0.0, 0.0, 0.0);\n"
+"    float TotalWeight = 0.0;\n"
+"    for( uint i = 0u; i < NumSamples; i++ )\n"
+"    {\n"
+"        float2 Xi = Hammersley2D( i, NumSamples );\n"
+"        float3 H  = ImportanceSampleGGX( Xi, Roughness, N );\n"
+"        float3 L  = 2.0 * dot(V, H) * H - V;\n"
+"        float NoL = clamp(dot(N, L), 0.0, 1.0);\n"
+"        float VoH = clamp(dot(V, H), 0.0, 1.0);\n"
+"        if(NoL > 0.0 && VoH > 0.0)\n"
+"        {\n"
+"#if OPTIMIZE_SAMPLES\n"
+"            // https://placeholderart.wordpress.com/2015/07/28/implementation-notes-runtime-environment-map-filtering-for-image-based-lighting/\n"
+"\n"
+"            float NoH = clamp(dot(N, H), 0.0, 1.0);\n"
+"\n"
+"            // Probability Distribution Function\n"
+"            float pdf = max(NormalDistribution_GGX(NoH, Roughness) * NoH / (4.0 * VoH), 0.0001);\n"
+"            // Slid angle of current smple\n"
+"            float OmegaS = 1.0 / (float(NumSamples) * pdf);\n"
+"            // Solid angle of 1 pixel across all cube faces\n"
+"            float OmegaP = 4.0 * PI / (6.0 * EnvMapDim * EnvMapDim);\n"
+"            // Do not apply mip bias as this produces result that are not cosistent with the reference\n"
+"            float MipLevel = (Roughness == 0.0) ? 0.0 : max(0.5 * log2(OmegaS / OmegaP), 0.0);\n"
+"#else\n"
+"            float MipLevel = 0.0;\n"
+"#endif\n"
+"            PrefilteredColor += g_EnvironmentMap.SampleLevel(g_EnvironmentMap_sampler, L, MipLevel).rgb * NoL;\n"
+"            TotalWeight += NoL;\n"
+"        }\n"
+"    }\n"
+"    return PrefilteredColor / TotalWeight;\n"
+"}\n"
+"\n"
+"#endif // _GLTF_PBR_ENV_MAP_FILTERING_FXH_\n"
@@ -121,38 +121,23 @@
 "    float3 f3Specular;\n"
 "};\n"
 "\n"
-"// Calculation of the lighting contribution from an optional Image Based Light source.\n"
-"// Precomputed Environment Maps are required uniform inputs and are computed as outlined in [1].\n"
-"// See our README.md on Environment Maps [3] for additional discussion.\n"
-"GLTF_PBR_IBL_Contribution GLTF_PBR_GetIBLContribution(\n"
+"// Calculation of the lighting contribution from an optional Image Based Light source\n"
+"// given the diffuse irradiance and the prefiltered specular samples.\n"
+"GLTF_PBR_IBL_Contribution GLTF_PBR_CombineIBLSamples(\n"
 "                        in SurfaceReflectanceInfo SrfInfo,\n"
 "                        in float3                 n,\n"
 "                        in float3                 v,\n"
-"                        in float                  PrefilteredCubeMipLevels,\n"
 "                        in Texture2D              BRDF_LUT,\n"
 "                        in SamplerState           BRDF_LUT_sampler,\n"
-"                        in TextureCube            IrradianceMap,\n"
-"                        in SamplerState           IrradianceMap_sampler,\n"
-"                        in TextureCube            PrefilteredEnvMap,\n"
-"                        in SamplerState           PrefilteredEnvMap_sampler)\n"
+"                        in float4                 diffuseSample,\n"
+"                        in float4                 specularSample)\n"
 "{\n"
 "    float NdotV = clamp(dot(n, v), 0.0, 1.0);\n"
 "\n"
-"    float lod = clamp(SrfInfo.PerceptualRoughness * PrefilteredCubeMipLevels, 0.0, PrefilteredCubeMipLevels);\n"
-"    float3 reflection = normalize(reflect(-v, n));\n"
-"\n"
 "    float2 brdfSamplePoint = clamp(float2(NdotV, SrfInfo.PerceptualRoughness), float2(0.0, 0.0), float2(1.0, 1.0));\n"
 "    // retrieve a scale and bias to F0. See [1], Figure 3\n"
 "    float2 brdf = BRDF_LUT.Sample(BRDF_LUT_sampler, brdfSamplePoint).rg;\n"
 "\n"
-"    float4 diffuseSample = IrradianceMap.Sample(IrradianceMap_sampler, n);\n"
-"\n"
-"#ifdef GLTF_PBR_USE_ENV_MAP_LOD\n"
-"    float4 specularSample = PrefilteredEnvMap.SampleLevel(PrefilteredEnvMap_sampler, reflection, lod);\n"
-"#else\n"
-"    float4 specularSample = PrefilteredEnvMap.Sample(PrefilteredEnvMap_sampler, reflection);\n"
-"#endif\n"
-"\n"
 "#ifdef GLTF_PBR_USE_HDR_CUBEMAPS\n"
 "    // Already linear.\n"
 "    float3 diffuseLight  = diffuseSample.rgb;\n"
@@ -168,6 +153,93 @@
 "    return IBLContrib;\n"
 "}\n"
 "\n"
+"// Calculation of the lighting contribution from an optional Image Based Light source\n"
+"// given the diffuse irradiance sample.\n"
+"GLTF_PBR_IBL_Contribution GLTF_PBR_ComputeIBLContribution(\n"
+"                        in SurfaceReflectanceInfo SrfInfo,\n"
+"                        in float3                 n,\n"
+"                        in float3                 v,\n"
+"                        in float                  PrefilteredCubeMipLevels,\n"
+"                        in Texture2D              BRDF_LUT,\n"
+"                        in SamplerState           BRDF_LUT_sampler,\n"
+"                        in float4                 diffuseSample,\n"
+"                        in TextureCube            PrefilteredEnvMap,\n"
+"                        in SamplerState           PrefilteredEnvMap_sampler)\n"
+"{\n"
+"    float lod = clamp(SrfInfo.PerceptualRoughness * PrefilteredCubeMipLevels, 0.0, PrefilteredCubeMipLevels);\n"
+"    float3 reflection = normalize(reflect(-v, n));\n"
+"\n"
+"#ifdef GLTF_PBR_USE_ENV_MAP_LOD\n"
+"    float4 specularSample = PrefilteredEnvMap.SampleLevel(PrefilteredEnvMap_sampler, reflection, lod);\n"
+"#else\n"
+"    float4 specularSample = PrefilteredEnvMap.Sample(PrefilteredEnvMap_sampler, reflection);\n"
+"#endif\n"
+"\n"
+"    return GLTF_PBR_CombineIBLSamples(SrfInfo, n, v, BRDF_LUT, BRDF_LUT_sampler, diffuseSample, specularSample);\n"
+"}\n"
+"\n"
+"// Calculation of the lighting contribution from an optional Image Based Light source.\n"
+"// Precomputed Environment Maps are required uniform inputs and are computed as outlined in [1].\n"
+"// See our README.md on Environment Maps [3] for additional discussion.\n"
+"GLTF_PBR_IBL_Contribution GLTF_PBR_GetIBLContribution(\n"
+"                        in SurfaceReflectanceInfo SrfInfo,\n"
+"                        in float3                 n,\n"
+"                        in float3                 v,\n"
+"                        in float                  PrefilteredCubeMipLevels,\n"
+"                        in Texture2D              BRDF_LUT,\n"
+"                        in SamplerState           BRDF_LUT_sampler,\n"
+"                        in TextureCube            IrradianceMap,\n"
+"                        in SamplerState           IrradianceMap_sampler,\n"
+"                        in TextureCube            PrefilteredEnvMap,\n"
+"                        in SamplerState           PrefilteredEnvMap_sampler)\n"
+"{\n"
+"    float4 diffuseSample = IrradianceMap.Sample(IrradianceMap_sampler, n);\n"
+"    return GLTF_PBR_ComputeIBLContribution(SrfInfo, n, v, PrefilteredCubeMipLevels,\n"
+"                                           BRDF_LUT, BRDF_LUT_sampler,\n"
+"                                           diffuseSample,\n"
+"                                           PrefilteredEnvMap, PrefilteredEnvMap_sampler);\n"
+"}\n"
+"\n"
+"// Evaluates the diffuse irradiance in the direction n from 9 spherical harmonics coefficients.\n"
+"// The coefficients are premultiplied by the basis constants and the clamped cosine lobe\n"
+"// convolution weights, and the result is scaled the same way as the irradiance cube map\n"
+"// (see ComputeIrradianceSH.csh).\n"
+"float3 GLTF_PBR_EvaluateIrradianceSH(in float3 n, in float4 IrradianceSH[9])\n"
+"{\n"
+"    float3 E =\n"
+"        IrradianceSH[0].rgb +\n"
+"        IrradianceSH[1].rgb * n.y +\n"
+"        IrradianceSH[2].rgb * n.z +\n"
+"        IrradianceSH[3].rgb * n.x +\n"
+"        IrradianceSH[4].rgb * (n.x * n.y) +\n"
+"        IrradianceSH[5].rgb * (n.y * n.z) +\n"
+"        IrradianceSH[6].rgb * (3.0 * n.z * n.z - 1.0) +\n"
+"        IrradianceSH[7].rgb * (n.x * n.z) +\n"
+"        IrradianceSH[8].rgb * (n.x * n.x - n.y * n.y);\n"
+"    // Second-order approximation may ring below zero for high-contrast environments\n"
+"    return max(E, float3(0.0, 0.0, 0.0));\n"
+"}\n"
+"\n"
+"// Same as GLTF_PBR_GetIBLContribution, but evaluates the diffuse irradiance from\n"
+"// spherical harmonics instead of sampling the irradiance cube map.\n"
+"GLTF_PBR_IBL_Contribution GLTF_PBR_GetIBLContributionSH(\n"
+"                        in SurfaceReflectanceInfo SrfInfo,\n"
+"                        in float3                 n,\n"
+"                        in float3                 v,\n"
+"                        in float                  PrefilteredCubeMipLevels,\n"
+"                        in Texture2D              BRDF_LUT,\n"
+"                        in SamplerState           BRDF_LUT_sampler,\n"
+"                        in float4                 IrradianceSH[9],\n"
+"                        in TextureCube            PrefilteredEnvMap,\n"
+"                        in SamplerState           PrefilteredEnvMap_sampler)\n"
+"{\n"
+"    float4 diffuseSample = float4(GLTF_PBR_EvaluateIrradianceSH(n, IrradianceSH), 1.0);\n"
+"    return GLTF_PBR_ComputeIBLContribution(SrfInfo, n, v, PrefilteredCubeMipLevels,\n"
+"                                           BRDF_LUT, BRDF_LUT_sampler,\n"
+"                                           diffuseSample,\n"
+"                                           PrefilteredEnvMap, PrefilteredEnvMap_sampler);\n"
+"}\n"
+"\n"
 "/// Calculates surface reflectance info\n"
 "\n"
 "/// \\param [in]  Workflow     - PBR workflow (PBR_WORKFLOW_SPECULAR_GLOSINESS or PBR_WORKFLOW_METALLIC_ROUGHNESS).\n"
@@ -55,6 +55,11 @@
 "\n"
 "Texture2D<float>  g_tex2DAverageLuminance;\n"
 "\n"
+"#if USE_TONE_MAPPING_LUT\n"
+"Texture3D<float4> g_tex3DToneMappingLUT;\n"
+"SamplerState      g_tex3DToneMappingLUT_sampler;\n"
+"#endif\n"
+"\n"
 "Texture3D<float3> g_tex3DSingleSctrLUT;\n"
 "SamplerState      g_tex3DSingleSctrLUT_sampler;\n"
 "\n"
@@ -64,10 +69,25 @@
 "Texture3D<float3> g_tex3DMultipleSctrLUT;\n"
 "SamplerState      g_tex3DMultipleSctrLUT_sampler;\n"
 "\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"Texture2D<float3> g_tex2DSkyViewInsctr;\n"
+"SamplerState      g_tex2DSkyViewInsctr_sampler;\n"
+"\n"
+"Texture2D<float3> g_tex2DSkyViewExtinction;\n"
+"SamplerState      g_tex2DSkyViewExtinction_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveInsctr;\n"
+"SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveExtinction;\n"
+"SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;\n"
+"#endif\n"
+"\n"
 "\n"
 "#include \"LookUpTables.fxh\"\n"
 "#include \"ScatteringIntegrals.fxh\"\n"
 "#include \"Extinction.fxh\"\n"
+"#include \"SkyViewAndAerialPerspective.fxh\"\n"
 "#include \"UnshadowedScattering.fxh\"\n"
 "#include \"ToneMapping.fxh\"\n"
 "\n"
@@ -666,22 +686,18 @@
 "#endif\n"
 "\n"
 "\n"
-"void RayMarchPS(in FullScreenTriangleVSOutput VSOut,\n"
-"                out float4 f4Inscattering : SV_TARGET)\n"
+"float4 RayMarchEpipolarSample(uint2 ui2SamplePosSliceInd, float fCascade)\n"
 "{\n"
-"    uint2 ui2SamplePosSliceInd = uint2(VSOut.f4PixelPos.xy);\n"
 "    float2 f2SampleLocation = g_tex2DCoordinates.Load( int3(ui2SamplePosSliceInd, 0) );\n"
 "    float fRayEndCamSpaceZ = g_tex2DEpipolarCamSpaceZ.Load( int3(ui2SamplePosSliceInd, 0) );\n"
 "\n"
 "    [branch]\n"
 "    if( any( Greater( abs( f2SampleLocation ), (1.0 + 1e-3) * float2(1.0, 1.0)) ) )\n"
 "    {\n"
-"        f4Inscattering = float4(0.0, 0.0, 0.0, 0.0);\n"
-"        return;\n"
+"        return float4(0.0, 0.0, 0.0, 0.0);\n"
 "    }\n"
-"    f4Inscattering = float4(1.0, 1.0, 1.0, 1.0);\n"
+"    float4 f4Inscattering = float4(1.0, 1.0, 1.0, 1.0);\n"
 "#if ENABLE_LIGHT_SHAFTS\n"
-"    float fCascade = g_MiscParams.fCascadeInd + VSOut.fInstID;\n"
 "    f4Inscattering.rgb =\n"
 "        ComputeShadowedInscattering(f2SampleLocation,\n"
 "                                    fRayEndCamSpaceZ,\n"
@@ -697,9 +713,180 @@
 "                                  f3Extinction);\n"
 "    f4Inscattering.rgb *= g_LightAttribs.f4Intensity.rgb;\n"
 "#endif\n"
+"    return f4Inscattering;\n"
+"}\n"
+"\n"
+"void RayMarchPS(in FullScreenTriangleVSOutput VSOut,\n"
+"                out float4 f4Inscattering : SV_TARGET)\n"
+"{\n"
+"    f4Inscattering = RayMarchEpipolarSample(uint2(VSOut.f4PixelPos.xy), g_MiscParams.fCascadeInd + VSOut.fInstID);\n"
 "}\n"
 "\n"
 "\n"
+"#if COMPACT_RAY_MARCHING_SAMPLES\n"
+"\n"
+"// Compacted list of ray marching samples generated by RefineSampleLocationsCS()\n"
+"StructuredBuffer<uint> g_RayMarchingSampleList;\n"
+"StructuredBuffer<uint> g_RayMarchingSampleCounter;\n"
+"\n"
+"RWTexture2D<float4 /*format = rgba16f*/> g_rwtex2DInitialScatteredLight;\n"
+"\n"
+"// Ray marches samples from the compacted list. The shader is executed with indirect dispatch,\n"
+"// so that only as many thread groups as required to process all samples are launched\n"
+"[numthreads(RAY_MARCH_THREAD_GROUP_SIZE, 1, 1)]\n"
+"void RayMarchCompactedSamplesCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    if( DTid.x >= g_RayMarchingSampleCounter[0] )\n"
+"        return;\n"
+"\n"
+"    uint uiPackedSample = g_RayMarchingSampleList[DTid.x];\n"
+"    uint2 ui2SamplePosSliceInd = uint2(uiPackedSample & 0xFFFFu, uiPackedSample >> 16u);\n"
+"    g_rwtex2DInitialScatteredLight[ui2SamplePosSliceInd] = RayMarchEpipolarSample(ui2SamplePosSliceInd, g_MiscParams.fCascadeInd);\n"
+"}\n"
+"\n"
+"#endif\n"
+"\n"
+"\n"
+"// Performs brute-force ray marching at reduced resolution. Every texel of the downscaled\n"
+"// target computes inscattering for the full resolution pixel in the center of the\n"
+"// corresponding uiBruteForceDownscaleFactor x uiBruteForceDownscaleFactor block and stores\n"
+"// its camera space z to guide bilateral upsampling (see UpsampleInscattering.fx)\n"
+"void RayMarchDownscaledPS(in FullScreenTriangleVSOutput VSOut,\n"
+"                          out float4 f4Inscattering : SV_Target0,\n"
+"                          out float  fCamSpaceZ     : SV_Target1)\n"
+"{\n"
+"    int iDownscaleFactor = int(g_PPAttribs.uiBruteForceDownscaleFactor);\n"
+"    int2 i2FullResPixel = int2(VSOut.f4PixelPos.xy) * iDownscaleFactor + int2(iDownscaleFactor/2, iDownscaleFactor/2);\n"
+"    i2FullResPixel = min(i2FullResPixel, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));\n"
+"\n"
+"    fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2FullResPixel, 0) );\n"
+"    float2 f2SampleLocation = TexUVToNormalizedDeviceXY( (float2(i2FullResPixel) + float2(0.5, 0.5)) * g_PPAttribs.f4ScreenResolution.zw );\n"
+"\n"
+"    f4Inscattering = float4(0.0, 0.0, 0.0, 1.0);\n"
+"#if ENABLE_LIGHT_SHAFTS\n"
+"    float fCascade = g_MiscParams.fCascadeInd + VSOut.fInstID;\n"
+"    f4Inscattering.rgb =\n"
+"        ComputeShadowedInscattering(f2SampleLocation,\n"
+"                                    fCamSpaceZ,\n"
+"                                    fCascade,\n"
+"                                    0u // Ignored\n"
+"                                    );\n"
+"#else\n"
+"    float3 f3Extinction;\n"
+"    ComputeUnshadowedInscattering(f2SampleLocation,\n"
+"                                  fCamSpaceZ,\n"
+"                                  g_PPAttribs.uiInstrIntegralSteps,\n"
+"                                  g_PPAttribs.f4EarthCenter.xyz,\n"
+"                                  f4Inscattering.rgb,\n"
+"                                  f3Extinction);\n"
+"    f4Inscattering.rgb *= g_LightAttribs.f4Intensity.rgb;\n"
+"#endif\n"
+"}\n"
+"\n"
+"\n"
+"#if UNWARP_AND_FIX_INSCATTERING\n"
+"\n"
+"// Resources required to unwarp epipolar inscattering image (see UnwarpEpipolarScattering.fx)\n"
+"Texture2D<float4> g_tex2DSliceEndPoints;\n"
+"SamplerState      g_tex2DSliceEndPoints_sampler; // Linear clamp\n"
+"\n"
+"SamplerState      g_tex2DEpipolarCamSpaceZ_sampler; // Linear clamp\n"
+"\n"
+"Texture2D<float3> g_tex2DScatteredColor;\n"
+"SamplerState      g_tex2DScatteredColor_sampler; // Linear clamp\n"
+"\n"
+"#if EXTINCTION_EVAL_MODE == EXTINCTION_EVAL_MODE_EPIPOLAR\n"
+"    Texture2D<float3> g_tex2DEpipolarExtinction;\n"
+"    SamplerState      g_tex2DEpipolarExtinction_sampler; // Linear clamp\n"
+"#endif\n"
+"\n"
+"#include \"UnwarpEpipolarScattering.fxh\"\n"
+"\n"
+"RWTexture2D<float4 /*format = rgba8*/> g_rwtex2DDstColor;\n"
+"\n"
+"// Unwarps epipolar inscattering image, ray marches pixels for which no suitable interpolation\n"
+"// sources were found, and writes the tone mapped result to the destination color buffer.\n"
+"// Unlike the pixel shader path, this does not require depth buffer to mark pixels at depth\n"
+"// breaks, and every pixel of the destination buffer is written exactly once\n"
+"[numthreads(UNWARP_THREAD_GROUP_SIZE, UNWARP_THREAD_GROUP_SIZE, 1)]\n"
+"void UnwarpAndFixInscatteringCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    int2 i2PixelPos = int2(DTid.xy);\n"
+"    if( float(i2PixelPos.x) >= g_PPAttribs.f4ScreenResolution.x ||\n"
+"        float(i2PixelPos.y) >= g_PPAttribs.f4ScreenResolution.y )\n"
+"        return;\n"
+"\n"
+"    float2 f2PosPS = TexUVToNormalizedDeviceXY( (float2(i2PixelPos) + float2(0.5, 0.5)) * g_PPAttribs.f4ScreenResolution.zw );\n"
+"    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );\n"
+"\n"
+"    float3 f3Inscattering, f3Extinction;\n"
+"    bool bIsDepthBreak = !UnwarpEpipolarInsctrImage(f2PosPS, fCamSpaceZ, f3Inscattering, f3Extinction);\n"
+"#if !CORRECT_INSCATTERING_AT_DEPTH_BREAKS\n"
+"    bIsDepthBreak = false;\n"
+"#endif\n"
+"\n"
+"    [branch]\n"
+"    if( bIsDepthBreak && g_PPAttribs.bShowDepthBreaks )\n"
+"    {\n"
+"        g_rwtex2DDstColor[i2PixelPos] = float4(0.0, 1.0, 0.0, 1.0);\n"
+"        return;\n"
+"    }\n"
+"\n"
+"    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);\n"
+"    [branch]\n"
+"    if( !g_PPAttribs.bShowLightingOnly )\n"
+"    {\n"
+"        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;\n"
+"        // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);\n"
+"\n"
+"#if EXTINCTION_EVAL_MODE == EXTINCTION_EVAL_MODE_EPIPOLAR\n"
+"        [branch]\n"
+"        if( bIsDepthBreak )\n"
+"#endif\n"
+"        {\n"
+"            f3Extinction = GetBackgroundExtinction(f2PosPS, fCamSpaceZ);\n"
+"        }\n"
+"        f3BackgroundColor *= f3Extinction;\n"
+"    }\n"
+"\n"
+"#if CORRECT_INSCATTERING_AT_DEPTH_BREAKS\n"
+"    // Pixels at depth breaks are sparse, so they are ray marched inline rather\n"
+"    // than in a separate pass\n"
+"    [branch]\n"
+"    if( bIsDepthBreak )\n"
+"    {\n"
+"#   if ENABLE_LIGHT_SHAFTS\n"
+"        f3Inscattering =\n"
+"            ComputeShadowedInscattering(f2PosPS,\n"
+"                                        fCamSpaceZ,\n"
+"                                        g_MiscParams.fCascadeInd,\n"
+"                                        0u // Ignored\n"
+"                                        );\n"
+"#   else\n"
+"        float3 f3RayExtinction;\n"
+"        ComputeUnshadowedInscattering(f2PosPS,\n"
+"                                      fCamSpaceZ,\n"
+"                                      g_PPAttribs.uiInstrIntegralSteps,\n"
+"                                      g_PPAttribs.f4EarthCenter.xyz,\n"
+"                                      f3Inscattering,\n"
+"                                      f3RayExtinction);\n"
+"        f3Inscattering *= g_LightAttribs.f4Intensity.rgb;\n"
+"#   endif\n"
+"    }\n"
+"#endif\n"
+"\n"
+"    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);\n"
+"#if USE_TONE_MAPPING_LUT\n"
+"    g_rwtex2DDstColor[i2PixelPos] = float4(ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler), 1.0);\n"
+"#else\n"
+"    g_rwtex2DDstColor[i2PixelPos] = float4(ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum), 1.0);\n"
+"#endif\n"
+"}\n"
+"\n"
+"#endif\n"
+"\n"
+"\n"
 "//float3 FixInscatteredRadiancePS(FullScreenTriangleVSOutput VSOut) : SV_Target\n"
 "//{\n"
 "//    if( g_PPAttribs.bShowDepthBreaks )\n"
@@ -739,9 +926,7 @@
 "    {\n"
 "        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(VSOut.f4PixelPos.xy,0) ).rgb;\n"
 "        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);\n"
-"        float3 f3ReconstructedPosWS = ProjSpaceXYZToWorldSpace(float3(VSOut.f2NormalizedXY.xy, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
-"        float3 f3Extinction = GetExtinction(g_CameraAttribs.f4Position.xyz, f3ReconstructedPosWS, g_PPAttribs.f4EarthCenter.xyz,\n"
-"                                            g_MediaParams.fAtmBottomRadius, g_MediaParams.fAtmTopRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"        float3 f3Extinction = GetBackgroundExtinction(VSOut.f2NormalizedXY.xy, fCamSpaceZ);\n"
 "        f3BackgroundColor *= f3Extinction.rgb;\n"
 "    }\n"
 "\n"
@@ -768,7 +953,11 @@
 "    f4Color.rgb = (f3BackgroundColor + f3InsctrColor);\n"
 "#if PERFORM_TONE_MAPPING\n"
 "    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);\n"
+"#   if USE_TONE_MAPPING_LUT\n"
+"    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3InsctrColor, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);\n"
+"#   else\n"
 "    f4Color.rgb = ToneMap(f3BackgroundColor + f3InsctrColor, g_PPAttribs.ToneMapping, fAveLogLum);\n"
+"#   endif\n"
 "#else\n"
 "    const float MinLumn = 0.01;\n"
 "    float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3InsctrColor, MinLumn);\n"
@@ -20,6 +20,14 @@
 "    EpipolarLightScatteringAttribs g_PPAttribs;\n"
 "};\n"
 "\n"
+"#if COMPACT_RAY_MARCHING_SAMPLES\n"
+"// Compacted list of ray marching samples. Every element contains sample index\n"
+"// in the lower 16 bits and slice index in the higher 16 bits\n"
+"RWStructuredBuffer<uint> g_rwRayMarchingSampleList;\n"
+"// The first element contains the total number of samples in the list\n"
+"RWStructuredBuffer<uint> g_rwRayMarchingSampleCounter;\n"
+"#endif\n"
+"\n"
 "#include \"ToneMapping.fxh\"\n"
 "\n"
 "#ifndef INITIAL_SAMPLE_STEP\n"
@@ -34,6 +42,12 @@
 "#   define REFINEMENT_CRITERION REFINEMENT_CRITERION_INSCTR_DIFF\n"
 "#endif\n"
 "\n"
+"// Whether to use wave intrinsics. The host only enables this variant\n"
+"// when the wave size is at least 32 lanes\n"
+"#ifndef USE_WAVE_OPS\n"
+"#   define USE_WAVE_OPS 0\n"
+"#endif\n"
+"\n"
 "// In my first implementation I used group shared memory to store camera space z\n"
 "// values. This was a very low-performing method\n"
 "// After that I tried using arrays of bool flags instead, but this did not help very much\n"
@@ -64,17 +78,20 @@
 "\n"
 "    bool bIsValidThread = all( Less( abs(f2SampleLocationPS), (1.0 + 1e-4)*float2(1.0,1.0) ) );\n"
 "\n"
+"#if !USE_WAVE_OPS\n"
 "    // Initialize flags with zeroes\n"
 "    if( GTid.x < uint(NUM_PACKED_FLAGS) )\n"
 "        g_uiPackedCamSpaceDiffFlags[GTid.x] = 0u;\n"
 "\n"
 "    GroupMemoryBarrierWithGroupSync();\n"
+"#endif\n"
 "\n"
 "    // Let each thread in the group compute its own flag\n"
 "    // Note that if the sample is located behind the screen, its flag will be set to zero\n"
 "    // Besides, since g_tex2DEpipolarCamSpaceZ is cleared with invalid coordinates, the difference\n"
 "    // flag between valid and invalid locations will also be zero. Thus the sample next to invalid will always\n"
 "    // be marked as ray marching sample\n"
+"    bool bFlag = false;\n"
 "    [branch]\n"
 "    if( bIsValidThread )\n"
 "    {\n"
@@ -85,7 +102,7 @@
 "        float fMaxZ = max(fCamSpaceZ, fRightNeighbCamSpaceZ);\n"
 "        fMaxZ = max(fMaxZ, 1.0);\n"
 "        // Compare the difference with the threshold\n"
-"        bool bFlag = abs(fCamSpaceZ - fRightNeighbCamSpaceZ)/fMaxZ < 0.2*g_PPAttribs.fRefinementThreshold;\n"
+"        bFlag = abs(fCamSpaceZ - fRightNeighbCamSpaceZ)/fMaxZ < 0.2*g_PPAttribs.fRefinementThreshold;\n"
 "#elif REFINEMENT_CRITERION == REFINEMENT_CRITERION_INSCTR_DIFF\n"
 "        // Load inscattering for this sample and for its right neighbour\n"
 "        float3 f3Insctr0 = g_tex2DScatteredColor.Load( int3(uiGlobalSampleInd,         uiSliceInd, 0) );\n"
@@ -105,12 +122,24 @@
 "        f3MaxInsctr = max(f3MaxInsctr, f3MinInsctrThreshold);\n"
 "        // Compare the difference with the threshold. If the neighbour sample is invalid, its inscattering\n"
 "        // is large negative value and the difference is guaranteed to be larger than the threshold\n"
-"        bool bFlag = all( Less(abs(f3Insctr0 - f3Insctr1)/f3MaxInsctr, g_PPAttribs.fRefinementThreshold*float3(1.0,1.0,1.0) ) );\n"
+"        bFlag = all( Less(abs(f3Insctr0 - f3Insctr1)/f3MaxInsctr, g_PPAttribs.fRefinementThreshold*float3(1.0,1.0,1.0) ) );\n"
 "#endif\n"
+"#if !USE_WAVE_OPS\n"
 "        // Set appropriate flag using INTERLOCKED Or:\n"
 "        uint uiBit = bFlag ? (1u << (uiSampleInd % 32u)) : 0u;\n"
 "        InterlockedOr( g_uiPackedCamSpaceDiffFlags[int(uiSampleInd)/32], uiBit );\n"
+"#endif\n"
+"    }\n"
+"\n"
+"#if USE_WAVE_OPS\n"
+"    {\n"
+"        // Every 32 consecutive lanes of the wave produce one flag pack, so the whole pack\n"
+"        // is written by a single lane without initialization and atomic operations\n"
+"        uint4 ui4FlagBallot = WaveActiveBallot(bFlag);\n"
+"        if( (uiSampleInd % 32u) == 0u )\n"
+"            g_uiPackedCamSpaceDiffFlags[int(uiSampleInd)/32] = ui4FlagBallot[WaveGetLaneIndex() / 32u];\n"
 "    }\n"
+"#endif\n"
 "\n"
 "    // Synchronize threads in the group\n"
 "    GroupMemoryBarrierWithGroupSync();\n"
@@ -292,4 +321,30 @@
 "    }\n"
 "\n"
 "    g_rwtex2DInterpolationSource[ int2(uiGlobalSampleInd, uiSliceInd) ] = uint2(uiGroupStartGlobalInd + uiLeftSrcSampleInd, uiGroupStartGlobalInd + uiRightSrcSampleInd);\n"
+"\n"
+"#if COMPACT_RAY_MARCHING_SAMPLES\n"
+"    // Append ray marching samples to the compacted list so that ray marching\n"
+"    // only needs to be dispatched for these samples (see RayMarchCompactedSamplesCS())\n"
+"    bool bIsRayMarchingSample = uiLeftSrcSampleInd == uiSampleInd && uiRightSrcSampleInd == uiSampleInd;\n"
+"#   if USE_WAVE_OPS\n"
+"    {\n"
+"        // Reserve space for all ray marching samples in the wave with a single atomic operation\n"
+"        uint uiNumWaveSamples = WaveActiveCountBits(bIsRayMarchingSample);\n"
+"        uint uiWaveListStart = 0u;\n"
+"        if( WaveIsFirstLane() && uiNumWaveSamples > 0u )\n"
+"            InterlockedAdd(g_rwRayMarchingSampleCounter[0], uiNumWaveSamples, uiWaveListStart);\n"
+"        uiWaveListStart = WaveReadLaneFirst(uiWaveListStart);\n"
+"        uint uiListInd = uiWaveListStart + WavePrefixCountBits(bIsRayMarchingSample);\n"
+"        if( bIsRayMarchingSample )\n"
+"            g_rwRayMarchingSampleList[uiListInd] = uiGlobalSampleInd | (uiSliceInd << 16u);\n"
+"    }\n"
+"#   else\n"
+"    if( bIsRayMarchingSample )\n"
+"    {\n"
+"        uint uiListInd;\n"
+"        InterlockedAdd(g_rwRayMarchingSampleCounter[0], 1u, uiListInd);\n"
+"        g_rwRayMarchingSampleList[uiListInd] = uiGlobalSampleInd | (uiSliceInd << 16u);\n"
+"    }\n"
+"#   endif\n"
+"#endif\n"
 "}\n"
@@ -14,6 +14,32 @@
 "#   define USE_TEXTURE_ATLAS 0\n"
 "#endif\n"
 "\n"
+"#ifndef GLTF_PBR_USE_GPU_EXPOSURE\n"
+"#   define GLTF_PBR_USE_GPU_EXPOSURE 0\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_USE_SH_IRRADIANCE\n"
+"#   define GLTF_PBR_USE_SH_IRRADIANCE 0\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_MAX_REFLECTION_PROBES\n"
+"#   define GLTF_PBR_MAX_REFLECTION_PROBES 0\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"#   define GLTF_PBR_USE_TONE_MAPPING_LUT 0\n"
+"#endif\n"
+"\n"
+"// When set to 1, linear HDR color is written to the render target and tone mapping\n"
+"// is performed by a separate pass (see ToneMapGLTF_PBR.psh)\n"
+"#ifndef GLTF_PBR_OUTPUT_HDR\n"
+"#   define GLTF_PBR_OUTPUT_HDR 0\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_MAX_VIEWS\n"
+"#   define GLTF_PBR_MAX_VIEWS 1\n"
+"#endif\n"
+"\n"
 "cbuffer cbCameraAttribs\n"
 "{\n"
 "    CameraAttribs g_CameraAttribs;\n"
@@ -31,14 +57,37 @@
 "}\n"
 "\n"
 "#if GLTF_PBR_USE_IBL\n"
+"#   if GLTF_PBR_USE_SH_IRRADIANCE\n"
+"cbuffer cbIrradianceSH\n"
+"{\n"
+"    float4 g_IrradianceSH[9];\n"
+"}\n"
+"#   else\n"
 "TextureCube  g_IrradianceMap;\n"
 "SamplerState g_IrradianceMap_sampler;\n"
+"#   endif\n"
 "\n"
 "TextureCube  g_PrefilteredEnvMap;\n"
 "SamplerState g_PrefilteredEnvMap_sampler;\n"
 "\n"
 "Texture2D     g_BRDF_LUT;\n"
 "SamplerState  g_BRDF_LUT_sampler;\n"
+"\n"
+"#   if GLTF_PBR_MAX_REFLECTION_PROBES > 0\n"
+"cbuffer cbReflectionProbes\n"
+"{\n"
+"    // xyz - world-space probe position, w - influence radius (0 if the probe is not used)\n"
+"    float4 g_ReflectionProbes[GLTF_PBR_MAX_REFLECTION_PROBES];\n"
+"    // x - the number of mip levels of the prefiltered environment maps\n"
+"    float4 g_ReflectionProbeParams;\n"
+"}\n"
+"\n"
+"TextureCubeArray g_ProbeIrradianceMaps;\n"
+"SamplerState     g_ProbeIrradianceMaps_sampler;\n"
+"\n"
+"TextureCubeArray g_ProbePrefilteredEnvMaps;\n"
+"SamplerState     g_ProbePrefilteredEnvMaps_sampler;\n"
+"#   endif\n"
 "#endif\n"
 "\n"
 "Texture2DArray g_ColorMap;\n"
@@ -60,6 +109,16 @@
 "SamplerState   g_EmissiveMap_sampler;\n"
 "#endif\n"
 "\n"
+"#if GLTF_PBR_USE_GPU_EXPOSURE\n"
+"// Average scene luminance computed on the GPU (e.g. by the epipolar light scattering effect)\n"
+"Texture2D<float> g_AverageLuminance;\n"
+"#endif\n"
+"\n"
+"#if GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"Texture3D    g_ToneMappingLUT;\n"
+"SamplerState g_ToneMappingLUT_sampler;\n"
+"#endif\n"
+"\n"
 "float4 SampleGLTFTexture(Texture2DArray Tex,\n"
 "                         SamplerState   Tex_sampler,\n"
 "                         float2         UV0,\n"
@@ -84,11 +143,78 @@
 "    return Tex.Sample(Tex_sampler, float3(UV, Slice));\n"
 "}\n"
 "\n"
+"#if GLTF_PBR_USE_IBL && GLTF_PBR_MAX_REFLECTION_PROBES > 0\n"
+"// Blends the samples of the two local reflection probes with the highest weights at\n"
+"// the given position with the samples of the global environment maps.\n"
+"void BlendReflectionProbes(in    float3 WorldPos,\n"
+"                           in    float3 n,\n"
+"                           in    float3 reflection,\n"
+"                           in    float  PerceptualRoughness,\n"
+"                           inout float4 diffuseSample,\n"
+"                           inout float4 specularSample)\n"
+"{\n"
+"    int   Probe0  = -1;\n"
+"    int   Probe1  = -1;\n"
+"    float Weight0 = 0.0;\n"
+"    float Weight1 = 0.0;\n"
+"    for (int i = 0; i < GLTF_PBR_MAX_REFLECTION_PROBES; ++i)\n"
+"    {\n"
+"        float4 f4PosRadius = g_ReflectionProbes[i];\n"
+"        if (f4PosRadius.w <= 0.0)\n"
+"            continue;\n"
+"\n"
+"        // The weight falls off linearly to zero at the influence radius\n"
+"        float Weight = saturate(1.0 - length(WorldPos - f4PosRadius.xyz) / f4PosRadius.w);\n"
+"        if (Weight > Weight0)\n"
+"        {\n"
+"            Probe1  = Probe0;\n"
+"            Weight1 = Weight0;\n"
+"            Probe0  = i;\n"
+"            Weight0 = Weight;\n"
+"        }\n"
+"        else if (Weight > Weight1)\n"
+"        {\n"
+"            Probe1  = i;\n"
+"            Weight1 = Weight;\n"
+"        }\n"
+"    }\n"
+"\n"
+"    float TotalWeight = Weight0 + Weight1;\n"
+"    if (TotalWeight <= 0.0)\n"
+"        return;\n"
+"\n"
+"    // Where probes overlap, they replace the global environment completely\n"
+"    if (TotalWeight > 1.0)\n"
+"    {\n"
+"        Weight0 /= TotalWeight;\n"
+"        Weight1 /= TotalWeight;\n"
+"        TotalWeight = 1.0;\n"
+"    }\n"
+"\n"
+"    float MipLevels = g_ReflectionProbeParams.x;\n"
+"    float lod       = clamp(PerceptualRoughness * MipLevels, 0.0, MipLevels);\n"
+"\n"
+"    // Explicit LODs are used as the samples are taken in non-uniform control flow\n"
+"    diffuseSample  *= 1.0 - TotalWeight;\n"
+"    specularSample *= 1.0 - TotalWeight;\n"
+"    diffuseSample  += g_ProbeIrradianceMaps.SampleLevel(g_ProbeIrradianceMaps_sampler, float4(n, float(Probe0)), 0.0) * Weight0;\n"
+"    specularSample += g_ProbePrefilteredEnvMaps.SampleLevel(g_ProbePrefilteredEnvMaps_sampler, float4(reflection, float(Probe0)), lod) * Weight0;\n"
+"    if (Weight1 > 0.0)\n"
+"    {\n"
+"        diffuseSample  += g_ProbeIrradianceMaps.SampleLevel(g_ProbeIrradianceMaps_sampler, float4(n, float(Probe1)), 0.0) * Weight1;\n"
+"        specularSample += g_ProbePrefilteredEnvMaps.SampleLevel(g_ProbePrefilteredEnvMaps_sampler, float4(reflection, float(Probe1)), lod) * Weight1;\n"
+"    }\n"
+"}\n"
+"#endif\n"
+"\n"
 "void main(in  float4 ClipPos     : SV_Position,\n"
 "          in  float3 WorldPos    : WORLD_POS,\n"
 "          in  float3 Normal      : NORMAL,\n"
 "          in  float2 UV0         : UV0,\n"
 "          in  float2 UV1         : UV1,\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"          in  float3 CameraPos   : CAMERA_POS,\n"
+"#endif\n"
 "          in  bool   IsFrontFace : SV_IsFrontFace,\n"
 "          out float4 OutColor    : SV_Target)\n"
 "{\n"
@@ -156,7 +282,11 @@
 "    // LIGHTING\n"
 "    float3 perturbedNormal = GLTF_PBR_PerturbNormal(dWorldPos_dx, dWorldPos_dy, dNormalMapUV_dx, dNormalMapUV_dy,\n"
 "                                                    Normal, TSNormal, g_MaterialInfo.NormalTextureUVSelector >= 0.0, IsFrontFace);\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"    float3 view = normalize(CameraPos - WorldPos.xyz); // Direction from surface point to camera\n"
+"#else\n"
 "    float3 view = normalize(g_CameraAttribs.f4Position.xyz - WorldPos.xyz); // Direction from surface point to camera\n"
+"#endif\n"
 "\n"
 "    float3 color = float3(0.0, 0.0, 0.0);\n"
 "    color += GLTF_PBR_ApplyDirectionalLight(g_LightAttribs.f4Direction.xyz, g_LightAttribs.f4Intensity.rgb, SrfInfo, perturbedNormal, view);\n"
@@ -187,11 +317,33 @@
 "    IBLContrib.f3Diffuse  = float3(0.0, 0.0, 0.0);\n"
 "    IBLContrib.f3Specular = float3(0.0, 0.0, 0.0);\n"
 "#if GLTF_PBR_USE_IBL\n"
+"#   if GLTF_PBR_MAX_REFLECTION_PROBES > 0\n"
+"    {\n"
+"        float  PrefilteredCubeMipLevels = float(g_RenderParameters.PrefilteredCubeMipLevels);\n"
+"        float  lod        = clamp(SrfInfo.PerceptualRoughness * PrefilteredCubeMipLevels, 0.0, PrefilteredCubeMipLevels);\n"
+"        float3 reflection = normalize(reflect(-view, perturbedNormal));\n"
+"#       if GLTF_PBR_USE_SH_IRRADIANCE\n"
+"        float4 diffuseSample  = float4(GLTF_PBR_EvaluateIrradianceSH(perturbedNormal, g_IrradianceSH), 1.0);\n"
+"#       else\n"
+"        float4 diffuseSample  = g_IrradianceMap.Sample(g_IrradianceMap_sampler, perturbedNormal);\n"
+"#       endif\n"
+"        float4 specularSample = g_PrefilteredEnvMap.SampleLevel(g_PrefilteredEnvMap_sampler, reflection, lod);\n"
+"        BlendReflectionProbes(WorldPos, perturbedNormal, reflection, SrfInfo.PerceptualRoughness, diffuseSample, specularSample);\n"
+"        IBLContrib = GLTF_PBR_CombineIBLSamples(SrfInfo, perturbedNormal, view, g_BRDF_LUT, g_BRDF_LUT_sampler, diffuseSample, specularSample);\n"
+"    }\n"
+"#   elif GLTF_PBR_USE_SH_IRRADIANCE\n"
+"    IBLContrib =\n"
+"        GLTF_PBR_GetIBLContributionSH(SrfInfo, perturbedNormal, view, float(g_RenderParameters.PrefilteredCubeMipLevels),\n"
+"                           g_BRDF_LUT,          g_BRDF_LUT_sampler,\n"
+"                           g_IrradianceSH,\n"
+"                           g_PrefilteredEnvMap, g_PrefilteredEnvMap_sampler);\n"
+"#   else\n"
 "    IBLContrib =\n"
 "        GLTF_PBR_GetIBLContribution(SrfInfo, perturbedNormal, view, float(g_RenderParameters.PrefilteredCubeMipLevels),\n"
 "                           g_BRDF_LUT,          g_BRDF_LUT_sampler,\n"
 "                           g_IrradianceMap,     g_IrradianceMap_sampler,\n"
 "                           g_PrefilteredEnvMap, g_PrefilteredEnvMap_sampler);\n"
+"#   endif\n"
 "    color += (IBLContrib.f3Diffuse + IBLContrib.f3Specular) * g_RenderParameters.IBLScale;\n"
 "#endif\n"
 "\n"
@@ -205,6 +357,7 @@
 "    color += Emissive.rgb * g_MaterialInfo.EmissiveFactor.rgb * g_RenderParameters.EmissionScale;\n"
 "#endif\n"
 "\n"
+"#if !GLTF_PBR_OUTPUT_HDR\n"
 "    ToneMappingAttribs TMAttribs;\n"
 "    TMAttribs.iToneMappingMode     = TONE_MAPPING_MODE_UNCHARTED2;\n"
 "    TMAttribs.bAutoExposure        = false;\n"
@@ -212,7 +365,18 @@
 "    TMAttribs.bLightAdaptation     = false;\n"
 "    TMAttribs.fWhitePoint          = g_RenderParameters.WhitePoint;\n"
 "    TMAttribs.fLuminanceSaturation = 1.0;\n"
-"    color = ToneMap(color, TMAttribs, g_RenderParameters.AverageLogLum);\n"
+"#if GLTF_PBR_USE_GPU_EXPOSURE\n"
+"    // Average luminance is an approximation to the key of the scene\n"
+"    float AverageLogLum = max(g_AverageLuminance.Load(int3(0,0,0)), 0.05);\n"
+"#else\n"
+"    float AverageLogLum = g_RenderParameters.AverageLogLum;\n"
+"#endif\n"
+"#if GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"    color = ToneMapLUT(color, TMAttribs.fMiddleGray, AverageLogLum, g_ToneMappingLUT, g_ToneMappingLUT_sampler);\n"
+"#else\n"
+"    color = ToneMap(color, TMAttribs, AverageLogLum);\n"
+"#endif\n"
+"#endif\n"
 "    OutColor = float4(color, BaseColor.a);\n"
 "\n"
 "#if ALLOW_DEBUG_VIEW\n"
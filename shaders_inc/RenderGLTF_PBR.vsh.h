@@ -11,10 +11,27 @@
 "    float4 Weight0 : ATTRIB5;\n"
 "};\n"
 "\n"
+"#ifndef GLTF_PBR_MAX_VIEWS\n"
+"#   define GLTF_PBR_MAX_VIEWS 1\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_MULTI_VIEW_VIEWPORTS\n"
+"#   define GLTF_PBR_MULTI_VIEW_VIEWPORTS 0\n"
+"#endif\n"
+"\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"// Every draw call is instanced across the views; the instance index selects the view\n"
+"cbuffer cbViews\n"
+"{\n"
+"    float4x4 g_ViewProj[GLTF_PBR_MAX_VIEWS];\n"
+"    float4   g_ViewCameraPos[GLTF_PBR_MAX_VIEWS];\n"
+"}\n"
+"#else\n"
 "cbuffer cbCameraAttribs\n"
 "{\n"
 "    CameraAttribs g_CameraAttribs;\n"
 "}\n"
+"#endif\n"
 "\n"
 "cbuffer cbTransforms\n"
 "{\n"
@@ -31,11 +48,23 @@
 "}\n"
 "\n"
 "void main(in  GLTF_VS_Input  VSIn,\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"          in  uint   InstanceID : SV_InstanceID,\n"
+"#endif\n"
 "          out float4 ClipPos  : SV_Position,\n"
 "          out float3 WorldPos : WORLD_POS,\n"
 "          out float3 Normal   : NORMAL,\n"
 "          out float2 UV0      : UV0,\n"
-"          out float2 UV1      : UV1)\n"
+"          out float2 UV1      : UV1\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"        , out float3 CameraPos : CAMERA_POS\n"
+"#   if GLTF_PBR_MULTI_VIEW_VIEWPORTS\n"
+"        , out uint   ViewIndex : SV_ViewportArrayIndex\n"
+"#   else\n"
+"        , out uint   ViewIndex : SV_RenderTargetArrayIndex\n"
+"#   endif\n"
+"#endif\n"
+"          )\n"
 "{\n"
 "    // Warning: moving this block into GLTF_TransformVertex() function causes huge\n"
 "    // performance degradation on Vulkan because glslang/SPIRV-Tools are apparently not able\n"
@@ -54,7 +83,13 @@
 "\n"
 "    GLTF_TransformedVertex TransformedVert = GLTF_TransformVertex(VSIn.Pos, VSIn.Normal, Transform);\n"
 "\n"
+"#if GLTF_PBR_MAX_VIEWS > 1\n"
+"    ClipPos   = mul(float4(TransformedVert.WorldPos, 1.0), g_ViewProj[InstanceID]);\n"
+"    CameraPos = g_ViewCameraPos[InstanceID].xyz;\n"
+"    ViewIndex = InstanceID;\n"
+"#else\n"
 "    ClipPos  = mul(float4(TransformedVert.WorldPos, 1.0), g_CameraAttribs.mViewProj);\n"
+"#endif\n"
 "    WorldPos = TransformedVert.WorldPos;\n"
 "    Normal   = TransformedVert.Normal;\n"
 "    UV0      = VSIn.UV0;\n"
@@ -0,0 +1,149 @@
+"// SkyViewAndAerialPerspective.fx\n"
+"// Computes the per-frame sky-view and aerial perspective tables that contain unshadowed\n"
+"// inscattering and extinction as seen from the current camera position, and the low-resolution\n"
+"// sky cube map used as the environment map for image-based lighting\n"
+"\n"
+"#include \"BasicStructures.fxh\"\n"
+"#include \"AtmosphereShadersCommon.fxh\"\n"
+"\n"
+"cbuffer cbParticipatingMediaScatteringParams\n"
+"{\n"
+"    AirScatteringAttribs g_MediaParams;\n"
+"}\n"
+"\n"
+"cbuffer cbCameraAttribs\n"
+"{\n"
+"    CameraAttribs g_CameraAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbLightParams\n"
+"{\n"
+"    LightAttribs g_LightAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbPostProcessingAttribs\n"
+"{\n"
+"    EpipolarLightScatteringAttribs g_PPAttribs;\n"
+"}\n"
+"\n"
+"#ifndef SKY_VIEW_LUT_DIM\n"
+"#   define SKY_VIEW_LUT_DIM float2(192.0, 108.0)\n"
+"#endif\n"
+"\n"
+"#ifndef SKY_CUBEMAP_DIM\n"
+"#   define SKY_CUBEMAP_DIM 64\n"
+"#endif\n"
+"\n"
+"#ifndef THREAD_GROUP_SIZE\n"
+"#   define THREAD_GROUP_SIZE 8\n"
+"#endif\n"
+"\n"
+"// The tables are computed here, so they must not be used\n"
+"#undef  USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"#define USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS 0\n"
+"\n"
+"Texture2D<float2> g_tex2DOccludedNetDensityToAtmTop;\n"
+"SamplerState      g_tex2DOccludedNetDensityToAtmTop_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DSingleSctrLUT;\n"
+"SamplerState      g_tex3DSingleSctrLUT_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DHighOrderSctrLUT;\n"
+"SamplerState      g_tex3DHighOrderSctrLUT_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DMultipleSctrLUT;\n"
+"SamplerState      g_tex3DMultipleSctrLUT_sampler;\n"
+"\n"
+"RWTexture2D<float4 /*format = rgba16f*/> g_rwtex2DSkyViewInsctr;\n"
+"RWTexture2D<float4 /*format = rgba8*/>   g_rwtex2DSkyViewExtinction;\n"
+"\n"
+"RWTexture3D<float4 /*format = rgba16f*/> g_rwtex3DAerialPerspectiveInsctr;\n"
+"RWTexture3D<float4 /*format = rgba8*/>   g_rwtex3DAerialPerspectiveExtinction;\n"
+"\n"
+"RWTexture2DArray<float4 /*format = rgba16f*/> g_rwtex2DSkyCubemap;\n"
+"\n"
+"#include \"LookUpTables.fxh\"\n"
+"#include \"ScatteringIntegrals.fxh\"\n"
+"#include \"Extinction.fxh\"\n"
+"#include \"SkyViewAndAerialPerspective.fxh\"\n"
+"#include \"UnshadowedScattering.fxh\"\n"
+"\n"
+"[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]\n"
+"void ComputeSkyViewLUTCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    if( float(DTid.x) >= SKY_VIEW_LUT_DIM.x || float(DTid.y) >= SKY_VIEW_LUT_DIM.y )\n"
+"        return;\n"
+"\n"
+"    float3 f3CameraPos   = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;\n"
+"\n"
+"    float3 f3Zenith, f3Forward, f3Side;\n"
+"    GetSkyViewBasis(f3CameraPos, f3EarthCentre, -g_LightAttribs.f4Direction.xyz, f3Zenith, f3Forward, f3Side);\n"
+"    float2 f2UV = (float2(DTid.xy) + float2(0.5, 0.5)) / SKY_VIEW_LUT_DIM;\n"
+"    float3 f3ViewDir = SkyViewUVToDir(f2UV, f3Zenith, f3Forward, f3Side, GetSkyViewHorizonZenithAngle(length(f3CameraPos - f3EarthCentre)));\n"
+"\n"
+"    float3 f3Inscattering, f3Extinction;\n"
+"    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, +FLT_MAX, g_PPAttribs.uiInstrIntegralSteps, f3EarthCentre, f3Inscattering, f3Extinction);\n"
+"\n"
+"    g_rwtex2DSkyViewInsctr[DTid.xy]     = float4(f3Inscattering, 0.0);\n"
+"    g_rwtex2DSkyViewExtinction[DTid.xy] = float4(f3Extinction, 0.0);\n"
+"}\n"
+"\n"
+"[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]\n"
+"void ComputeAerialPerspectiveLUTCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    uint uiResolution = g_PPAttribs.uiAerialPerspectiveLUTResolution;\n"
+"    if( DTid.x >= uiResolution || DTid.y >= uiResolution )\n"
+"        return;\n"
+"\n"
+"    float2 f2PosPS     = TexUVToNormalizedDeviceXY( (float2(DTid.xy) + float2(0.5, 0.5)) / float(uiResolution) );\n"
+"    float  fCamSpaceZ  = float(DTid.z + 1u) / float(g_PPAttribs.uiAerialPerspectiveLUTDepth) * g_PPAttribs.fAerialPerspectiveLUTMaxDist;\n"
+"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3PosWS     = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"    float3 f3ViewDir   = f3PosWS - f3CameraPos;\n"
+"    float  fRayLength  = length(f3ViewDir);\n"
+"    f3ViewDir /= fRayLength;\n"
+"\n"
+"    float3 f3Inscattering, f3Extinction;\n"
+"    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, fRayLength, g_PPAttribs.uiInstrIntegralSteps, g_PPAttribs.f4EarthCenter.xyz, f3Inscattering, f3Extinction);\n"
+"\n"
+"    g_rwtex3DAerialPerspectiveInsctr[DTid]     = float4(f3Inscattering, 0.0);\n"
+"    g_rwtex3DAerialPerspectiveExtinction[DTid] = float4(f3Extinction, 0.0);\n"
+"}\n"
+"\n"
+"// Returns the direction that corresponds to the texel of the cube map face (D3D face order and orientation)\n"
+"float3 GetSkyCubemapDirection(uint3 Texel)\n"
+"{\n"
+"    float2 f2UV = (float2(Texel.xy) + float2(0.5, 0.5)) / float(SKY_CUBEMAP_DIM) * 2.0 - float2(1.0, 1.0);\n"
+"    float3 f3Dir;\n"
+"    if (Texel.z == 0u)\n"
+"        f3Dir = float3(+1.0, -f2UV.y, -f2UV.x);\n"
+"    else if (Texel.z == 1u)\n"
+"        f3Dir = float3(-1.0, -f2UV.y, +f2UV.x);\n"
+"    else if (Texel.z == 2u)\n"
+"        f3Dir = float3(+f2UV.x, +1.0, +f2UV.y);\n"
+"    else if (Texel.z == 3u)\n"
+"        f3Dir = float3(+f2UV.x, -1.0, -f2UV.y);\n"
+"    else if (Texel.z == 4u)\n"
+"        f3Dir = float3(+f2UV.x, -f2UV.y, +1.0);\n"
+"    else\n"
+"        f3Dir = float3(-f2UV.x, -f2UV.y, -1.0);\n"
+"    return normalize(f3Dir);\n"
+"}\n"
+"\n"
+"// Renders the sky radiance as seen from the camera position into the cube map that can be used\n"
+"// as the environment map for image-based lighting. The sun disk is not included.\n"
+"[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]\n"
+"void RenderSkyCubemapCS(uint3 DTid : SV_DispatchThreadID)\n"
+"{\n"
+"    if( DTid.x >= uint(SKY_CUBEMAP_DIM) || DTid.y >= uint(SKY_CUBEMAP_DIM) )\n"
+"        return;\n"
+"\n"
+"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3ViewDir   = GetSkyCubemapDirection(DTid);\n"
+"\n"
+"    float3 f3Inscattering, f3Extinction;\n"
+"    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, +FLT_MAX, g_PPAttribs.uiInstrIntegralSteps, g_PPAttribs.f4EarthCenter.xyz, f3Inscattering, f3Extinction);\n"
+"\n"
+"    g_rwtex2DSkyCubemap[DTid] = float4(f3Inscattering * g_LightAttribs.f4Intensity.rgb, 1.0);\n"
+"}\n"
@@ -0,0 +1,162 @@
+"// SkyViewAndAerialPerspective.fxh\n"
+"// Parameterization of and look-ups into the per-frame sky-view and aerial perspective tables\n"
+"// that contain unshadowed inscattering and extinction (see SkyViewAndAerialPerspective.fx)\n"
+"\n"
+"// The sky-view table is parameterized by the view azimuth relative to the light and the view\n"
+"// zenith angle at the camera location. Scattering is symmetric with respect to the plane that\n"
+"// contains the zenith and the direction on light, so only azimuths in [0, pi] are stored.\n"
+"void GetSkyViewBasis(in  float3 f3CameraPos,\n"
+"                     in  float3 f3EarthCentre,\n"
+"                     in  float3 f3DirOnLight,\n"
+"                     out float3 f3Zenith,\n"
+"                     out float3 f3Forward,\n"
+"                     out float3 f3Side)\n"
+"{\n"
+"    f3Zenith = normalize(f3CameraPos - f3EarthCentre);\n"
+"    f3Forward = f3DirOnLight - f3Zenith * dot(f3DirOnLight, f3Zenith);\n"
+"    float fForwardLen = length(f3Forward);\n"
+"    // When the light is in the zenith or in the nadir, any horizontal direction can be used\n"
+"    f3Forward = fForwardLen > 1e-4 ?\n"
+"        f3Forward / fForwardLen :\n"
+"        normalize( cross(f3Zenith, abs(f3Zenith.x) < 0.9 ? float3(1.0, 0.0, 0.0) : float3(0.0, 0.0, 1.0)) );\n"
+"    f3Side = cross(f3Zenith, f3Forward);\n"
+"}\n"
+"\n"
+"// Returns the zenith angle of the horizon seen from the given distance to the Earth centre\n"
+"float GetSkyViewHorizonZenithAngle(float fDistToEarthCentre)\n"
+"{\n"
+"    return PI - asin( g_MediaParams.fAtmBottomRadius / max(fDistToEarthCentre, g_MediaParams.fAtmBottomRadius) );\n"
+"}\n"
+"\n"
+"// The upper half of the table covers directions above the horizon, the lower half covers directions\n"
+"// below it. Square root mapping concentrates texels near the horizon where scattering changes rapidly:\n"
+"//\n"
+"//   0      zenith\n"
+"//   0.5    horizon\n"
+"//   1      nadir\n"
+"//\n"
+"float2 SkyViewDirToUV(float3 f3ViewDir,\n"
+"                      float3 f3Zenith,\n"
+"                      float3 f3Forward,\n"
+"                      float3 f3Side,\n"
+"                      float  fHorizonZenithAngle)\n"
+"{\n"
+"    float fAzimuth     = atan2( abs(dot(f3ViewDir, f3Side)), dot(f3ViewDir, f3Forward) );\n"
+"    float fZenithAngle = acos( clamp(dot(f3ViewDir, f3Zenith), -1.0, 1.0) );\n"
+"\n"
+"    float2 f2UV;\n"
+"    f2UV.x = fAzimuth / PI;\n"
+"    f2UV.y = fZenithAngle < fHorizonZenithAngle ?\n"
+"        0.5 * (1.0 - sqrt( saturate(1.0 - fZenithAngle / fHorizonZenithAngle) )) :\n"
+"        0.5 * (1.0 + sqrt( saturate((fZenithAngle - fHorizonZenithAngle) / (PI - fHorizonZenithAngle)) ));\n"
+"    return f2UV;\n"
+"}\n"
+"\n"
+"float3 SkyViewUVToDir(float2 f2UV,\n"
+"                      float3 f3Zenith,\n"
+"                      float3 f3Forward,\n"
+"                      float3 f3Side,\n"
+"                      float  fHorizonZenithAngle)\n"
+"{\n"
+"    float fAzimuth = f2UV.x * PI;\n"
+"    float fZenithAngle;\n"
+"    if( f2UV.y < 0.5 )\n"
+"    {\n"
+"        float s = 1.0 - 2.0 * f2UV.y;\n"
+"        fZenithAngle = (1.0 - s * s) * fHorizonZenithAngle;\n"
+"    }\n"
+"    else\n"
+"    {\n"
+"        float s = 2.0 * f2UV.y - 1.0;\n"
+"        fZenithAngle = fHorizonZenithAngle + s * s * (PI - fHorizonZenithAngle);\n"
+"    }\n"
+"    return f3Zenith * cos(fZenithAngle) + (f3Forward * cos(fAzimuth) + f3Side * sin(fAzimuth)) * sin(fZenithAngle);\n"
+"}\n"
+"\n"
+"// Slice k of the aerial perspective table contains scattering between the camera and the\n"
+"// camera space z (k + 1) / Depth * MaxDist. Returns the fractional slice index for the given z\n"
+"float CamSpaceZToAerialPerspectiveSlice(float fCamSpaceZ)\n"
+"{\n"
+"    return fCamSpaceZ / g_PPAttribs.fAerialPerspectiveLUTMaxDist * float(g_PPAttribs.uiAerialPerspectiveLUTDepth);\n"
+"}\n"
+"\n"
+"\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"\n"
+"void LookUpSkyView(in  float3 f3ViewDir,\n"
+"                   out float3 f3Inscattering,\n"
+"                   out float3 f3Extinction)\n"
+"{\n"
+"    float3 f3CameraPos   = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3EarthCentre = g_PPAttribs.f4EarthCenter.xyz;\n"
+"\n"
+"    float3 f3Zenith, f3Forward, f3Side;\n"
+"    GetSkyViewBasis(f3CameraPos, f3EarthCentre, -g_LightAttribs.f4Direction.xyz, f3Zenith, f3Forward, f3Side);\n"
+"    float2 f2UV = SkyViewDirToUV(f3ViewDir, f3Zenith, f3Forward, f3Side, GetSkyViewHorizonZenithAngle(length(f3CameraPos - f3EarthCentre)));\n"
+"\n"
+"    f3Inscattering = g_tex2DSkyViewInsctr.SampleLevel(g_tex2DSkyViewInsctr_sampler, f2UV, 0.0).rgb;\n"
+"    f3Extinction   = g_tex2DSkyViewExtinction.SampleLevel(g_tex2DSkyViewExtinction_sampler, f2UV, 0.0).rgb;\n"
+"}\n"
+"\n"
+"void LookUpAerialPerspective(in  float2 f2PosPS,\n"
+"                             in  float  fCamSpaceZ,\n"
+"                             out float3 f3Inscattering,\n"
+"                             out float3 f3Extinction)\n"
+"{\n"
+"    float  fSlice = CamSpaceZToAerialPerspectiveSlice(fCamSpaceZ);\n"
+"    float3 f3UVW  = float3(NormalizedDeviceXYToTexUV(f2PosPS), (fSlice - 0.5) / float(g_PPAttribs.uiAerialPerspectiveLUTDepth));\n"
+"    // Fade scattering out between the camera and the first slice\n"
+"    float fWeight = saturate(fSlice);\n"
+"    f3Inscattering = g_tex3DAerialPerspectiveInsctr.SampleLevel(g_tex3DAerialPerspectiveInsctr_sampler, f3UVW, 0.0).rgb * fWeight;\n"
+"    f3Extinction   = lerp( float3(1.0, 1.0, 1.0),\n"
+"                           g_tex3DAerialPerspectiveExtinction.SampleLevel(g_tex3DAerialPerspectiveExtinction_sampler, f3UVW, 0.0).rgb,\n"
+"                           fWeight );\n"
+"}\n"
+"\n"
+"// Looks up unshadowed inscattering and extinction from the camera to the given screen location.\n"
+"// Returns false if the location is not covered by the tables.\n"
+"bool LookUpSkyViewAndAerialPerspective(in  float2 f2PosPS,\n"
+"                                       in  float  fCamSpaceZ,\n"
+"                                       out float3 f3Inscattering,\n"
+"                                       out float3 f3Extinction)\n"
+"{\n"
+"    f3Inscattering = float3(0.0, 0.0, 0.0);\n"
+"    f3Extinction   = float3(1.0, 1.0, 1.0);\n"
+"\n"
+"    // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"    if( fCamSpaceZ > g_CameraAttribs.fFarPlaneZ )\n"
+"    {\n"
+"        float3 f3PosWS = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"        LookUpSkyView(normalize(f3PosWS - g_CameraAttribs.f4Position.xyz), f3Inscattering, f3Extinction);\n"
+"        return true;\n"
+"    }\n"
+"    else if( fCamSpaceZ <= g_PPAttribs.fAerialPerspectiveLUTMaxDist )\n"
+"    {\n"
+"        LookUpAerialPerspective(f2PosPS, fCamSpaceZ, f3Inscattering, f3Extinction);\n"
+"        return true;\n"
+"    }\n"
+"\n"
+"    return false;\n"
+"}\n"
+"\n"
+"#endif\n"
+"\n"
+"\n"
+"// Returns extinction of the light reflected from the background towards the camera\n"
+"float3 GetBackgroundExtinction(float2 f2PosPS, float fCamSpaceZ)\n"
+"{\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"    // Note that the sky is attenuated up to the far plane, which is not what the sky-view table contains\n"
+"    [branch]\n"
+"    if( fCamSpaceZ <= g_CameraAttribs.fFarPlaneZ && fCamSpaceZ <= g_PPAttribs.fAerialPerspectiveLUTMaxDist )\n"
+"    {\n"
+"        float3 f3Inscattering, f3Extinction;\n"
+"        LookUpAerialPerspective(f2PosPS, fCamSpaceZ, f3Inscattering, f3Extinction);\n"
+"        return f3Extinction;\n"
+"    }\n"
+"#endif\n"
+"\n"
+"    float3 f3ReconstructedPosWS = ProjSpaceXYZToWorldSpace(float3(f2PosPS, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv);\n"
+"    return GetExtinction(g_CameraAttribs.f4Position.xyz, f3ReconstructedPosWS, g_PPAttribs.f4EarthCenter.xyz,\n"
+"                         g_MediaParams.fAtmBottomRadius, g_MediaParams.fAtmTopRadius, g_MediaParams.f4ParticleScaleHeight);\n"
+"}\n"
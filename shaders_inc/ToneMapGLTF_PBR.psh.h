@@ -0,0 +1,58 @@
+"// Tone maps linear HDR color written by the GLTF renderer in HDR output mode.\n"
+"// Tone mapping parameters match the per-fragment tone mapping in RenderGLTF_PBR.psh.\n"
+"\n"
+"#include \"FullScreenTriangleVSOutput.fxh\"\n"
+"#include \"ToneMapping.fxh\"\n"
+"\n"
+"#ifndef GLTF_PBR_USE_GPU_EXPOSURE\n"
+"#   define GLTF_PBR_USE_GPU_EXPOSURE 0\n"
+"#endif\n"
+"\n"
+"#ifndef GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"#   define GLTF_PBR_USE_TONE_MAPPING_LUT 0\n"
+"#endif\n"
+"\n"
+"cbuffer cbToneMappingAttribs\n"
+"{\n"
+"    float g_AverageLogLum;\n"
+"    float g_MiddleGray;\n"
+"    float g_WhitePoint;\n"
+"    float g_Padding;\n"
+"}\n"
+"\n"
+"Texture2D<float4> g_HDRColor;\n"
+"\n"
+"#if GLTF_PBR_USE_GPU_EXPOSURE\n"
+"Texture2D<float> g_AverageLuminance;\n"
+"#endif\n"
+"\n"
+"#if GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"Texture3D    g_ToneMappingLUT;\n"
+"SamplerState g_ToneMappingLUT_sampler;\n"
+"#endif\n"
+"\n"
+"void main(in  FullScreenTriangleVSOutput VSOut,\n"
+"          out float4                     OutColor : SV_Target)\n"
+"{\n"
+"    float4 HDRColor = g_HDRColor.Load(int3(VSOut.f4PixelPos.xy, 0));\n"
+"\n"
+"    ToneMappingAttribs TMAttribs;\n"
+"    TMAttribs.iToneMappingMode     = TONE_MAPPING_MODE_UNCHARTED2;\n"
+"    TMAttribs.bAutoExposure        = false;\n"
+"    TMAttribs.fMiddleGray          = g_MiddleGray;\n"
+"    TMAttribs.bLightAdaptation     = false;\n"
+"    TMAttribs.fWhitePoint          = g_WhitePoint;\n"
+"    TMAttribs.fLuminanceSaturation = 1.0;\n"
+"#if GLTF_PBR_USE_GPU_EXPOSURE\n"
+"    // Average luminance is an approximation to the key of the scene\n"
+"    float AverageLogLum = max(g_AverageLuminance.Load(int3(0,0,0)), 0.05);\n"
+"#else\n"
+"    float AverageLogLum = g_AverageLogLum;\n"
+"#endif\n"
+"#if GLTF_PBR_USE_TONE_MAPPING_LUT\n"
+"    OutColor.rgb = ToneMapLUT(HDRColor.rgb, TMAttribs.fMiddleGray, AverageLogLum, g_ToneMappingLUT, g_ToneMappingLUT_sampler);\n"
+"#else\n"
+"    OutColor.rgb = ToneMap(HDRColor.rgb, TMAttribs, AverageLogLum);\n"
+"#endif\n"
+"    OutColor.a = HDRColor.a;\n"
+"}\n"
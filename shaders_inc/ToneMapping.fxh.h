@@ -84,3 +84,46 @@
 "\n"
 "#endif\n"
 "}\n"
+"\n"
+"// Tone mapping look-up table is indexed by log2-encoded exposed color, see ToneMappingLUT class.\n"
+"// Exposed colors outside of the range are clamped.\n"
+"#ifndef TONE_MAPPING_LUT_DIM\n"
+"#   define TONE_MAPPING_LUT_DIM 32\n"
+"#endif\n"
+"\n"
+"#ifndef TONE_MAPPING_LUT_MIN_LOG2\n"
+"#   define TONE_MAPPING_LUT_MIN_LOG2 -12.0\n"
+"#endif\n"
+"\n"
+"#ifndef TONE_MAPPING_LUT_MAX_LOG2\n"
+"#   define TONE_MAPPING_LUT_MAX_LOG2 8.0\n"
+"#endif\n"
+"\n"
+"float3 ExposedColorToToneMappingLUTCoord(float3 f3ExposedColor)\n"
+"{\n"
+"    float3 f3Log2Color = log2(max(f3ExposedColor, float3(1e-10, 1e-10, 1e-10)));\n"
+"    float3 f3NormColor = saturate((f3Log2Color - TONE_MAPPING_LUT_MIN_LOG2) / (TONE_MAPPING_LUT_MAX_LOG2 - TONE_MAPPING_LUT_MIN_LOG2));\n"
+"    // Map [0, 1] range to the centers of the first and the last texels\n"
+"    return (f3NormColor * (float(TONE_MAPPING_LUT_DIM) - 1.0) + 0.5) / float(TONE_MAPPING_LUT_DIM);\n"
+"}\n"
+"\n"
+"// Returns the exposed color that corresponds to the center of the LUT texel\n"
+"float3 ToneMappingLUTTexelToExposedColor(uint3 u3Texel)\n"
+"{\n"
+"    float3 f3NormColor = float3(u3Texel) / (float(TONE_MAPPING_LUT_DIM) - 1.0);\n"
+"    return exp2(lerp(float3(TONE_MAPPING_LUT_MIN_LOG2, TONE_MAPPING_LUT_MIN_LOG2, TONE_MAPPING_LUT_MIN_LOG2),\n"
+"                     float3(TONE_MAPPING_LUT_MAX_LOG2, TONE_MAPPING_LUT_MAX_LOG2, TONE_MAPPING_LUT_MAX_LOG2),\n"
+"                     f3NormColor));\n"
+"}\n"
+"\n"
+"// Applies exposure and looks up the tone mapped color in the table built by ToneMappingLUT.\n"
+"// This replaces ToneMap() with the same tone mapping attributes.\n"
+"float3 ToneMapLUT(in float3       f3Color,\n"
+"                  in float        fMiddleGray,\n"
+"                  in float        fAveLogLum,\n"
+"                  in Texture3D    ToneMappingLUT,\n"
+"                  in SamplerState ToneMappingLUT_sampler)\n"
+"{\n"
+"    float3 f3ExposedColor = max(f3Color, float3(0.0, 0.0, 0.0)) * (fMiddleGray / fAveLogLum);\n"
+"    return ToneMappingLUT.SampleLevel(ToneMappingLUT_sampler, ExposedColorToToneMappingLUTCoord(f3ExposedColor), 0.0).rgb;\n"
+"}\n"
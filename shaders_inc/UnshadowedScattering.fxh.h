@@ -1,19 +1,17 @@
 "\n"
-"\n"
-"void ComputeUnshadowedInscattering(float2     f2SampleLocation,\n"
-"                                   float      fCamSpaceZ,\n"
-"                                   uint       uiNumSteps,\n"
-"                                   float3     f3EarthCentre,\n"
-"                                   out float3 f3Inscattering,\n"
-"                                   out float3 f3Extinction)\n"
+"// Computes unshadowed inscattering and extinction along the ray that starts at the camera position.\n"
+"// The ray is clamped by the atmosphere boundaries and the Earth surface; use +FLT_MAX ray length\n"
+"// to trace the ray through the entire atmosphere\n"
+"void ComputeUnshadowedInscatteringAlongRay(float3     f3CameraPos,\n"
+"                                           float3     f3ViewDir,\n"
+"                                           float      fRayLength,\n"
+"                                           uint       uiNumSteps,\n"
+"                                           float3     f3EarthCentre,\n"
+"                                           out float3 f3Inscattering,\n"
+"                                           out float3 f3Extinction)\n"
 "{\n"
 "    f3Inscattering = float3(0.0, 0.0, 0.0);\n"
 "    f3Extinction = float3(1.0, 1.0, 1.0);\n"
-"    float3 f3RayTermination = ProjSpaceXYZToWorldSpace( float3(f2SampleLocation, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv );\n"
-"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
-"    float3 f3ViewDir = f3RayTermination - f3CameraPos;\n"
-"    float fRayLength = length(f3ViewDir);\n"
-"    f3ViewDir /= fRayLength;\n"
 "\n"
 "    float4 f4Isecs;\n"
 "    GetRaySphereIntersection2(f3CameraPos, f3ViewDir, f3EarthCentre,\n"
@@ -38,8 +36,6 @@
 "    }\n"
 "\n"
 "    float3 f3RayStart = f3CameraPos + f3ViewDir * max(0.0, f2RayAtmTopIsecs.x);\n"
-"    if( fCamSpaceZ > g_CameraAttribs.fFarPlaneZ ) // fFarPlaneZ is pre-multiplied with 0.999999f\n"
-"        fRayLength = +FLT_MAX;\n"
 "    fRayLength = min(fRayLength, f2RayAtmTopIsecs.y);\n"
 "    // If there is an intersection with the Earth surface, limit the tracing distance to the intersection\n"
 "    if( f2RayEarthIsecs.x > 0.0 )\n"
@@ -116,3 +112,28 @@
 "#endif\n"
 "\n"
 "}\n"
+"\n"
+"void ComputeUnshadowedInscattering(float2     f2SampleLocation,\n"
+"                                   float      fCamSpaceZ,\n"
+"                                   uint       uiNumSteps,\n"
+"                                   float3     f3EarthCentre,\n"
+"                                   out float3 f3Inscattering,\n"
+"                                   out float3 f3Extinction)\n"
+"{\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"    // Sky and surfaces closer than the aerial perspective range are looked up from the per-frame tables\n"
+"    [branch]\n"
+"    if( LookUpSkyViewAndAerialPerspective(f2SampleLocation, fCamSpaceZ, f3Inscattering, f3Extinction) )\n"
+"        return;\n"
+"#endif\n"
+"\n"
+"    float3 f3RayTermination = ProjSpaceXYZToWorldSpace( float3(f2SampleLocation, fCamSpaceZ), g_CameraAttribs.mProj, g_CameraAttribs.mViewProjInv );\n"
+"    float3 f3CameraPos = g_CameraAttribs.f4Position.xyz;\n"
+"    float3 f3ViewDir = f3RayTermination - f3CameraPos;\n"
+"    float fRayLength = length(f3ViewDir);\n"
+"    f3ViewDir /= fRayLength;\n"
+"    if( fCamSpaceZ > g_CameraAttribs.fFarPlaneZ ) // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"        fRayLength = +FLT_MAX;\n"
+"\n"
+"    ComputeUnshadowedInscatteringAlongRay(f3CameraPos, f3ViewDir, fRayLength, uiNumSteps, f3EarthCentre, f3Inscattering, f3Extinction);\n"
+"}\n"
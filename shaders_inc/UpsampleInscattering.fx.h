@@ -0,0 +1,169 @@
+"// UpsampleInscattering.fx\n"
+"// Upsamples inscattering ray marched at reduced resolution using bilateral filter guided\n"
+"// by camera space z and combines it with the back buffer\n"
+"\n"
+"#include \"BasicStructures.fxh\"\n"
+"#include \"AtmosphereShadersCommon.fxh\"\n"
+"\n"
+"cbuffer cbParticipatingMediaScatteringParams\n"
+"{\n"
+"    AirScatteringAttribs g_MediaParams;\n"
+"}\n"
+"\n"
+"cbuffer cbLightParams\n"
+"{\n"
+"    LightAttribs g_LightAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbPostProcessingAttribs\n"
+"{\n"
+"    EpipolarLightScatteringAttribs g_PPAttribs;\n"
+"}\n"
+"\n"
+"cbuffer cbCameraAttribs\n"
+"{\n"
+"    CameraAttribs g_CameraAttribs;\n"
+"}\n"
+"\n"
+"Texture2D<float4> g_tex2DDownscaledInsctr;\n"
+"Texture2D<float>  g_tex2DDownscaledCamSpaceZ;\n"
+"\n"
+"Texture2D<float>  g_tex2DCamSpaceZ;\n"
+"\n"
+"Texture2D<float4> g_tex2DColorBuffer;\n"
+"\n"
+"Texture2D<float>  g_tex2DAverageLuminance;\n"
+"\n"
+"#if USE_TONE_MAPPING_LUT\n"
+"Texture3D<float4> g_tex3DToneMappingLUT;\n"
+"SamplerState      g_tex3DToneMappingLUT_sampler;\n"
+"#endif\n"
+"\n"
+"#if USE_SKY_AND_AERIAL_PERSPECTIVE_LUTS\n"
+"Texture2D<float3> g_tex2DSkyViewInsctr;\n"
+"SamplerState      g_tex2DSkyViewInsctr_sampler;\n"
+"\n"
+"Texture2D<float3> g_tex2DSkyViewExtinction;\n"
+"SamplerState      g_tex2DSkyViewExtinction_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveInsctr;\n"
+"SamplerState      g_tex3DAerialPerspectiveInsctr_sampler;\n"
+"\n"
+"Texture3D<float3> g_tex3DAerialPerspectiveExtinction;\n"
+"SamplerState      g_tex3DAerialPerspectiveExtinction_sampler;\n"
+"#endif\n"
+"\n"
+"#include \"Extinction.fxh\"\n"
+"#include \"SkyViewAndAerialPerspective.fxh\"\n"
+"#include \"ToneMapping.fxh\"\n"
+"\n"
+"void UpsampleDownscaledInsctr(in  int2   i2PixelPos,\n"
+"                              in  float  fCamSpaceZ,\n"
+"                              out float3 f3Inscattering)\n"
+"{\n"
+"    int  iDownscaleFactor = int(g_PPAttribs.uiBruteForceDownscaleFactor);\n"
+"    int2 i2ScreenDim      = int2(g_PPAttribs.f4ScreenResolution.xy);\n"
+"    int2 i2DownscaledDim  = (i2ScreenDim + int2(iDownscaleFactor - 1, iDownscaleFactor - 1)) / iDownscaleFactor;\n"
+"\n"
+"    // Downscaled texel i contains inscattering ray marched for the full resolution\n"
+"    // pixel i * DownscaleFactor + DownscaleFactor/2 (see RayMarchDownscaledPS()):\n"
+"    //\n"
+"    //      0   1   2   3   4   5   6   7      Full resolution pixel\n"
+"    //    |   |   | X |   |   |   | X |   |\n"
+"    //    |<------------->|<------------->|\n"
+"    //            0               1            Downscaled texel (DownscaleFactor == 4)\n"
+"    //\n"
+"    float2 f2SrcPos      = float2(i2PixelPos - int2(iDownscaleFactor/2, iDownscaleFactor/2)) / float(iDownscaleFactor);\n"
+"    float2 f2SrcPosFloor = floor(f2SrcPos);\n"
+"    float2 f2UVWeight    = f2SrcPos - f2SrcPosFloor;\n"
+"    int2   i2SrcPos      = int2(f2SrcPosFloor);\n"
+"\n"
+"    float3 f3BilinearInsctr = float3(0.0, 0.0, 0.0);\n"
+"    f3Inscattering = float3(0.0, 0.0, 0.0);\n"
+"    float fTotalWeight = 0.0;\n"
+"    [unroll]\n"
+"    for (int j = 0; j < 2; ++j)\n"
+"    {\n"
+"        [unroll]\n"
+"        for (int i = 0; i < 2; ++i)\n"
+"        {\n"
+"            int2 i2SrcTexel = clamp(i2SrcPos + int2(i, j), int2(0, 0), i2DownscaledDim - int2(1, 1));\n"
+"            float  fSrcCamSpaceZ = g_tex2DDownscaledCamSpaceZ.Load( int3(i2SrcTexel, 0) );\n"
+"            float3 f3SrcInsctr   = g_tex2DDownscaledInsctr.Load( int3(i2SrcTexel, 0) ).rgb;\n"
+"\n"
+"            float fBilinearWeight = (i == 0 ? 1.0 - f2UVWeight.x : f2UVWeight.x) *\n"
+"                                    (j == 0 ? 1.0 - f2UVWeight.y : f2UVWeight.y);\n"
+"\n"
+"            // Compute depth weight in a way that if the difference is less than the threshold, the weight is 1 and\n"
+"            // the weight fades out to 0 as the difference becomes larger than the threshold\n"
+"            // (the same way as in UnwarpEpipolarInsctrImage())\n"
+"            float fMaxZ = max( max(fSrcCamSpaceZ, fCamSpaceZ), 1.0 );\n"
+"            float fThreshold = g_PPAttribs.fBruteForceUpsampleDepthThreshold;\n"
+"            float fDepthWeight = saturate( fThreshold / max( abs(fCamSpaceZ - fSrcCamSpaceZ) / fMaxZ, fThreshold ) );\n"
+"            fDepthWeight = pow(fDepthWeight, 4.0);\n"
+"\n"
+"            f3BilinearInsctr += fBilinearWeight * f3SrcInsctr;\n"
+"            f3Inscattering   += fBilinearWeight * fDepthWeight * f3SrcInsctr;\n"
+"            fTotalWeight     += fBilinearWeight * fDepthWeight;\n"
+"        }\n"
+"    }\n"
+"\n"
+"    if( fTotalWeight < 1e-2 )\n"
+"    {\n"
+"#if CORRECT_INSCATTERING_AT_DEPTH_BREAKS\n"
+"        // None of the low-resolution samples belongs to the same surface as this pixel.\n"
+"        // Discarded pixels will keep 1.0 in the depth buffer and will be later\n"
+"        // ray marched at full resolution\n"
+"        discard;\n"
+"#else\n"
+"        f3Inscattering = f3BilinearInsctr;\n"
+"        fTotalWeight   = 1.0;\n"
+"#endif\n"
+"    }\n"
+"\n"
+"    f3Inscattering /= fTotalWeight;\n"
+"}\n"
+"\n"
+"\n"
+"void UpsampleAndApplyInscatteringPS(FullScreenTriangleVSOutput VSOut,\n"
+"                                    // IMPORTANT: non-system generated pixel shader input\n"
+"                                    // arguments must have the exact same name as vertex shader\n"
+"                                    // outputs and must go in the same order.\n"
+"                                    // Moreover, even if the shader is not using the argument,\n"
+"                                    // it still must be declared.\n"
+"\n"
+"                                    out float4 f4Color : SV_Target)\n"
+"{\n"
+"    // Note that the render target may be smaller than the screen when rendering luminance\n"
+"    int2 i2PixelPos = int2( NormalizedDeviceXYToTexUV(VSOut.f2NormalizedXY) * g_PPAttribs.f4ScreenResolution.xy );\n"
+"    i2PixelPos = min(i2PixelPos, int2(g_PPAttribs.f4ScreenResolution.xy) - int2(1, 1));\n"
+"    float fCamSpaceZ = g_tex2DCamSpaceZ.Load( int3(i2PixelPos, 0) );\n"
+"\n"
+"    float3 f3Inscattering;\n"
+"    UpsampleDownscaledInsctr(i2PixelPos, fCamSpaceZ, f3Inscattering);\n"
+"\n"
+"    float3 f3BackgroundColor = float3(0.0, 0.0, 0.0);\n"
+"    [branch]\n"
+"    if( !g_PPAttribs.bShowLightingOnly )\n"
+"    {\n"
+"        f3BackgroundColor = g_tex2DColorBuffer.Load( int3(i2PixelPos, 0) ).rgb;\n"
+"        // fFarPlaneZ is pre-multiplied with 0.999999f\n"
+"        f3BackgroundColor *= (fCamSpaceZ > g_CameraAttribs.fFarPlaneZ) ? g_LightAttribs.f4Intensity.rgb : float3(1.0, 1.0, 1.0);\n"
+"        float3 f3Extinction = GetBackgroundExtinction(VSOut.f2NormalizedXY.xy, fCamSpaceZ);\n"
+"        f3BackgroundColor *= f3Extinction;\n"
+"    }\n"
+"\n"
+"#if PERFORM_TONE_MAPPING\n"
+"    float fAveLogLum = GetAverageSceneLuminance(g_tex2DAverageLuminance);\n"
+"#   if USE_TONE_MAPPING_LUT\n"
+"    f4Color.rgb = ToneMapLUT(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping.fMiddleGray, fAveLogLum, g_tex3DToneMappingLUT, g_tex3DToneMappingLUT_sampler);\n"
+"#   else\n"
+"    f4Color.rgb = ToneMap(f3BackgroundColor + f3Inscattering, g_PPAttribs.ToneMapping, fAveLogLum);\n"
+"#   endif\n"
+"#else\n"
+"    const float MinLumn = 0.01;\n"
+"    float2 LogLum_W = GetWeightedLogLum(f3BackgroundColor + f3Inscattering, MinLumn);\n"
+"    f4Color.rgb = float3(LogLum_W.x, LogLum_W.y, 0.0);\n"
+"#endif\n"
+"    f4Color.a = 1.0;\n"
+"}\n"
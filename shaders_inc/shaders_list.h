@@ -54,14 +54,26 @@ static const ShaderIncInfo g_Shaders[] =
         "Shadows.fxh",
         #include "Shadows.fxh.h"
     },
+    {
+        "ComputeIrradianceMap.csh",
+        #include "ComputeIrradianceMap.csh.h"
+    },
     {
         "ComputeIrradianceMap.psh",
         #include "ComputeIrradianceMap.psh.h"
     },
+    {
+        "ComputeIrradianceSH.csh",
+        #include "ComputeIrradianceSH.csh.h"
+    },
     {
         "CubemapFace.vsh",
         #include "CubemapFace.vsh.h"
     },
+    {
+        "GLTF_PBR_EnvMapFiltering.fxh",
+        #include "GLTF_PBR_EnvMapFiltering.fxh.h"
+    },
     {
         "GLTF_PBR_PrecomputeCommon.fxh",
         #include "GLTF_PBR_PrecomputeCommon.fxh.h"
@@ -70,6 +82,10 @@ static const ShaderIncInfo g_Shaders[] =
         "PrecomputeGLTF_BRDF.psh",
         #include "PrecomputeGLTF_BRDF.psh.h"
     },
+    {
+        "PrefilterEnvMap.csh",
+        #include "PrefilterEnvMap.csh.h"
+    },
     {
         "PrefilterEnvMap.psh",
         #include "PrefilterEnvMap.psh.h"
@@ -110,6 +126,10 @@ static const ShaderIncInfo g_Shaders[] =
         "RenderGLTF_PBR.vsh",
         #include "RenderGLTF_PBR.vsh.h"
     },
+    {
+        "ToneMapGLTF_PBR.psh",
+        #include "ToneMapGLTF_PBR.psh.h"
+    },
     {
         "GLTF_PBR_Shading.fxh",
         #include "GLTF_PBR_Shading.fxh.h"
@@ -134,10 +154,30 @@ static const ShaderIncInfo g_Shaders[] =
         "QxGLTF_PBR_VertexProcessing.hlsl",
         #include "QxGLTF_PBR_VertexProcessing.hlsl.h"
     },
+    {
+        "AutoExposureCommon.fxh",
+        #include "AutoExposureCommon.fxh.h"
+    },
+    {
+        "ComputeExposure.csh",
+        #include "ComputeExposure.csh.h"
+    },
+    {
+        "ComputeLuminanceHistogram.csh",
+        #include "ComputeLuminanceHistogram.csh.h"
+    },
+    {
+        "AutoExposureStructures.fxh",
+        #include "AutoExposureStructures.fxh.h"
+    },
     {
         "AtmosphereShadersCommon.fxh",
         #include "AtmosphereShadersCommon.fxh.h"
     },
+    {
+        "BuildMinMaxShadowMap.fx",
+        #include "BuildMinMaxShadowMap.fx.h"
+    },
     {
         "CoarseInsctr.fx",
         #include "CoarseInsctr.fx.h"
@@ -146,10 +186,18 @@ static const ShaderIncInfo g_Shaders[] =
         "ComputeMinMaxShadowMapLevel.fx",
         #include "ComputeMinMaxShadowMapLevel.fx.h"
     },
+    {
+        "ComputeRayMarchingDispatchArgs.fx",
+        #include "ComputeRayMarchingDispatchArgs.fx.h"
+    },
     {
         "Extinction.fxh",
         #include "Extinction.fxh.h"
     },
+    {
+        "FroxelInscattering.fx",
+        #include "FroxelInscattering.fx.h"
+    },
     {
         "InitializeMinMaxShadowMap.fx",
         #include "InitializeMinMaxShadowMap.fx.h"
@@ -194,6 +242,14 @@ static const ShaderIncInfo g_Shaders[] =
         "ScatteringIntegrals.fxh",
         #include "ScatteringIntegrals.fxh.h"
     },
+    {
+        "SkyViewAndAerialPerspective.fx",
+        #include "SkyViewAndAerialPerspective.fx.h"
+    },
+    {
+        "SkyViewAndAerialPerspective.fxh",
+        #include "SkyViewAndAerialPerspective.fxh.h"
+    },
     {
         "SliceUVDirection.fx",
         #include "SliceUVDirection.fx.h"
@@ -210,10 +266,18 @@ static const ShaderIncInfo g_Shaders[] =
         "UnwarpEpipolarScattering.fx",
         #include "UnwarpEpipolarScattering.fx.h"
     },
+    {
+        "UnwarpEpipolarScattering.fxh",
+        #include "UnwarpEpipolarScattering.fxh.h"
+    },
     {
         "UpdateAverageLuminance.fx",
         #include "UpdateAverageLuminance.fx.h"
     },
+    {
+        "UpsampleInscattering.fx",
+        #include "UpsampleInscattering.fx.h"
+    },
     {
         "CombineScatteringOrders.fx",
         #include "CombineScatteringOrders.fx.h"
@@ -258,6 +322,10 @@ static const ShaderIncInfo g_Shaders[] =
         "EpipolarLightScatteringStructures.fxh",
         #include "EpipolarLightScatteringStructures.fxh.h"
     },
+    {
+        "BuildToneMappingLUT.csh",
+        #include "BuildToneMappingLUT.csh.h"
+    },
     {
         "QxToneMapping.hlsl",
         #include "QxToneMapping.hlsl.h"